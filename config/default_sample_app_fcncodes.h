@@ -39,5 +39,7 @@
 #define SAMPLE_APP_RESET_COUNTERS_CC 1
 #define SAMPLE_APP_PROCESS_CC        2
 #define SAMPLE_APP_DISPLAY_PARAM_CC  3
+#define SAMPLE_APP_RESET_STATS_CC    4
+#define SAMPLE_APP_LOOKUP_RECORD_CC  5
 
 #endif
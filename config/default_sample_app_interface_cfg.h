@@ -41,4 +41,104 @@
  */
 #define SAMPLE_APP_STRING_VAL_LEN 10
 
+/**
+ * \brief Number of MID/CC pairs tracked in the dispatch statistics packet
+ *
+ * Each distinct message ID and command code combination seen on the
+ * command pipe takes one entry, in order of first arrival.  Dispatches
+ * for combinations beyond this limit are counted but not histogrammed.
+ */
+#define SAMPLE_APP_STATS_MAX_ENTRIES 8
+
+/**
+ * \brief Number of log2 latency histogram bins per MID/CC pair
+ *
+ * Bin 0 counts dispatches that took under 2 microseconds and bin N counts
+ * those in [2^N, 2^(N+1)) microseconds.  The last bin also collects
+ * everything longer.
+ */
+#define SAMPLE_APP_LATENCY_HIST_BINS 16
+
+/**
+ * \brief Maximum number of configuration records in the example table
+ *
+ * Each record is 8 bytes, so the whole table must stay within the
+ * CFE_PLATFORM_TBL_MAX_SNGL_TABLE_SIZE limit of the target platform.
+ */
+#define SAMPLE_APP_TBL_MAX_RECORDS 1024
+
+/**
+ * \brief Number of worker child tasks
+ *
+ * Heavy commands are handed to these tasks so the main task stays free
+ * for housekeeping and fast commands.  Each worker has an entry in the
+ * housekeeping packet.  Must be at least 1.
+ */
+#define SAMPLE_APP_NUM_WORKERS 2
+
+/**
+ * \brief Number of software bus pipes, one per message priority class
+ *
+ * Must match the number of entries in SAMPLE_APP_PIPE_CONFIG_TABLE.
+ * Each pipe has a high-watermark entry in the housekeeping packet.
+ */
+#define SAMPLE_APP_NUM_PIPES 2
+
+/**
+ * \brief Number of command codes covered by admission control and rate limits
+ *
+ * The admission telemetry packet has a deferred and a shed counter for
+ * each command code below this limit.  Must be greater than the highest
+ * command code; larger codes are never deferred, shed or rate limited.
+ */
+#define SAMPLE_APP_ADMIT_MAX_CC 8
+
+/**
+ * \brief Number of entries in the rate limit table
+ *
+ * Each entry is a token bucket for one message ID and command code, and
+ * has a reject counter in the admission control telemetry packet.
+ */
+#define SAMPLE_APP_RATE_LIMIT_MAX_ENTRIES 8
+
+/**
+ * \brief Number of sensor channels accepted on the sensor data message
+ *
+ * Each channel keeps its own filter history, so blocks from different
+ * channels may be interleaved freely.
+ */
+#define SAMPLE_APP_SENSOR_CHANNELS 4
+
+/**
+ * \brief Number of samples in each sensor data and filtered data block
+ */
+#define SAMPLE_APP_SENSOR_BLOCK_SAMPLES 64
+
+/**
+ * \brief Maximum number of FIR filter taps in the example table
+ */
+#define SAMPLE_APP_FIR_MAX_TAPS 32
+
+/**
+ * \brief Number of sliding windows reported per channel in the sensor statistics packet
+ */
+#define SAMPLE_APP_SENSOR_STAT_WINDOWS 2
+
+/**
+ * \brief Number of quantiles estimated per channel in the sensor quantile packet
+ */
+#define SAMPLE_APP_SENSOR_QUANTILES 3
+
+/**
+ * \brief Number of entries in the limit table
+ *
+ * Each entry checks one telemetry point against its red and yellow limits.
+ */
+#define SAMPLE_APP_LIMIT_MAX_ENTRIES 32
+
+/**
+ * \brief Maximum number of coefficients or breakpoints of a calibration curve
+ */
+#define SAMPLE_APP_CAL_MAX_POINTS 8
+
 #endif
@@ -36,10 +36,129 @@
 #define SAMPLE_APP_PIPE_DEPTH 32 /* Depth of the Command Pipe for Application */
 #define SAMPLE_APP_PIPE_NAME  "SAMPLE_APP_CMD_PIPE"
 
-#define SAMPLE_APP_NUMBER_OF_TABLES 1 /* Number of Example Table(s) */
+#define SAMPLE_APP_HK_PIPE_DEPTH 4 /* Depth of the Housekeeping Request Pipe */
+#define SAMPLE_APP_HK_PIPE_NAME  "SAMPLE_APP_HK_PIPE"
+
+#define SAMPLE_APP_PIPE_DRAIN_LIMIT 8 /* Max messages processed per wakeup of the main loop */
+
+#define SAMPLE_APP_SENSOR_MSG_LIM 8 /* Sensor data blocks queued on the command pipe */
+#define SAMPLE_APP_LIMIT_MSG_LIM  4 /* Packets of each limit checked MID queued on the command pipe */
+
+/*
+ * Software bus pipes, one per priority class, highest priority first.
+ * The main loop blocks on the housekeeping request pipe, SAMPLE_APP_PIPE_WAKE,
+ * so each scheduler tick wakes it at once and the telemetry schedule keeps
+ * its rate.  Every wakeup then serves all the pipes in priority order, and
+ * SAMPLE_APP_PIPE_PEND_TIME bounds how long a ground command waits between
+ * ticks, or when the scheduler is not running.
+ *
+ * Each entry is { Name, Depth, Weight, { { MsgId, MsgLim }, ... } } where
+ * Weight is the number of messages taken from the pipe per weighted round
+ * and MsgLim is the CFE_SB_SubscribeEx limit of that message ID on the pipe.
+ * Subscription entries with a MsgLim of 0 are unused.
+ *
+ * A single entry subscribing every message ID gives the classic one pipe
+ * layout, for which the pend time may be CFE_SB_PEND_FOREVER.
+ */
+#define SAMPLE_APP_PIPE_MAX_SUBS  2    /* Subscription entries per pipe */
+#define SAMPLE_APP_PIPE_WAKE      0   /* Index of the pipe the main loop blocks on */
+#define SAMPLE_APP_PIPE_PEND_TIME 100 /* Longest the main loop blocks, in milliseconds */
+#define SAMPLE_APP_PIPE_CONFIG_TABLE                                                                              \
+    {                                                                                                             \
+        {SAMPLE_APP_HK_PIPE_NAME, SAMPLE_APP_HK_PIPE_DEPTH, 1, {{SAMPLE_APP_SEND_HK_MID, 2}}},                    \
+        {SAMPLE_APP_PIPE_NAME,                                                                                    \
+         SAMPLE_APP_PIPE_DEPTH,                                                                                   \
+         4,                                                                                                       \
+         {{SAMPLE_APP_CMD_MID, SAMPLE_APP_PIPE_DEPTH}, {SAMPLE_APP_SENSOR_DATA_MID, SAMPLE_APP_SENSOR_MSG_LIM}}}, \
+    }
+
+#define SAMPLE_APP_PIPE_SERVICE_STRICT false /* Serve pipes strictly by priority rather than by weight */
+
+/*
+ * Admission control.  The backlog is the number of messages taken from the
+ * pipes since they were last found empty.  Low priority commands arriving
+ * with the backlog at the defer level are held for replay once it clears,
+ * and at the shed level, or with the hold full, they are dropped and counted.
+ */
+#define SAMPLE_APP_ADMIT_DEFER_BACKLOG 8
+#define SAMPLE_APP_ADMIT_SHED_BACKLOG  24
+#define SAMPLE_APP_ADMIT_DEFER_DEPTH   4 /* Commands held for replay */
+
+#define SAMPLE_APP_NUMBER_OF_TABLES 4 /* Number of Example, Rate Limit, Limit and Calibration Table(s) */
 
 #define SAMPLE_APP_TABLE_OUT_OF_RANGE_ERR_CODE -1
+#define SAMPLE_APP_TABLE_CHECK_PENDING         1 /* Record check not yet complete */
+#define SAMPLE_APP_WORKER_QUEUE_FULL_ERR_CODE  -2
+#define SAMPLE_APP_SENSOR_CHANNEL_ERR_CODE     -3
+#define SAMPLE_APP_SENSOR_RANGE_ERR_CODE       -4
+#define SAMPLE_APP_RECORD_NOT_FOUND_ERR_CODE   -5
+
+#define SAMPLE_APP_TBL_ELEMENT_1_MAX    10
+#define SAMPLE_APP_TBL_RECORD_VALUE_MAX 100000
+
+#define SAMPLE_APP_TBL_CHECK_BUDGET 256 /* Max example table records checked per housekeeping cycle */
+
+#define SAMPLE_APP_SCRUB_BYTES_PER_CYCLE 4096 /* Max example table bytes re-checksummed per housekeeping cycle */
+#define SAMPLE_APP_SCRUB_RELOAD_ON_ERROR true /* Reload the example table file when a scrub finds corruption */
+
+#define SAMPLE_APP_WORKER_RING_DEPTH 8 /* Jobs queued per worker, must be a power of 2 */
+#define SAMPLE_APP_WORKER_STACK_SIZE 16384
+#define SAMPLE_APP_WORKER_PRIORITY   60
+#define SAMPLE_APP_WORKER_NAME       "SAMPLE_WORKER"
+
+#define SAMPLE_APP_TRACE_DEPTH        64 /* Binary trace records held until formatted, must be a power of 2 */
+#define SAMPLE_APP_TRACE_FLUSH_BUDGET 16 /* Max trace records formatted per housekeeping cycle */
+
+#define SAMPLE_APP_COALESCE_SLOTS  64   /* Distinct recent error events tracked, must be a power of 2 */
+#define SAMPLE_APP_COALESCE_WINDOW 1000 /* Repeats of an error event within this many ms are summarized */
+
+/*
+ * Raw sensor counts outside [SAMPLE_APP_SENSOR_RAW_MIN, SAMPLE_APP_SENSOR_RAW_MAX]
+ * are not valid readings, and a block holding one is rejected whole
+ */
+#define SAMPLE_APP_SENSOR_RAW_MIN -32000
+#define SAMPLE_APP_SENSOR_RAW_MAX 32000
+
+/*
+ * Sensor statistics.  Each channel keeps its most recent filtered samples
+ * in a ring, and statistics are kept over the newest so many samples of
+ * it for each window, one length per SAMPLE_APP_SENSOR_STAT_WINDOWS.
+ */
+#define SAMPLE_APP_SENSOR_RING_DEPTH     256       /* Samples held per channel, must be a power of 2 up to 32768 */
+#define SAMPLE_APP_SENSOR_WINDOW_SAMPLES {64, 256} /* Window lengths, each at most SAMPLE_APP_SENSOR_RING_DEPTH */
+
+/*
+ * Quantiles estimated over all filtered samples of each channel since
+ * the last statistics reset, in thousandths, one per SAMPLE_APP_SENSOR_QUANTILES
+ */
+#define SAMPLE_APP_SENSOR_QUANTILE_PERMILLE {500, 950, 990}
+
+/*
+ * Calibration lookup.  Each channel's curve is tabulated at every so many
+ * raw counts, 1 << SAMPLE_APP_CAL_LUT_SHIFT, and interpolated in between.
+ * Piecewise curves are exact as long as no two breakpoints fall inside
+ * the same span; tables that break this are rejected.
+ */
+#define SAMPLE_APP_CAL_LUT_SHIFT 8 /* At most 15, smaller is closer to the curve but larger */
+
+/*
+ * Telemetry schedule.  Each housekeeping request is one wakeup, and a
+ * product is sent on the wakeups where the wakeup count modulo its
+ * divisor equals its slot.  Products sharing a divisor should be given
+ * different slots so they are not all sent on the same wakeup.
+ */
+#define SAMPLE_APP_HK_TLM_DIVISOR       1
+#define SAMPLE_APP_HK_TLM_SLOT          0
+#define SAMPLE_APP_STATS_TLM_DIVISOR    4
+#define SAMPLE_APP_STATS_TLM_SLOT       1
+#define SAMPLE_APP_ADMIT_TLM_DIVISOR    4
+#define SAMPLE_APP_ADMIT_TLM_SLOT       3
+#define SAMPLE_APP_WINSTATS_TLM_DIVISOR 1
+#define SAMPLE_APP_WINSTATS_TLM_SLOT    0
+#define SAMPLE_APP_QUANTILE_TLM_DIVISOR 4
+#define SAMPLE_APP_QUANTILE_TLM_SLOT    2
 
-#define SAMPLE_APP_TBL_ELEMENT_1_MAX 10
+#define SAMPLE_APP_HK_CHANGE_ONLY     false /* Only send housekeeping when a counter in it has changed */
+#define SAMPLE_APP_HK_KEEPALIVE_COUNT 10    /* In change-only mode, send on at least every this many requests */
 
 #endif
@@ -36,6 +36,26 @@ typedef struct SAMPLE_APP_DisplayParam_Payload
     char   ValStr[SAMPLE_APP_STRING_VAL_LEN]; /**< An example string */
 } SAMPLE_APP_DisplayParam_Payload_t;
 
+typedef struct SAMPLE_APP_LookupRecord_Payload
+{
+    uint16 Key; /**< Key of the example table record to report */
+    uint16 spare;
+} SAMPLE_APP_LookupRecord_Payload_t;
+
+/*************************************************************************/
+/*
+** Type definition (Sample App worker statistics)
+*/
+
+typedef struct SAMPLE_APP_WorkerStats
+{
+    uint16 QueueDepth;     /**< Jobs waiting for the worker */
+    uint16 PeakQueueDepth; /**< Most jobs ever waiting for the worker */
+    uint32 CompletedCount; /**< Jobs the worker has finished */
+    uint16 Utilization;    /**< Share of the last housekeeping interval spent on jobs, 0.01% units */
+    uint16 spare;
+} SAMPLE_APP_WorkerStats_t;
+
 /*************************************************************************/
 /*
 ** Type definition (Sample App housekeeping)
@@ -43,9 +63,118 @@ typedef struct SAMPLE_APP_DisplayParam_Payload
 
 typedef struct SAMPLE_APP_HkTlm_Payload
 {
-    uint8 CommandErrorCounter;
-    uint8 CommandCounter;
-    uint8 spare[2];
+    uint8  CommandErrorCounter;
+    uint8  CommandCounter;
+    uint8  spare[2];
+    uint16 LastWakeupMsgCount; /**< Messages processed on the most recent wakeup */
+    uint16 PeakWakeupMsgCount; /**< Most messages processed on any single wakeup */
+    uint32 DrainLimitHitCount; /**< Wakeups that stopped at the per-wakeup drain limit */
+    uint32 ScrubPassCount;     /**< Complete scrub passes over the example table image */
+    uint32 ScrubErrorCount;    /**< Scrub passes whose CRC did not match the load CRC */
+    uint32 LastScrubTime;      /**< Time spent scrubbing on the most recent cycle, microseconds */
+    uint32 TraceLostCount;     /**< Trace records overwritten before they were formatted */
+    uint32 TlmCopyCount;       /**< Packets sent by copy because no SB buffer was available */
+    uint32 HkSuppressedCount;  /**< Requests answered with no packet as nothing had changed */
+
+    SAMPLE_APP_WorkerStats_t Worker[SAMPLE_APP_NUM_WORKERS];          /**< Per worker task statistics */
+    uint16                   PipeHighWatermark[SAMPLE_APP_NUM_PIPES]; /**< Most each pipe can have held, in messages */
 } SAMPLE_APP_HkTlm_Payload_t;
 
+/*************************************************************************/
+/*
+** Type definition (Sample App dispatch statistics)
+*/
+
+typedef struct SAMPLE_APP_DispatchStats
+{
+    uint32 MsgId;                                     /**< Message ID value of this entry */
+    uint16 CommandCode;                               /**< Function code of this entry */
+    uint16 spare;
+    uint32 DispatchCount;                             /**< Messages dispatched for this MID/CC */
+    uint32 MaxLatency;                                /**< Longest receive-to-completion time, microseconds */
+    uint32 LatencyHist[SAMPLE_APP_LATENCY_HIST_BINS]; /**< log2 histogram of latency, microseconds */
+} SAMPLE_APP_DispatchStats_t;
+
+typedef struct SAMPLE_APP_StatsTlm_Payload
+{
+    uint32                     UntrackedCount; /**< Dispatches with no free entry to record them */
+    SAMPLE_APP_DispatchStats_t Entry[SAMPLE_APP_STATS_MAX_ENTRIES];
+} SAMPLE_APP_StatsTlm_Payload_t;
+
+/*************************************************************************/
+/*
+** Type definition (Sample App admission control)
+*/
+
+typedef struct SAMPLE_APP_AdmitTlm_Payload
+{
+    uint16 Backlog;                                           /**< Messages taken since the pipes were last empty */
+    uint16 PeakBacklog;                                       /**< Largest backlog seen */
+    uint32 DeferCount[SAMPLE_APP_ADMIT_MAX_CC];               /**< Commands held for replay, per command code */
+    uint32 ShedCount[SAMPLE_APP_ADMIT_MAX_CC];                /**< Commands dropped under load, per command code */
+    uint32 RateLimitCount[SAMPLE_APP_RATE_LIMIT_MAX_ENTRIES]; /**< Messages rejected, per rate limit table entry */
+} SAMPLE_APP_AdmitTlm_Payload_t;
+
+/*************************************************************************/
+/*
+** Type definition (Sample App sensor data)
+*/
+
+typedef struct SAMPLE_APP_SensorBlock_Payload
+{
+    uint16 Channel; /**< Sensor channel the samples belong to */
+    uint16 spare;
+    int16  Sample[SAMPLE_APP_SENSOR_BLOCK_SAMPLES]; /**< Consecutive samples, oldest first */
+} SAMPLE_APP_SensorBlock_Payload_t;
+
+/*************************************************************************/
+/*
+** Type definition (Sample App sensor window statistics)
+*/
+
+typedef struct SAMPLE_APP_WindowStats
+{
+    uint16 Length;   /**< Window length in samples */
+    uint16 Count;    /**< Samples in the window, less than Length until the channel has that many */
+    int16  Min;      /**< Smallest sample in the window */
+    int16  Max;      /**< Largest sample in the window */
+    float  Mean;     /**< Mean of the samples in the window */
+    float  Variance; /**< Population variance of the samples in the window */
+} SAMPLE_APP_WindowStats_t;
+
+typedef struct SAMPLE_APP_WinStatsTlm_Payload
+{
+    SAMPLE_APP_WindowStats_t Window[SAMPLE_APP_SENSOR_CHANNELS][SAMPLE_APP_SENSOR_STAT_WINDOWS];
+} SAMPLE_APP_WinStatsTlm_Payload_t;
+
+/*************************************************************************/
+/*
+** Type definition (Sample App sensor quantiles)
+*/
+
+typedef struct SAMPLE_APP_QuantileEstimate
+{
+    uint16 Permille; /**< Quantile estimated, in thousandths */
+    uint16 spare;
+    float  Value; /**< Estimated sample value at that quantile */
+} SAMPLE_APP_QuantileEstimate_t;
+
+typedef struct SAMPLE_APP_QuantileTlm_Payload
+{
+    uint32                        Count[SAMPLE_APP_SENSOR_CHANNELS]; /**< Samples seen since the last reset */
+    SAMPLE_APP_QuantileEstimate_t Quantile[SAMPLE_APP_SENSOR_CHANNELS][SAMPLE_APP_SENSOR_QUANTILES];
+} SAMPLE_APP_QuantileTlm_Payload_t;
+
+/*************************************************************************/
+/*
+** Type definition (Sample App sensor engineering units)
+*/
+
+typedef struct SAMPLE_APP_EngBlock_Payload
+{
+    uint16 Channel; /**< Sensor channel the values belong to */
+    uint16 spare;
+    float  Value[SAMPLE_APP_SENSOR_BLOCK_SAMPLES]; /**< Filtered samples in engineering units, oldest first */
+} SAMPLE_APP_EngBlock_Payload_t;
+
 #endif
@@ -26,8 +26,15 @@
 #include "cfe_core_api_base_msgids.h"
 #include "sample_app_topicids.h"
 
-#define SAMPLE_APP_CMD_MID     CFE_PLATFORM_CMD_TOPICID_TO_MIDV(CFE_MISSION_SAMPLE_APP_CMD_TOPICID)
-#define SAMPLE_APP_SEND_HK_MID CFE_PLATFORM_CMD_TOPICID_TO_MIDV(CFE_MISSION_SAMPLE_APP_SEND_HK_TOPICID)
-#define SAMPLE_APP_HK_TLM_MID  CFE_PLATFORM_TLM_TOPICID_TO_MIDV(CFE_MISSION_SAMPLE_APP_HK_TLM_TOPICID)
+#define SAMPLE_APP_CMD_MID          CFE_PLATFORM_CMD_TOPICID_TO_MIDV(CFE_MISSION_SAMPLE_APP_CMD_TOPICID)
+#define SAMPLE_APP_SENSOR_DATA_MID  CFE_PLATFORM_CMD_TOPICID_TO_MIDV(CFE_MISSION_SAMPLE_APP_SENSOR_DATA_TOPICID)
+#define SAMPLE_APP_SEND_HK_MID      CFE_PLATFORM_CMD_TOPICID_TO_MIDV(CFE_MISSION_SAMPLE_APP_SEND_HK_TOPICID)
+#define SAMPLE_APP_HK_TLM_MID       CFE_PLATFORM_TLM_TOPICID_TO_MIDV(CFE_MISSION_SAMPLE_APP_HK_TLM_TOPICID)
+#define SAMPLE_APP_STATS_TLM_MID    CFE_PLATFORM_TLM_TOPICID_TO_MIDV(CFE_MISSION_SAMPLE_APP_STATS_TLM_TOPICID)
+#define SAMPLE_APP_ADMIT_TLM_MID    CFE_PLATFORM_TLM_TOPICID_TO_MIDV(CFE_MISSION_SAMPLE_APP_ADMIT_TLM_TOPICID)
+#define SAMPLE_APP_FILTERED_TLM_MID CFE_PLATFORM_TLM_TOPICID_TO_MIDV(CFE_MISSION_SAMPLE_APP_FILTERED_TLM_TOPICID)
+#define SAMPLE_APP_WINSTATS_TLM_MID CFE_PLATFORM_TLM_TOPICID_TO_MIDV(CFE_MISSION_SAMPLE_APP_WINSTATS_TLM_TOPICID)
+#define SAMPLE_APP_QUANTILE_TLM_MID CFE_PLATFORM_TLM_TOPICID_TO_MIDV(CFE_MISSION_SAMPLE_APP_QUANTILE_TLM_TOPICID)
+#define SAMPLE_APP_ENG_TLM_MID      CFE_PLATFORM_TLM_TOPICID_TO_MIDV(CFE_MISSION_SAMPLE_APP_ENG_TLM_TOPICID)
 
 #endif
@@ -66,6 +66,17 @@ typedef struct
     SAMPLE_APP_DisplayParam_Payload_t Payload;
 } SAMPLE_APP_DisplayParamCmd_t;
 
+typedef struct
+{
+    CFE_MSG_CommandHeader_t CommandHeader; /**< \brief Command header */
+} SAMPLE_APP_ResetStatsCmd_t;
+
+typedef struct
+{
+    CFE_MSG_CommandHeader_t           CommandHeader; /**< \brief Command header */
+    SAMPLE_APP_LookupRecord_Payload_t Payload;
+} SAMPLE_APP_LookupRecordCmd_t;
+
 /*************************************************************************/
 /*
 ** Type definition (Sample App housekeeping)
@@ -82,4 +93,76 @@ typedef struct
     SAMPLE_APP_HkTlm_Payload_t Payload;         /**< \brief Telemetry payload */
 } SAMPLE_APP_HkTlm_t;
 
+/*************************************************************************/
+/*
+** Type definition (Sample App dispatch statistics)
+*/
+
+typedef struct
+{
+    CFE_MSG_TelemetryHeader_t     TelemetryHeader; /**< \brief Telemetry header */
+    SAMPLE_APP_StatsTlm_Payload_t Payload;         /**< \brief Telemetry payload */
+} SAMPLE_APP_StatsTlm_t;
+
+/*************************************************************************/
+/*
+** Type definition (Sample App admission control)
+*/
+
+typedef struct
+{
+    CFE_MSG_TelemetryHeader_t     TelemetryHeader; /**< \brief Telemetry header */
+    SAMPLE_APP_AdmitTlm_Payload_t Payload;         /**< \brief Telemetry payload */
+} SAMPLE_APP_AdmitTlm_t;
+
+/*************************************************************************/
+/*
+** Type definition (Sample App sensor data and filtered data)
+*/
+
+typedef struct
+{
+    CFE_MSG_CommandHeader_t          CommandHeader; /**< \brief Command header */
+    SAMPLE_APP_SensorBlock_Payload_t Payload;
+} SAMPLE_APP_SensorDataCmd_t;
+
+typedef struct
+{
+    CFE_MSG_TelemetryHeader_t        TelemetryHeader; /**< \brief Telemetry header */
+    SAMPLE_APP_SensorBlock_Payload_t Payload;         /**< \brief Telemetry payload */
+} SAMPLE_APP_FilteredTlm_t;
+
+/*************************************************************************/
+/*
+** Type definition (Sample App sensor window statistics)
+*/
+
+typedef struct
+{
+    CFE_MSG_TelemetryHeader_t        TelemetryHeader; /**< \brief Telemetry header */
+    SAMPLE_APP_WinStatsTlm_Payload_t Payload;         /**< \brief Telemetry payload */
+} SAMPLE_APP_WinStatsTlm_t;
+
+/*************************************************************************/
+/*
+** Type definition (Sample App sensor quantiles)
+*/
+
+typedef struct
+{
+    CFE_MSG_TelemetryHeader_t        TelemetryHeader; /**< \brief Telemetry header */
+    SAMPLE_APP_QuantileTlm_Payload_t Payload;         /**< \brief Telemetry payload */
+} SAMPLE_APP_QuantileTlm_t;
+
+/*************************************************************************/
+/*
+** Type definition (Sample App sensor engineering units)
+*/
+
+typedef struct
+{
+    CFE_MSG_TelemetryHeader_t     TelemetryHeader; /**< \brief Telemetry header */
+    SAMPLE_APP_EngBlock_Payload_t Payload;         /**< \brief Telemetry payload */
+} SAMPLE_APP_EngTlm_t;
+
 #endif /* SAMPLE_APP_MSGSTRUCT_H */
@@ -31,6 +31,9 @@
 #include "sample_app_tblstruct.h"
 
 /* Define filenames of default data images for tables */
-#define SAMPLE_APP_TABLE_FILE "/cf/sample_app_tbl.tbl"
+#define SAMPLE_APP_TABLE_FILE            "/cf/sample_app_tbl.tbl"
+#define SAMPLE_APP_RATE_LIMIT_TABLE_FILE "/cf/sample_app_ratelimit_tbl.tbl"
+#define SAMPLE_APP_LIMIT_TABLE_FILE      "/cf/sample_app_limit_tbl.tbl"
+#define SAMPLE_APP_CAL_TABLE_FILE        "/cf/sample_app_cal_tbl.tbl"
 
 #endif
@@ -33,13 +33,103 @@
 #include "common_types.h"
 #include "sample_app_mission_cfg.h"
 
+/*
+** Example Table configuration record
+*/
+typedef struct
+{
+    uint16 Key;
+    uint16 spare;
+    uint32 Value;
+} SAMPLE_APP_ExampleRecord_t;
+
 /*
 ** Example Table structure
 */
 typedef struct
 {
-    uint16 Int1;
-    uint16 Int2;
+    uint16                     Int1;
+    uint16                     Int2;
+    uint16                     NumRecords;                        /* Number of valid entries in Record */
+    uint16                     FirNumTaps;                        /* Entries in FirCoeff, 0 for no filtering */
+    int16                      FirCoeff[SAMPLE_APP_FIR_MAX_TAPS]; /* Sensor filter taps, Q15, newest first */
+    SAMPLE_APP_ExampleRecord_t Record[SAMPLE_APP_TBL_MAX_RECORDS];
 } SAMPLE_APP_ExampleTable_t;
 
+/*
+** Rate Limit Table entry, a token bucket for one MID/CC
+*/
+typedef struct
+{
+    uint32 MsgId;       /* Message ID value, 0 marks an unused entry */
+    uint16 CommandCode; /* Function code, 0 for messages without one */
+    uint16 BurstSize;   /* Bucket depth, messages accepted back to back */
+    uint32 RatePerSec;  /* Sustained messages per second */
+} SAMPLE_APP_RateLimitEntry_t;
+
+/*
+** Rate Limit Table structure
+*/
+typedef struct
+{
+    SAMPLE_APP_RateLimitEntry_t Entry[SAMPLE_APP_RATE_LIMIT_MAX_ENTRIES];
+} SAMPLE_APP_RateLimitTable_t;
+
+/*
+** Limit Table point types, the layout of the value at the point's offset
+*/
+#define SAMPLE_APP_LIMIT_TYPE_UINT8  1
+#define SAMPLE_APP_LIMIT_TYPE_UINT16 2
+#define SAMPLE_APP_LIMIT_TYPE_INT16  3
+#define SAMPLE_APP_LIMIT_TYPE_INT32  4
+
+/*
+** Limit Table entry, one telemetry point and its limits.  A value
+** below a low limit or above a high limit is out of that limit.
+*/
+typedef struct
+{
+    uint32 MsgId;  /* Telemetry message ID value, 0 marks an unused entry */
+    uint16 Offset; /* Byte offset of the point from the start of the message */
+    uint16 Type;   /* One of the SAMPLE_APP_LIMIT_TYPE values */
+    int32  RedLow; /* Limits, RedLow <= YellowLow <= YellowHigh <= RedHigh */
+    int32  YellowLow;
+    int32  YellowHigh;
+    int32  RedHigh;
+} SAMPLE_APP_LimitEntry_t;
+
+/*
+** Limit Table structure
+*/
+typedef struct
+{
+    SAMPLE_APP_LimitEntry_t Entry[SAMPLE_APP_LIMIT_MAX_ENTRIES];
+} SAMPLE_APP_LimitTable_t;
+
+/*
+** Calibration curve types
+*/
+#define SAMPLE_APP_CAL_TYPE_NONE      0 /* Engineering value is the raw value */
+#define SAMPLE_APP_CAL_TYPE_POLY      1 /* Polynomial in the raw value */
+#define SAMPLE_APP_CAL_TYPE_PIECEWISE 2 /* Straight lines between breakpoints, flat past the ends */
+
+/*
+** Calibration curve of one sensor channel, from raw counts to engineering units
+*/
+typedef struct
+{
+    uint16 Type;                           /* One of the SAMPLE_APP_CAL_TYPE values */
+    uint16 NumPoints;                      /* Coefficients or breakpoints used */
+    int16  Raw[SAMPLE_APP_CAL_MAX_POINTS]; /* Piecewise breakpoints, strictly increasing */
+    float  Eng[SAMPLE_APP_CAL_MAX_POINTS]; /* Polynomial coefficients from the constant up, or breakpoint values */
+} SAMPLE_APP_CalCurve_t;
+
+/*
+** Calibration Table structure
+*/
+typedef struct
+{
+    SAMPLE_APP_CalCurve_t Channel[SAMPLE_APP_SENSOR_CHANNELS];
+} SAMPLE_APP_CalTable_t;
+
 #endif
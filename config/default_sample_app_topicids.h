@@ -23,8 +23,15 @@
 #ifndef SAMPLE_APP_TOPICIDS_H
 #define SAMPLE_APP_TOPICIDS_H
 
-#define CFE_MISSION_SAMPLE_APP_CMD_TOPICID       0x82
-#define CFE_MISSION_SAMPLE_APP_SEND_HK_TOPICID   0x83
-#define CFE_MISSION_SAMPLE_APP_HK_TLM_TOPICID    0x83
+#define CFE_MISSION_SAMPLE_APP_CMD_TOPICID          0x82
+#define CFE_MISSION_SAMPLE_APP_SENSOR_DATA_TOPICID  0x84
+#define CFE_MISSION_SAMPLE_APP_SEND_HK_TOPICID      0x83
+#define CFE_MISSION_SAMPLE_APP_HK_TLM_TOPICID       0x83
+#define CFE_MISSION_SAMPLE_APP_STATS_TLM_TOPICID    0x84
+#define CFE_MISSION_SAMPLE_APP_ADMIT_TLM_TOPICID    0x85
+#define CFE_MISSION_SAMPLE_APP_FILTERED_TLM_TOPICID 0x86
+#define CFE_MISSION_SAMPLE_APP_WINSTATS_TLM_TOPICID 0x87
+#define CFE_MISSION_SAMPLE_APP_QUANTILE_TLM_TOPICID 0x88
+#define CFE_MISSION_SAMPLE_APP_ENG_TLM_TOPICID      0x89
 
 #endif
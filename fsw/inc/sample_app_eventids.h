@@ -25,18 +25,33 @@
 #ifndef SAMPLE_APP_EVENTS_H
 #define SAMPLE_APP_EVENTS_H
 
-#define SAMPLE_APP_RESERVED_EID      0
-#define SAMPLE_APP_INIT_INF_EID      1
-#define SAMPLE_APP_CC_ERR_EID        2
-#define SAMPLE_APP_NOOP_INF_EID      3
-#define SAMPLE_APP_RESET_INF_EID     4
-#define SAMPLE_APP_MID_ERR_EID       5
-#define SAMPLE_APP_CMD_LEN_ERR_EID   6
-#define SAMPLE_APP_PIPE_ERR_EID      7
-#define SAMPLE_APP_VALUE_INF_EID     8
-#define SAMPLE_APP_CR_PIPE_ERR_EID   9
-#define SAMPLE_APP_SUB_HK_ERR_EID    10
-#define SAMPLE_APP_SUB_CMD_ERR_EID   11
-#define SAMPLE_APP_TABLE_REG_ERR_EID 12
+#define SAMPLE_APP_RESERVED_EID        0
+#define SAMPLE_APP_INIT_INF_EID        1
+#define SAMPLE_APP_CC_ERR_EID          2
+#define SAMPLE_APP_NOOP_INF_EID        3
+#define SAMPLE_APP_RESET_INF_EID       4
+#define SAMPLE_APP_MID_ERR_EID         5
+#define SAMPLE_APP_CMD_LEN_ERR_EID     6
+#define SAMPLE_APP_PIPE_ERR_EID        7
+#define SAMPLE_APP_VALUE_INF_EID       8
+#define SAMPLE_APP_CR_PIPE_ERR_EID     9
+#define SAMPLE_APP_SUB_HK_ERR_EID      10
+#define SAMPLE_APP_SUB_CMD_ERR_EID     11
+#define SAMPLE_APP_TABLE_REG_ERR_EID   12
+#define SAMPLE_APP_RESET_STATS_INF_EID 13
+#define SAMPLE_APP_TBL_INDEX_INF_EID   14
+#define SAMPLE_APP_TBL_RECORD_ERR_EID  15
+#define SAMPLE_APP_TBL_SCRUB_ERR_EID   16
+#define SAMPLE_APP_WORKER_FULL_ERR_EID 17
+#define SAMPLE_APP_WORKER_ERR_EID      18
+#define SAMPLE_APP_RATE_LIMIT_ERR_EID  19
+#define SAMPLE_APP_TBL_VALUES_INF_EID  20
+#define SAMPLE_APP_REPEAT_ERR_EID      21
+#define SAMPLE_APP_SENSOR_ERR_EID      22
+#define SAMPLE_APP_LIMIT_ERR_EID       23
+#define SAMPLE_APP_LIMIT_LEN_ERR_EID   24
+#define SAMPLE_APP_LOOKUP_INF_EID      25
+#define SAMPLE_APP_LOOKUP_ERR_EID      26
+#define SAMPLE_APP_TBL_FIR_ERR_EID     27
 
 #endif /* SAMPLE_APP_EVENTS_H */
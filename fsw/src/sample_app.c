@@ -28,7 +28,12 @@
 #include "sample_app_cmds.h"
 #include "sample_app_utils.h"
 #include "sample_app_eventids.h"
-#include "sample_app_dispatch.h"
+#include "sample_app_crc.h"
+#include "sample_app_worker.h"
+#include "sample_app_pipes.h"
+#include "sample_app_ratelimit.h"
+#include "sample_app_limit.h"
+#include "sample_app_cal.h"
 #include "sample_app_tbl.h"
 #include "sample_app_version.h"
 
@@ -73,19 +78,27 @@ void SAMPLE_APP_Main(void)
         */
         CFE_ES_PerfLogExit(SAMPLE_APP_PERF_ID);
 
-        /* Pend on receipt of command packet */
-        status = CFE_SB_ReceiveBuffer(&SBBufPtr, SAMPLE_APP_Data.CommandPipe, CFE_SB_PEND_FOREVER);
+        /* Block on the scheduler's housekeeping requests, timing out so commands are never left waiting long */
+        status = CFE_SB_ReceiveBuffer(&SBBufPtr, SAMPLE_APP_Data.Pipe[SAMPLE_APP_PIPE_WAKE].PipeId,
+                                      SAMPLE_APP_PIPE_PEND_TIME);
 
         /*
         ** Performance Log Entry Stamp
         */
         CFE_ES_PerfLogEntry(SAMPLE_APP_PERF_ID);
 
+        if (status == CFE_SB_TIME_OUT)
+        {
+            SBBufPtr = NULL;
+            status   = CFE_SUCCESS;
+        }
+
         if (status == CFE_SUCCESS)
         {
-            SAMPLE_APP_TaskPipe(SBBufPtr);
+            status = SAMPLE_APP_ServicePipes(SBBufPtr);
         }
-        else
+
+        if (status != CFE_SUCCESS)
         {
             CFE_EVS_SendEvent(SAMPLE_APP_PIPE_ERR_EID, CFE_EVS_EventType_ERROR,
                               "SAMPLE APP: SB Pipe Read Error, App Will Exit");
@@ -117,6 +130,13 @@ CFE_Status_t SAMPLE_APP_Init(void)
 
     SAMPLE_APP_Data.RunStatus = CFE_ES_RunStatus_APP_RUN;
 
+    /* In change-only mode the first housekeeping request still sends a packet */
+    SAMPLE_APP_Data.HkChangeOnly = SAMPLE_APP_HK_CHANGE_ONLY;
+    SAMPLE_APP_Data.HkSinceSent  = SAMPLE_APP_HK_KEEPALIVE_COUNT - 1;
+
+    /* The CRC tables are needed before the example table is first acquired */
+    SAMPLE_APP_CrcInit();
+
     /*
     ** Register the events
     */
@@ -134,40 +154,53 @@ CFE_Status_t SAMPLE_APP_Init(void)
                      sizeof(SAMPLE_APP_Data.HkTlm));
 
         /*
-         ** Create Software Bus message pipe.
+         ** Initialize dispatch statistics packet (clear user data area).
          */
-        status = CFE_SB_CreatePipe(&SAMPLE_APP_Data.CommandPipe, SAMPLE_APP_PIPE_DEPTH, SAMPLE_APP_PIPE_NAME);
-        if (status != CFE_SUCCESS)
-        {
-            CFE_EVS_SendEvent(SAMPLE_APP_CR_PIPE_ERR_EID, CFE_EVS_EventType_ERROR,
-                              "Sample App: Error creating SB Command Pipe, RC = 0x%08lX", (unsigned long)status);
-        }
-    }
+        CFE_MSG_Init(CFE_MSG_PTR(SAMPLE_APP_Data.StatsTlm.TelemetryHeader),
+                     CFE_SB_ValueToMsgId(SAMPLE_APP_STATS_TLM_MID), sizeof(SAMPLE_APP_Data.StatsTlm));
 
-    if (status == CFE_SUCCESS)
-    {
         /*
-        ** Subscribe to Housekeeping request commands
-        */
-        status = CFE_SB_Subscribe(CFE_SB_ValueToMsgId(SAMPLE_APP_SEND_HK_MID), SAMPLE_APP_Data.CommandPipe);
-        if (status != CFE_SUCCESS)
-        {
-            CFE_EVS_SendEvent(SAMPLE_APP_SUB_HK_ERR_EID, CFE_EVS_EventType_ERROR,
-                              "Sample App: Error Subscribing to HK request, RC = 0x%08lX", (unsigned long)status);
-        }
+         ** Initialize admission control packet (clear user data area).
+         */
+        CFE_MSG_Init(CFE_MSG_PTR(SAMPLE_APP_Data.AdmitTlm.TelemetryHeader),
+                     CFE_SB_ValueToMsgId(SAMPLE_APP_ADMIT_TLM_MID), sizeof(SAMPLE_APP_Data.AdmitTlm));
+
+        /*
+         ** Initialize filtered sensor data packet (clear user data area).
+         */
+        CFE_MSG_Init(CFE_MSG_PTR(SAMPLE_APP_Data.FilteredTlm.TelemetryHeader),
+                     CFE_SB_ValueToMsgId(SAMPLE_APP_FILTERED_TLM_MID), sizeof(SAMPLE_APP_Data.FilteredTlm));
+
+        /*
+         ** Initialize sensor window statistics packet (clear user data area).
+         */
+        CFE_MSG_Init(CFE_MSG_PTR(SAMPLE_APP_Data.WinStatsTlm.TelemetryHeader),
+                     CFE_SB_ValueToMsgId(SAMPLE_APP_WINSTATS_TLM_MID), sizeof(SAMPLE_APP_Data.WinStatsTlm));
+
+        /*
+         ** Initialize sensor quantile packet (clear user data area).
+         */
+        CFE_MSG_Init(CFE_MSG_PTR(SAMPLE_APP_Data.QuantileTlm.TelemetryHeader),
+                     CFE_SB_ValueToMsgId(SAMPLE_APP_QUANTILE_TLM_MID), sizeof(SAMPLE_APP_Data.QuantileTlm));
+
+        /*
+         ** Initialize sensor engineering units packet (clear user data area).
+         */
+        CFE_MSG_Init(CFE_MSG_PTR(SAMPLE_APP_Data.EngTlm.TelemetryHeader), CFE_SB_ValueToMsgId(SAMPLE_APP_ENG_TLM_MID),
+                     sizeof(SAMPLE_APP_Data.EngTlm));
+
+        /*
+         ** Create the Software Bus message pipes and subscriptions.
+         */
+        status = SAMPLE_APP_PipesInit();
     }
 
     if (status == CFE_SUCCESS)
     {
         /*
-        ** Subscribe to ground command packets
+        ** Start the worker tasks that run heavy commands off the main task
         */
-        status = CFE_SB_Subscribe(CFE_SB_ValueToMsgId(SAMPLE_APP_CMD_MID), SAMPLE_APP_Data.CommandPipe);
-        if (status != CFE_SUCCESS)
-        {
-            CFE_EVS_SendEvent(SAMPLE_APP_SUB_CMD_ERR_EID, CFE_EVS_EventType_ERROR,
-                              "Sample App: Error Subscribing to Commands, RC = 0x%08lX", (unsigned long)status);
-        }
+        status = SAMPLE_APP_WorkerInit();
     }
 
     if (status == CFE_SUCCESS)
@@ -187,6 +220,84 @@ CFE_Status_t SAMPLE_APP_Init(void)
             status = CFE_TBL_Load(SAMPLE_APP_Data.TblHandles[0], CFE_TBL_SRC_FILE, SAMPLE_APP_TABLE_FILE);
         }
 
+        if (status == CFE_SUCCESS)
+        {
+            SAMPLE_APP_AcquireExampleTable();
+        }
+
+        /*
+        ** Register the rate limit table and build its token buckets
+        */
+        if (status == CFE_SUCCESS)
+        {
+            status = CFE_TBL_Register(&SAMPLE_APP_Data.TblHandles[1], "RateLimitTable",
+                                      sizeof(SAMPLE_APP_RateLimitTable_t), CFE_TBL_OPT_DEFAULT,
+                                      SAMPLE_APP_RateLimitValidationFunc);
+            if (status != CFE_SUCCESS)
+            {
+                CFE_EVS_SendEvent(SAMPLE_APP_TABLE_REG_ERR_EID, CFE_EVS_EventType_ERROR,
+                                  "Sample App: Error Registering Rate Limit Table, RC = 0x%08lX",
+                                  (unsigned long)status);
+            }
+            else
+            {
+                status =
+                    CFE_TBL_Load(SAMPLE_APP_Data.TblHandles[1], CFE_TBL_SRC_FILE, SAMPLE_APP_RATE_LIMIT_TABLE_FILE);
+            }
+        }
+
+        if (status == CFE_SUCCESS)
+        {
+            SAMPLE_APP_UpdateRateLimits();
+        }
+
+        /*
+        ** Register the telemetry limit table and subscribe to its packets
+        */
+        if (status == CFE_SUCCESS)
+        {
+            status = CFE_TBL_Register(&SAMPLE_APP_Data.TblHandles[2], "LimitTable", sizeof(SAMPLE_APP_LimitTable_t),
+                                      CFE_TBL_OPT_DEFAULT, SAMPLE_APP_LimitValidationFunc);
+            if (status != CFE_SUCCESS)
+            {
+                CFE_EVS_SendEvent(SAMPLE_APP_TABLE_REG_ERR_EID, CFE_EVS_EventType_ERROR,
+                                  "Sample App: Error Registering Limit Table, RC = 0x%08lX", (unsigned long)status);
+            }
+            else
+            {
+                status = CFE_TBL_Load(SAMPLE_APP_Data.TblHandles[2], CFE_TBL_SRC_FILE, SAMPLE_APP_LIMIT_TABLE_FILE);
+            }
+        }
+
+        if (status == CFE_SUCCESS)
+        {
+            SAMPLE_APP_UpdateLimits();
+        }
+
+        /*
+        ** Register the sensor calibration table and build its lookup tables
+        */
+        if (status == CFE_SUCCESS)
+        {
+            status = CFE_TBL_Register(&SAMPLE_APP_Data.TblHandles[3], "CalibrationTable", sizeof(SAMPLE_APP_CalTable_t),
+                                      CFE_TBL_OPT_DEFAULT, SAMPLE_APP_CalValidationFunc);
+            if (status != CFE_SUCCESS)
+            {
+                CFE_EVS_SendEvent(SAMPLE_APP_TABLE_REG_ERR_EID, CFE_EVS_EventType_ERROR,
+                                  "Sample App: Error Registering Calibration Table, RC = 0x%08lX",
+                                  (unsigned long)status);
+            }
+            else
+            {
+                status = CFE_TBL_Load(SAMPLE_APP_Data.TblHandles[3], CFE_TBL_SRC_FILE, SAMPLE_APP_CAL_TABLE_FILE);
+            }
+        }
+
+        if (status == CFE_SUCCESS)
+        {
+            SAMPLE_APP_UpdateCalibration();
+        }
+
         CFE_Config_GetVersionString(VersionString, SAMPLE_APP_CFG_MAX_VERSION_STR_LEN, "Sample App", SAMPLE_APP_VERSION,
                                     SAMPLE_APP_BUILD_CODENAME, SAMPLE_APP_LAST_OFFICIAL);
 
@@ -37,11 +37,321 @@
 #include "sample_app_perfids.h"
 #include "sample_app_msgids.h"
 #include "sample_app_msg.h"
+#include "sample_app_tbl.h"
 
 /************************************************************************
 ** Type Definitions
 *************************************************************************/
 
+/*
+** Message header fields, decoded once when a buffer is received
+** and passed along the dispatch path
+*/
+typedef struct
+{
+    CFE_SB_MsgId_t     MsgId;   /**< Message ID of the received buffer */
+    CFE_MSG_FcnCode_t  FcnCode; /**< Function code, 0 if the message has none */
+    CFE_MSG_Size_t     MsgSize; /**< Total size of the message including headers */
+    CFE_TIME_SysTime_t RcvTime; /**< Time the buffer was taken from the pipe */
+} SAMPLE_APP_MsgContext_t;
+
+/*
+** Software bus pipe configuration, one entry per priority class
+*/
+typedef struct
+{
+    CFE_SB_MsgId_Atom_t MsgId;
+    uint16              MsgLim; /* CFE_SB_SubscribeEx message limit, 0 if the entry is unused */
+} SAMPLE_APP_PipeSub_t;
+
+typedef struct
+{
+    const char *         Name;
+    uint16               Depth;
+    uint16               Weight; /* Messages taken from the pipe per weighted round */
+    SAMPLE_APP_PipeSub_t Sub[SAMPLE_APP_PIPE_MAX_SUBS];
+} SAMPLE_APP_PipeConfig_t;
+
+/*
+** Software bus pipe state
+*/
+typedef struct
+{
+    CFE_SB_PipeId_t PipeId;
+    uint16          Queued;        /* Messages taken from the pipe since it was last found empty */
+    uint16          HighWatermark; /* Most Queued has reached, an upper bound on the pipe's depth */
+} SAMPLE_APP_Pipe_t;
+
+/*
+** Command held by admission control for replay once the backlog clears
+*/
+typedef struct
+{
+    SAMPLE_APP_MsgContext_t MsgCtx;
+    union
+    {
+        CFE_SB_Buffer_t              SBBuf;
+        SAMPLE_APP_ProcessCmd_t      ProcessCmd;
+        SAMPLE_APP_DisplayParamCmd_t DisplayParamCmd;
+    } Msg;
+} SAMPLE_APP_DeferredCmd_t;
+
+/*
+** Message IDs that can be rate limited, each with a row of
+** token buckets indexed by command code
+*/
+#define SAMPLE_APP_RATE_LIMIT_MID_SLOTS 2
+
+/*
+** Token bucket state for one rate limit table entry
+*/
+typedef struct
+{
+    uint32             Tokens;    /* Available tokens, in thousandths of a message */
+    uint32             MaxTokens; /* Burst size, in thousandths of a message */
+    uint32             RatePerSec;
+    CFE_TIME_SysTime_t LastRefill;
+} SAMPLE_APP_TokenBucket_t;
+
+/*
+** Example table record index entry, kept sorted by key
+*/
+typedef struct
+{
+    uint16 Key;
+    uint16 RecordIdx;
+} SAMPLE_APP_RecordIndexEntry_t;
+
+/*
+** App-owned copy of the example table with its record index
+*/
+typedef struct
+{
+    SAMPLE_APP_ExampleTable_t     Tbl;
+    uint32                        Crc; /* CRC-32C of Tbl as loaded */
+    uint16                        IndexCount;
+    SAMPLE_APP_RecordIndexEntry_t Index[SAMPLE_APP_TBL_MAX_RECORDS];
+} SAMPLE_APP_TableCopy_t;
+
+/*
+** Single-producer/single-consumer job ring between the main task and
+** one worker.  Head is only written by the main task and Tail only by
+** the worker; both run freely and are masked to index Job.
+*/
+typedef struct
+{
+    uint32                  Head;
+    uint32                  Tail;
+    SAMPLE_APP_ProcessCmd_t Job[SAMPLE_APP_WORKER_RING_DEPTH];
+} SAMPLE_APP_WorkerRing_t;
+
+/*
+** Worker child task state
+*/
+typedef struct
+{
+    SAMPLE_APP_WorkerRing_t Ring;
+    osal_id_t               WakeSemId;
+    CFE_ES_TaskId_t         TaskId;
+
+    /* Written by the worker */
+    uint32 CompletedCount;
+    uint32 BusyTime; /* Total time spent on jobs, microseconds */
+
+    /* Written by the main task */
+    uint16 PeakQueueDepth;
+    uint32 LastBusyTime; /* BusyTime as of the last housekeeping request */
+} SAMPLE_APP_Worker_t;
+
+/*
+** Telemetry packet being built, either in a buffer from the software
+** bus or, if none was available, in the app's own copy of the packet
+*/
+typedef struct
+{
+    CFE_SB_Buffer_t *  SBBufPtr; /* NULL when building in the app's copy */
+    CFE_MSG_Message_t *MsgPtr;
+} SAMPLE_APP_TlmPacket_t;
+
+/*
+** Recent error event, keyed by event ID, MID and command code.
+** An EventID of SAMPLE_APP_RESERVED_EID marks a free slot.
+*/
+typedef struct
+{
+    uint16             EventID;
+    uint16             FcnCode;
+    uint32             MsgId;
+    uint32             Repeats; /* Occurrences absorbed since the one sent */
+    CFE_TIME_SysTime_t WindowStart;
+} SAMPLE_APP_CoalesceEntry_t;
+
+/*
+** Raw arguments of the example table values trace record
+*/
+typedef struct
+{
+    uint16 Int1;
+    uint16 Int2;
+    uint32 Crc;
+} SAMPLE_APP_TraceTblValues_t;
+
+/*
+** Binary trace record, formatted later from its event ID and raw
+** arguments.  Seq is its ring position + 1 once complete, and 0
+** while a writer is filling it.
+*/
+typedef struct
+{
+    uint32             Seq;
+    uint16             EventID;
+    CFE_TIME_SysTime_t Time;
+    union
+    {
+        SAMPLE_APP_DisplayParam_Payload_t DisplayParam;
+        SAMPLE_APP_TraceTblValues_t       TblValues;
+    } Args;
+} SAMPLE_APP_TraceRec_t;
+
+/*
+** Multi-producer trace ring.  Writers on any task claim a record by
+** advancing Head; only the main task advances Tail as it formats them.
+** When the ring is full the oldest records are overwritten.
+*/
+typedef struct
+{
+    uint32                Head;
+    uint32                Tail;
+    uint32                LostCount;
+    SAMPLE_APP_TraceRec_t Rec[SAMPLE_APP_TRACE_DEPTH];
+} SAMPLE_APP_TraceLog_t;
+
+/*
+** Sensor channel filter input: the last SAMPLE_APP_FIR_MAX_TAPS - 1
+** samples of the previous block, followed by the current block
+*/
+typedef struct
+{
+    int16 In[SAMPLE_APP_FIR_MAX_TAPS - 1 + SAMPLE_APP_SENSOR_BLOCK_SAMPLES];
+} SAMPLE_APP_SensorChannel_t;
+
+/*
+** Monotonic deque of ring positions for a sliding window minimum or
+** maximum.  The samples at the positions from Head to Tail are in
+** strictly increasing order for a minimum and decreasing for a maximum,
+** so the head is always the extreme of the window.  Head and Tail run
+** freely and are masked to index Pos.
+*/
+typedef struct
+{
+    uint16 Head;
+    uint16 Tail;
+    uint16 Pos[SAMPLE_APP_SENSOR_RING_DEPTH];
+} SAMPLE_APP_MonoDeque_t;
+
+/*
+** Running state of one sliding window over a channel's sample ring
+*/
+typedef struct
+{
+    int32                  Sum;
+    uint64                 SumSq;
+    SAMPLE_APP_MonoDeque_t MinQ;
+    SAMPLE_APP_MonoDeque_t MaxQ;
+} SAMPLE_APP_SensorWindow_t;
+
+/*
+** Recent filtered samples of one sensor channel.  Next runs freely and
+** is masked to index Ring; Fill counts up to the ring depth and stays.
+*/
+typedef struct
+{
+    uint16                    Next;
+    uint16                    Fill;
+    int16                     Ring[SAMPLE_APP_SENSOR_RING_DEPTH];
+    SAMPLE_APP_SensorWindow_t Window[SAMPLE_APP_SENSOR_STAT_WINDOWS];
+} SAMPLE_APP_SensorHistory_t;
+
+/*
+** P-square estimate of one quantile: the heights of five markers and
+** their positions, counting from 1, among the samples seen so far.
+** Marker 2 tracks the quantile itself.  Until five samples have been
+** seen Height holds the samples as they arrived.
+*/
+#define SAMPLE_APP_QUANTILE_MARKERS 5
+
+typedef struct
+{
+    float  Height[SAMPLE_APP_QUANTILE_MARKERS];
+    uint32 Pos[SAMPLE_APP_QUANTILE_MARKERS];
+} SAMPLE_APP_Quantile_t;
+
+/*
+** Quantile estimates of one sensor channel
+*/
+typedef struct
+{
+    uint32                Count; /* Samples seen since the last reset */
+    SAMPLE_APP_Quantile_t Quantile[SAMPLE_APP_SENSOR_QUANTILES];
+} SAMPLE_APP_SensorQuantiles_t;
+
+/*
+** Run of limit points from one message ID with the same type, checked
+** together.  MinSize is the message size needed to hold all of them.
+*/
+typedef struct
+{
+    CFE_SB_MsgId_Atom_t MsgId;
+    uint16              Type;
+    uint16              First; /* First column of the run */
+    uint16              Count;
+    uint16              MinSize;
+} SAMPLE_APP_LimitGroup_t;
+
+/*
+** Limit table compiled into columns, one per point, ordered by message
+** ID and type so each group is a contiguous run of every column
+*/
+typedef struct
+{
+    uint16                  NumGroups;
+    SAMPLE_APP_LimitGroup_t Group[SAMPLE_APP_LIMIT_MAX_ENTRIES];
+    uint16                  Offset[SAMPLE_APP_LIMIT_MAX_ENTRIES];
+    uint16                  EntryIdx[SAMPLE_APP_LIMIT_MAX_ENTRIES]; /* Limit table entry of the point */
+    uint8                   State[SAMPLE_APP_LIMIT_MAX_ENTRIES];    /* Limits the last value was out of */
+    uint8                   Reported[SAMPLE_APP_LIMIT_MAX_ENTRIES]; /* State last sent to the ground */
+    int32                   Value[SAMPLE_APP_LIMIT_MAX_ENTRIES];    /* Value that put the point in State */
+    int32                   RedLow[SAMPLE_APP_LIMIT_MAX_ENTRIES];
+    int32                   YellowLow[SAMPLE_APP_LIMIT_MAX_ENTRIES];
+    int32                   YellowHigh[SAMPLE_APP_LIMIT_MAX_ENTRIES];
+    int32                   RedHigh[SAMPLE_APP_LIMIT_MAX_ENTRIES];
+} SAMPLE_APP_LimitSet_t;
+
+/*
+** One channel's calibration curve, tabulated over the whole int16 range.
+** Segment i covers the raw values whose offset from INT16_MIN shifted
+** down by SAMPLE_APP_CAL_LUT_SHIFT is i; Base is the curve at the start of
+** the segment and Slope its rise per raw count.  A piecewise breakpoint
+** inside a segment is its Knot, counts from the segment start, and the
+** curve from there on is KnotBase at the knot rising KnotSlope per count.
+** Segments without a breakpoint inside have a Knot past their end.
+*/
+#define SAMPLE_APP_CAL_LUT_SEGMENTS (65536 >> SAMPLE_APP_CAL_LUT_SHIFT)
+
+typedef struct
+{
+    float Base[SAMPLE_APP_CAL_LUT_SEGMENTS];
+    float Slope[SAMPLE_APP_CAL_LUT_SEGMENTS];
+    int32 Knot[SAMPLE_APP_CAL_LUT_SEGMENTS];
+    float KnotBase[SAMPLE_APP_CAL_LUT_SEGMENTS];
+    float KnotSlope[SAMPLE_APP_CAL_LUT_SEGMENTS];
+} SAMPLE_APP_CalSegments_t;
+
+typedef struct
+{
+    SAMPLE_APP_CalSegments_t Channel[SAMPLE_APP_SENSOR_CHANNELS];
+} SAMPLE_APP_CalLut_t;
+
 /*
 ** Global Data
 */
@@ -53,11 +363,74 @@ typedef struct
     uint8 CmdCounter;
     uint8 ErrCounter;
 
+    /*
+    ** Pipe drain statistics...
+    */
+    uint16 LastWakeupMsgCount;
+    uint16 PeakWakeupMsgCount;
+    uint32 DrainLimitHitCount;
+
+    /*
+    ** Example table scrub statistics...
+    */
+    uint32 ScrubPassCount;
+    uint32 ScrubErrorCount;
+    uint32 LastScrubTime;
+
+    /*
+    ** Telemetry packets that could not be built in an SB buffer...
+    */
+    uint32 TlmCopyCount;
+
+    /*
+    ** Housekeeping requests seen by the telemetry scheduler...
+    */
+    uint32 TlmWakeupCount;
+
+    /*
+    ** Change-only housekeeping: the payload as last sent, and the
+    ** requests answered with no packet in a row and in total
+    */
+    bool                       HkChangeOnly;
+    uint16                     HkSinceSent;
+    uint32                     HkSuppressedCount;
+    SAMPLE_APP_HkTlm_Payload_t HkLastSent;
+
     /*
     ** Housekeeping telemetry packet...
     */
     SAMPLE_APP_HkTlm_t HkTlm;
 
+    /*
+    ** Dispatch statistics telemetry packet...
+    */
+    SAMPLE_APP_StatsTlm_t StatsTlm;
+
+    /*
+    ** Admission control telemetry packet...
+    */
+    SAMPLE_APP_AdmitTlm_t AdmitTlm;
+
+    /*
+    ** Filtered sensor data packet, used when no SB buffer is available...
+    */
+    SAMPLE_APP_FilteredTlm_t FilteredTlm;
+
+    /*
+    ** Sensor window statistics packet, used when no SB buffer is available...
+    */
+    SAMPLE_APP_WinStatsTlm_t WinStatsTlm;
+
+    /*
+    ** Sensor quantile packet, used when no SB buffer is available...
+    */
+    SAMPLE_APP_QuantileTlm_t QuantileTlm;
+
+    /*
+    ** Sensor engineering units packet, used when no SB buffer is available...
+    */
+    SAMPLE_APP_EngTlm_t EngTlm;
+
     /*
     ** Run Status variable used in the main processing loop
     */
@@ -66,9 +439,105 @@ typedef struct
     /*
     ** Operational data (not reported in housekeeping)...
     */
-    CFE_SB_PipeId_t CommandPipe;
+    SAMPLE_APP_Pipe_t Pipe[SAMPLE_APP_NUM_PIPES];
+    bool              PipeServiceStrict;
+
+    /*
+    ** Admission control backlog, and the low priority commands held
+    ** until it clears
+    */
+    uint16                   Backlog;
+    uint16                   DeferredCount;
+    SAMPLE_APP_DeferredCmd_t Deferred[SAMPLE_APP_ADMIT_DEFER_DEPTH];
+
+    /*
+    ** Rate limit token buckets from the rate limit table.  RateIndex maps
+    ** a MID slot and command code to 1 + the bucket index, 0 if unlimited.
+    */
+    SAMPLE_APP_TokenBucket_t RateBucket[SAMPLE_APP_RATE_LIMIT_MAX_ENTRIES];
+    uint8                    RateIndex[SAMPLE_APP_RATE_LIMIT_MID_SLOTS][SAMPLE_APP_ADMIT_MAX_CC];
+    uint32                   RateLimitReportCount; /* Rejects since the last summary event */
 
     CFE_TBL_Handle_t TblHandles[SAMPLE_APP_NUMBER_OF_TABLES];
+
+    /*
+    ** Example table, held locked between housekeeping requests,
+    ** and the CRC-32C of its image as of the most recent load
+    */
+    const SAMPLE_APP_ExampleTable_t *ExampleTblPtr;
+    uint32                           ExampleTblCrc;
+
+    /*
+    ** Progress of the record check of the most recent example table
+    ** load, which is only published to readers once the check passes.
+    ** A load that fails the check is rejected: it is not held again
+    ** until the next load replaces it.
+    */
+    bool   TblCheckPending;
+    bool   TblRejected;
+    uint16 TblCheckCursor;
+
+    /*
+    ** Position and running CRC of the scrub pass over the held table image
+    */
+    uint32 ScrubOffset;
+    uint32 ScrubCrc;
+
+    /*
+    ** Worker child tasks, and the time of the last housekeeping
+    ** request for computing their utilization
+    */
+    SAMPLE_APP_Worker_t Worker[SAMPLE_APP_NUM_WORKERS];
+    uint32              WorkerStartCount;
+    CFE_TIME_SysTime_t  LastHkTime;
+
+    /*
+    ** App-owned copies of the example table for child task readers.
+    ** TblCopySeq is odd while a copy is being written and advances
+    ** by two for each published load.
+    */
+    SAMPLE_APP_TableCopy_t        TblCopy[2];
+    const SAMPLE_APP_TableCopy_t *TblCopyActive;
+    uint32                        TblCopySeq;
+
+    /*
+    ** Binary trace of informational events, formatted at housekeeping
+    */
+    SAMPLE_APP_TraceLog_t Trace;
+
+    /*
+    ** Open-addressed table of recent error events, for collapsing
+    ** repeats within a window into one summary event
+    */
+    SAMPLE_APP_CoalesceEntry_t Coalesce[SAMPLE_APP_COALESCE_SLOTS];
+
+    /*
+    ** Sensor FIR filter taps from the last checked example table load,
+    ** oldest sample first, and the filter input of each channel
+    */
+    uint16                     FirNumTaps;
+    int16                      FirTaps[SAMPLE_APP_FIR_MAX_TAPS];
+    SAMPLE_APP_SensorChannel_t Sensor[SAMPLE_APP_SENSOR_CHANNELS];
+
+    /*
+    ** Recent filtered samples of each channel with their window statistics
+    */
+    SAMPLE_APP_SensorHistory_t SensorHistory[SAMPLE_APP_SENSOR_CHANNELS];
+
+    /*
+    ** Streaming quantile estimates of each channel's filtered samples
+    */
+    SAMPLE_APP_SensorQuantiles_t SensorQuantiles[SAMPLE_APP_SENSOR_CHANNELS];
+
+    /*
+    ** Telemetry limit points from the limit table
+    */
+    SAMPLE_APP_LimitSet_t Limit;
+
+    /*
+    ** Sensor calibration curves from the calibration table
+    */
+    SAMPLE_APP_CalLut_t CalLut;
 } SAMPLE_APP_Data_t;
 
 /*
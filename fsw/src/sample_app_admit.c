@@ -0,0 +1,136 @@
+/************************************************************************
+ * NASA Docket No. GSC-18,719-1, and identified as “core Flight System: Bootes”
+ *
+ * Copyright (c) 2020 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/**
+ * \file
+ *   This file contains the source code for the Sample App admission control functions
+ */
+
+/*
+** Include Files:
+*/
+#include "sample_app.h"
+#include "sample_app_dispatch.h"
+#include "sample_app_msgids.h"
+#include "sample_app_admit.h"
+
+/*
+ * Command codes that may be deferred or shed under load, indexed by
+ * command code.  All other codes, including NOOP and RESET, are always
+ * admitted, as are housekeeping requests.
+ */
+static const bool SAMPLE_APP_ADMIT_LOW_PRIORITY[SAMPLE_APP_ADMIT_MAX_CC] = {
+    [SAMPLE_APP_PROCESS_CC]       = true,
+    [SAMPLE_APP_DISPLAY_PARAM_CC] = true,
+};
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Record the current backlog in the peak                          */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+static void SAMPLE_APP_UpdatePeakBacklog(void)
+{
+    if (SAMPLE_APP_Data.Backlog > SAMPLE_APP_Data.AdmitTlm.Payload.PeakBacklog)
+    {
+        SAMPLE_APP_Data.AdmitTlm.Payload.PeakBacklog = SAMPLE_APP_Data.Backlog;
+    }
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Decide whether a received message runs now.  Returns false if   */
+/* it was deferred or shed instead.                                */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+bool SAMPLE_APP_AdmitCommand(const CFE_SB_Buffer_t *SBBufPtr, const SAMPLE_APP_MsgContext_t *MsgCtx)
+{
+    SAMPLE_APP_AdmitTlm_Payload_t *Stats = &SAMPLE_APP_Data.AdmitTlm.Payload;
+    SAMPLE_APP_DeferredCmd_t *     Deferred;
+
+    if (SAMPLE_APP_Data.Backlog < SAMPLE_APP_ADMIT_DEFER_BACKLOG ||
+        CFE_SB_MsgIdToValue(MsgCtx->MsgId) != SAMPLE_APP_CMD_MID || MsgCtx->FcnCode >= SAMPLE_APP_ADMIT_MAX_CC ||
+        !SAMPLE_APP_ADMIT_LOW_PRIORITY[MsgCtx->FcnCode])
+    {
+        return true;
+    }
+
+    SAMPLE_APP_UpdatePeakBacklog();
+
+    if (SAMPLE_APP_Data.Backlog < SAMPLE_APP_ADMIT_SHED_BACKLOG &&
+        SAMPLE_APP_Data.DeferredCount < SAMPLE_APP_ADMIT_DEFER_DEPTH && MsgCtx->MsgSize <= sizeof(Deferred->Msg))
+    {
+        Deferred = &SAMPLE_APP_Data.Deferred[SAMPLE_APP_Data.DeferredCount];
+        memcpy(&Deferred->MsgCtx, MsgCtx, sizeof(Deferred->MsgCtx));
+        memcpy(&Deferred->Msg, SBBufPtr, MsgCtx->MsgSize);
+        ++SAMPLE_APP_Data.DeferredCount;
+        ++Stats->DeferCount[MsgCtx->FcnCode];
+    }
+    else
+    {
+        ++Stats->ShedCount[MsgCtx->FcnCode];
+    }
+
+    return false;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* The pipes were found empty: reset the backlog and replay the    */
+/* held commands in arrival order                                  */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+void SAMPLE_APP_AdmitBacklogCleared(void)
+{
+    uint16 i;
+
+    SAMPLE_APP_UpdatePeakBacklog();
+    SAMPLE_APP_Data.Backlog = 0;
+
+    /*
+     * Held commands already passed the limit, rate and admission checks on
+     * arrival, so they go straight to the command handlers
+     */
+    for (i = 0; i < SAMPLE_APP_Data.DeferredCount; ++i)
+    {
+        SAMPLE_APP_ProcessGroundCommand(&SAMPLE_APP_Data.Deferred[i].Msg.SBBuf, &SAMPLE_APP_Data.Deferred[i].MsgCtx);
+    }
+
+    SAMPLE_APP_Data.DeferredCount = 0;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Fill in the current backlog of the admission control packet     */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+void SAMPLE_APP_UpdateAdmitStats(void)
+{
+    SAMPLE_APP_UpdatePeakBacklog();
+    SAMPLE_APP_Data.AdmitTlm.Payload.Backlog = SAMPLE_APP_Data.Backlog;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Clear the admission control counters                            */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+void SAMPLE_APP_ResetAdmitStats(void)
+{
+    memset(&SAMPLE_APP_Data.AdmitTlm.Payload, 0, sizeof(SAMPLE_APP_Data.AdmitTlm.Payload));
+}
@@ -0,0 +1,368 @@
+/************************************************************************
+ * NASA Docket No. GSC-18,719-1, and identified as “core Flight System: Bootes”
+ *
+ * Copyright (c) 2020 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/**
+ * \file
+ *   This file contains the source code for the Sample App sensor calibration functions
+ */
+
+/*
+** Include Files:
+*/
+#include "sample_app.h"
+#include "sample_app_cal.h"
+
+#include <float.h>
+
+#if defined(__SSE2__)
+#include <immintrin.h>
+#endif
+
+/*
+ * Raw counts in each lookup segment, and the mask of a count's place in its segment
+ */
+#define SAMPLE_APP_CAL_SEGMENT_COUNTS (1 << SAMPLE_APP_CAL_LUT_SHIFT)
+#define SAMPLE_APP_CAL_FRAC_MASK      (SAMPLE_APP_CAL_SEGMENT_COUNTS - 1)
+
+/*
+ * Offset of a raw count from INT16_MIN, and the lookup segment it falls in
+ */
+#define SAMPLE_APP_CAL_OFFSET(Raw)  ((uint32)((int32)(Raw)-INT16_MIN))
+#define SAMPLE_APP_CAL_SEGMENT(Raw) (SAMPLE_APP_CAL_OFFSET(Raw) >> SAMPLE_APP_CAL_LUT_SHIFT)
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Value of a calibration curve at a raw count.  Raw may be one    */
+/* past INT16_MAX, for the end of the last lookup segment.         */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+static double SAMPLE_APP_CalEval(const SAMPLE_APP_CalCurve_t *Curve, int32 Raw)
+{
+    double Value;
+    uint16 i;
+
+    switch (Curve->Type)
+    {
+        case SAMPLE_APP_CAL_TYPE_POLY:
+            Value = Curve->Eng[Curve->NumPoints - 1];
+            for (i = Curve->NumPoints - 1; i > 0; --i)
+            {
+                Value = (Value * Raw) + Curve->Eng[i - 1];
+            }
+            return Value;
+
+        case SAMPLE_APP_CAL_TYPE_PIECEWISE:
+            if (Raw <= Curve->Raw[0])
+            {
+                return Curve->Eng[0];
+            }
+
+            for (i = 1; i < Curve->NumPoints; ++i)
+            {
+                if (Raw < Curve->Raw[i])
+                {
+                    return Curve->Eng[i - 1] + ((double)Curve->Eng[i] - Curve->Eng[i - 1]) *
+                                                   (Raw - Curve->Raw[i - 1]) / (Curve->Raw[i] - Curve->Raw[i - 1]);
+                }
+            }
+            return Curve->Eng[Curve->NumPoints - 1];
+
+        default:
+            return Raw;
+    }
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Verify contents of the Calibration Table buffer                 */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+CFE_Status_t SAMPLE_APP_CalValidationFunc(void *TblData)
+{
+    SAMPLE_APP_CalTable_t *      TblDataPtr = (SAMPLE_APP_CalTable_t *)TblData;
+    const SAMPLE_APP_CalCurve_t *Curve;
+    double                       Value;
+    uint32                       Ch;
+    uint32                       s;
+    uint16                       i;
+
+    for (Ch = 0; Ch < SAMPLE_APP_SENSOR_CHANNELS; ++Ch)
+    {
+        Curve = &TblDataPtr->Channel[Ch];
+
+        switch (Curve->Type)
+        {
+            case SAMPLE_APP_CAL_TYPE_NONE:
+                continue;
+
+            case SAMPLE_APP_CAL_TYPE_POLY:
+                if (Curve->NumPoints < 1 || Curve->NumPoints > SAMPLE_APP_CAL_MAX_POINTS)
+                {
+                    return SAMPLE_APP_TABLE_OUT_OF_RANGE_ERR_CODE;
+                }
+                break;
+
+            case SAMPLE_APP_CAL_TYPE_PIECEWISE:
+                if (Curve->NumPoints < 2 || Curve->NumPoints > SAMPLE_APP_CAL_MAX_POINTS)
+                {
+                    return SAMPLE_APP_TABLE_OUT_OF_RANGE_ERR_CODE;
+                }
+                for (i = 1; i < Curve->NumPoints; ++i)
+                {
+                    if (Curve->Raw[i] <= Curve->Raw[i - 1])
+                    {
+                        return SAMPLE_APP_TABLE_OUT_OF_RANGE_ERR_CODE;
+                    }
+
+                    /* A lookup segment has room for one breakpoint off its start */
+                    if (SAMPLE_APP_CAL_SEGMENT(Curve->Raw[i]) == SAMPLE_APP_CAL_SEGMENT(Curve->Raw[i - 1]) &&
+                        (SAMPLE_APP_CAL_OFFSET(Curve->Raw[i - 1]) & SAMPLE_APP_CAL_FRAC_MASK) != 0)
+                    {
+                        return SAMPLE_APP_TABLE_OUT_OF_RANGE_ERR_CODE;
+                    }
+                }
+                break;
+
+            default:
+                return SAMPLE_APP_TABLE_OUT_OF_RANGE_ERR_CODE;
+        }
+
+        /*
+         * Written this way round the comparisons also reject NaN.  Values
+         * at the segment ends must fit a float for the lookup table.
+         */
+        for (i = 0; i < Curve->NumPoints; ++i)
+        {
+            if (!(Curve->Eng[i] >= -FLT_MAX && Curve->Eng[i] <= FLT_MAX))
+            {
+                return SAMPLE_APP_TABLE_OUT_OF_RANGE_ERR_CODE;
+            }
+        }
+
+        for (s = 0; s <= SAMPLE_APP_CAL_LUT_SEGMENTS; ++s)
+        {
+            Value = SAMPLE_APP_CalEval(Curve, INT16_MIN + (int32)(s << SAMPLE_APP_CAL_LUT_SHIFT));
+            if (!(Value >= -FLT_MAX && Value <= FLT_MAX))
+            {
+                return SAMPLE_APP_TABLE_OUT_OF_RANGE_ERR_CODE;
+            }
+        }
+    }
+
+    return CFE_SUCCESS;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Tabulate one channel's curve into its lookup segments.  Lines   */
+/* between piecewise breakpoints are exact, so a breakpoint inside */
+/* a segment becomes its knot rather than being smoothed over.     */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+static void SAMPLE_APP_CalCompile(const SAMPLE_APP_CalCurve_t *Curve, SAMPLE_APP_CalSegments_t *Lut)
+{
+    double Lo;
+    double Hi;
+    double Mid;
+    int32  Start;
+    int32  Knot;
+    uint32 s;
+    uint16 i = 0;
+
+    Hi = SAMPLE_APP_CalEval(Curve, INT16_MIN);
+    for (s = 0; s < SAMPLE_APP_CAL_LUT_SEGMENTS; ++s)
+    {
+        Start = INT16_MIN + (int32)(s << SAMPLE_APP_CAL_LUT_SHIFT);
+        Lo    = Hi;
+        Hi    = SAMPLE_APP_CalEval(Curve, Start + SAMPLE_APP_CAL_SEGMENT_COUNTS);
+        Knot  = SAMPLE_APP_CAL_SEGMENT_COUNTS;
+
+        if (Curve->Type == SAMPLE_APP_CAL_TYPE_PIECEWISE)
+        {
+            while (i < Curve->NumPoints && Curve->Raw[i] <= Start)
+            {
+                ++i;
+            }
+            if (i < Curve->NumPoints && Curve->Raw[i] < Start + SAMPLE_APP_CAL_SEGMENT_COUNTS)
+            {
+                Knot = Curve->Raw[i] - Start;
+            }
+        }
+
+        Mid = SAMPLE_APP_CalEval(Curve, Start + Knot);
+
+        Lut->Base[s]      = (float)Lo;
+        Lut->Slope[s]     = (float)((Mid - Lo) / Knot);
+        Lut->Knot[s]      = Knot;
+        Lut->KnotBase[s]  = (float)Mid;
+        Lut->KnotSlope[s] = 0.0f;
+        if (Knot < SAMPLE_APP_CAL_SEGMENT_COUNTS)
+        {
+            Lut->KnotSlope[s] = (float)((Hi - Mid) / (SAMPLE_APP_CAL_SEGMENT_COUNTS - Knot));
+        }
+    }
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Rebuild the calibration lookup tables when a new table has been */
+/* loaded.  This is the only work a load costs; conversion never   */
+/* looks at the table itself.                                      */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+void SAMPLE_APP_UpdateCalibration(void)
+{
+    CFE_Status_t           status;
+    SAMPLE_APP_CalTable_t *TblPtr;
+    uint32                 Ch;
+
+    status = CFE_TBL_GetAddress((void *)&TblPtr, SAMPLE_APP_Data.TblHandles[3]);
+    if (status == CFE_TBL_INFO_UPDATED)
+    {
+        /* Curves were checked by the validation function, so every one is compiled */
+        for (Ch = 0; Ch < SAMPLE_APP_SENSOR_CHANNELS; ++Ch)
+        {
+            SAMPLE_APP_CalCompile(&TblPtr->Channel[Ch], &SAMPLE_APP_Data.CalLut.Channel[Ch]);
+        }
+    }
+
+    if (status == CFE_SUCCESS || status == CFE_TBL_INFO_UPDATED)
+    {
+        CFE_TBL_ReleaseAddress(SAMPLE_APP_Data.TblHandles[3]);
+    }
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Portable conversion, one sample at a time                       */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+void SAMPLE_APP_CalConvertScalar(const SAMPLE_APP_CalSegments_t *Lut, const int16 *Raw, float *Eng, uint32 Count)
+{
+    uint32 Offset;
+    uint32 Idx;
+    int32  Frac;
+    uint32 i;
+
+    for (i = 0; i < Count; ++i)
+    {
+        Offset = SAMPLE_APP_CAL_OFFSET(Raw[i]);
+        Idx    = Offset >> SAMPLE_APP_CAL_LUT_SHIFT;
+        Frac   = (int32)(Offset & SAMPLE_APP_CAL_FRAC_MASK);
+
+        if (Frac < Lut->Knot[Idx])
+        {
+            Eng[i] = Lut->Base[Idx] + (Lut->Slope[Idx] * (float)Frac);
+        }
+        else
+        {
+            Eng[i] = Lut->KnotBase[Idx] + (Lut->KnotSlope[Idx] * (float)(Frac - Lut->Knot[Idx]));
+        }
+    }
+}
+
+#if defined(__SSE2__)
+/*
+ * SSE2 has no gather, so the four entries are loaded one by one
+ */
+static inline __m128 SAMPLE_APP_CalLoad4(const float *Table, const uint32 *Idx)
+{
+    return _mm_setr_ps(Table[Idx[0]], Table[Idx[1]], Table[Idx[2]], Table[Idx[3]]);
+}
+#endif
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Conversion using the widest vectors the target was built for    */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+void SAMPLE_APP_CalConvert(const SAMPLE_APP_CalSegments_t *Lut, const int16 *Raw, float *Eng, uint32 Count)
+{
+    uint32 i = 0;
+
+    /*
+     * Flipping the sign bit turns a sample into its unsigned offset from
+     * INT16_MIN, which is split into a segment index and the counts into
+     * the segment.  Each lane then takes the line before or after its
+     * segment's knot, counting from the knot after it.  AVX2 gathers the
+     * entries of eight segments at once; SSE2 loads four one by one and
+     * does the rest of the work across the vector.  The multiply and add
+     * are kept apart to round as the scalar loop does.
+     */
+#if defined(__SSE2__)
+    {
+        const __m128i Flip = _mm_set1_epi16((short)0x8000);
+        const __m128i Mask = _mm_set1_epi32(SAMPLE_APP_CAL_FRAC_MASK);
+        const __m128i Zero = _mm_setzero_si128();
+        __m128i       Offset;
+        __m128i       Frac;
+        __m128i       Knot;
+        __m128i       Before;
+        __m128        Sel;
+        __m128        Base;
+        __m128        Slope;
+        uint32        Idx[4];
+
+#if defined(__AVX2__)
+        const __m256i Mask256 = _mm256_set1_epi32(SAMPLE_APP_CAL_FRAC_MASK);
+        __m256i       Offset256;
+        __m256i       Idx256;
+        __m256i       Frac256;
+        __m256i       Knot256;
+        __m256i       Before256;
+        __m256        Sel256;
+        __m256        Base256;
+        __m256        Slope256;
+
+        for (; (Count - i) >= 8; i += 8)
+        {
+            Offset256 = _mm256_cvtepu16_epi32(_mm_xor_si128(_mm_loadu_si128((const __m128i *)&Raw[i]), Flip));
+            Idx256    = _mm256_srli_epi32(Offset256, SAMPLE_APP_CAL_LUT_SHIFT);
+            Frac256   = _mm256_and_si256(Offset256, Mask256);
+            Knot256   = _mm256_i32gather_epi32((const int *)Lut->Knot, Idx256, sizeof(int32));
+            Before256 = _mm256_cmpgt_epi32(Knot256, Frac256);
+            Sel256    = _mm256_castsi256_ps(Before256);
+            Frac256   = _mm256_sub_epi32(Frac256, _mm256_andnot_si256(Before256, Knot256));
+            Base256   = _mm256_blendv_ps(_mm256_i32gather_ps(Lut->KnotBase, Idx256, sizeof(float)),
+                                         _mm256_i32gather_ps(Lut->Base, Idx256, sizeof(float)), Sel256);
+            Slope256  = _mm256_blendv_ps(_mm256_i32gather_ps(Lut->KnotSlope, Idx256, sizeof(float)),
+                                         _mm256_i32gather_ps(Lut->Slope, Idx256, sizeof(float)), Sel256);
+            _mm256_storeu_ps(&Eng[i], _mm256_add_ps(Base256, _mm256_mul_ps(Slope256, _mm256_cvtepi32_ps(Frac256))));
+        }
+#endif
+
+        for (; (Count - i) >= 4; i += 4)
+        {
+            Offset = _mm_unpacklo_epi16(_mm_xor_si128(_mm_loadl_epi64((const __m128i *)&Raw[i]), Flip), Zero);
+            Frac   = _mm_and_si128(Offset, Mask);
+            _mm_storeu_si128((__m128i *)Idx, _mm_srli_epi32(Offset, SAMPLE_APP_CAL_LUT_SHIFT));
+            Knot   = _mm_setr_epi32(Lut->Knot[Idx[0]], Lut->Knot[Idx[1]], Lut->Knot[Idx[2]], Lut->Knot[Idx[3]]);
+            Before = _mm_cmplt_epi32(Frac, Knot);
+            Sel    = _mm_castsi128_ps(Before);
+            Frac   = _mm_sub_epi32(Frac, _mm_andnot_si128(Before, Knot));
+            Base   = _mm_or_ps(_mm_and_ps(Sel, SAMPLE_APP_CalLoad4(Lut->Base, Idx)),
+                               _mm_andnot_ps(Sel, SAMPLE_APP_CalLoad4(Lut->KnotBase, Idx)));
+            Slope  = _mm_or_ps(_mm_and_ps(Sel, SAMPLE_APP_CalLoad4(Lut->Slope, Idx)),
+                               _mm_andnot_ps(Sel, SAMPLE_APP_CalLoad4(Lut->KnotSlope, Idx)));
+            _mm_storeu_ps(&Eng[i], _mm_add_ps(Base, _mm_mul_ps(Slope, _mm_cvtepi32_ps(Frac))));
+        }
+    }
+#endif
+
+    SAMPLE_APP_CalConvertScalar(Lut, &Raw[i], &Eng[i], Count - i);
+}
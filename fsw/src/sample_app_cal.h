@@ -0,0 +1,47 @@
+/************************************************************************
+ * NASA Docket No. GSC-18,719-1, and identified as “core Flight System: Bootes”
+ *
+ * Copyright (c) 2020 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/**
+ * @file
+ *   This file contains the prototypes for the Sample App sensor calibration functions
+ *
+ * Filtered sensor samples are converted from raw counts to engineering
+ * units by each channel's curve in the calibration table.  On each load
+ * the curves are tabulated into a lookup table over the whole int16
+ * range, so converting a sample is one indexed load of a segment's lines
+ * and one multiply-add, whatever the form of the curve.
+ * SAMPLE_APP_CalConvert() converts a block at a time using the widest
+ * vectors the target was built for; SAMPLE_APP_CalConvertScalar() is the
+ * portable reference it is tested against.
+ */
+
+#ifndef SAMPLE_APP_CAL_H
+#define SAMPLE_APP_CAL_H
+
+/*
+** Required header files.
+*/
+#include "sample_app.h"
+
+CFE_Status_t SAMPLE_APP_CalValidationFunc(void *TblData);
+void         SAMPLE_APP_UpdateCalibration(void);
+void         SAMPLE_APP_CalConvert(const SAMPLE_APP_CalSegments_t *Lut, const int16 *Raw, float *Eng, uint32 Count);
+void         SAMPLE_APP_CalConvertScalar(const SAMPLE_APP_CalSegments_t *Lut, const int16 *Raw, float *Eng,
+                                         uint32 Count);
+
+#endif /* SAMPLE_APP_CAL_H */
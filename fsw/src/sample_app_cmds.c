@@ -28,13 +28,126 @@
 #include "sample_app_cmds.h"
 #include "sample_app_msgids.h"
 #include "sample_app_eventids.h"
-#include "sample_app_version.h"
 #include "sample_app_tbl.h"
 #include "sample_app_utils.h"
+#include "sample_app_tblcopy.h"
+#include "sample_app_stats.h"
 #include "sample_app_msg.h"
+#include "sample_app_worker.h"
+#include "sample_app_pipes.h"
+#include "sample_app_admit.h"
+#include "sample_app_ratelimit.h"
+#include "sample_app_trace.h"
+#include "sample_app_coalesce.h"
+#include "sample_app_tlm.h"
+#include "sample_app_quantile.h"
+#include "sample_app_limit.h"
+#include "sample_app_cal.h"
 
-/* The sample_lib module provides the SAMPLE_Function() prototype */
-#include "sample_lib.h"
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+/*                                                                            */
+/* Whether any counter in the housekeeping payload differs from the last one  */
+/* sent.  Gauges that move on every request are not compared, nor is the      */
+/* scrub pass count, which the idle background scrub advances every few.     */
+/*                                                                            */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+static bool SAMPLE_APP_HkChanged(const SAMPLE_APP_HkTlm_Payload_t *Payload)
+{
+    const SAMPLE_APP_HkTlm_Payload_t *Last = &SAMPLE_APP_Data.HkLastSent;
+    uint32                            i;
+
+    if (Payload->CommandErrorCounter != Last->CommandErrorCounter || Payload->CommandCounter != Last->CommandCounter ||
+        Payload->PeakWakeupMsgCount != Last->PeakWakeupMsgCount ||
+        Payload->DrainLimitHitCount != Last->DrainLimitHitCount || Payload->ScrubErrorCount != Last->ScrubErrorCount ||
+        Payload->TraceLostCount != Last->TraceLostCount || Payload->TlmCopyCount != Last->TlmCopyCount)
+    {
+        return true;
+    }
+
+    for (i = 0; i < SAMPLE_APP_NUM_WORKERS; ++i)
+    {
+        if (Payload->Worker[i].CompletedCount != Last->Worker[i].CompletedCount ||
+            Payload->Worker[i].PeakQueueDepth != Last->Worker[i].PeakQueueDepth)
+        {
+            return true;
+        }
+    }
+
+    for (i = 0; i < SAMPLE_APP_NUM_PIPES; ++i)
+    {
+        if (Payload->PipeHighWatermark[i] != Last->PipeHighWatermark[i])
+        {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+/*                                                                            */
+/* Table management and other upkeep due on every housekeeping request,       */
+/* whichever telemetry products the request goes on to send                   */
+/*                                                                            */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+void SAMPLE_APP_PerformHousekeeping(void)
+{
+    int          i;
+    bool         Corrupted;
+    CFE_Status_t status;
+
+    /*
+    ** Scrub the next slice of the example table while it is still held...
+    */
+    Corrupted = SAMPLE_APP_ScrubExampleTable();
+
+    /*
+    ** Format a share of the trace records logged since the last request...
+    */
+    SAMPLE_APP_TraceFlush();
+
+    /*
+    ** Manage any pending table loads, validations, etc.
+    ** The example table is held between HK requests, so it is released
+    ** here to let a pending update go through and then re-acquired.
+    */
+    SAMPLE_APP_ReleaseExampleTable();
+
+    /*
+    ** A corrupted image is replaced from the default file, which
+    ** the table manage call below then makes active
+    */
+    if (Corrupted && SAMPLE_APP_SCRUB_RELOAD_ON_ERROR)
+    {
+        status = CFE_TBL_Load(SAMPLE_APP_Data.TblHandles[0], CFE_TBL_SRC_FILE, SAMPLE_APP_TABLE_FILE);
+        if (status != CFE_SUCCESS)
+        {
+            CFE_ES_WriteToSysLog("Sample App: Error Reloading Example Table, RC = 0x%08lX\n", (unsigned long)status);
+        }
+    }
+
+    for (i = 0; i < SAMPLE_APP_NUMBER_OF_TABLES; i++)
+    {
+        CFE_TBL_Manage(SAMPLE_APP_Data.TblHandles[i]);
+    }
+
+    SAMPLE_APP_AcquireExampleTable();
+    SAMPLE_APP_UpdateRateLimits();
+    SAMPLE_APP_UpdateLimits();
+    SAMPLE_APP_UpdateCalibration();
+
+    /*
+    ** Summarize any messages rejected by rate limits since the last request
+    */
+    SAMPLE_APP_ReportRateLimits();
+
+    /*
+    ** Summarize repeated error events whose window has closed, then
+    ** bring the ground up to date on limit points they hid
+    */
+    SAMPLE_APP_CoalesceFlush();
+    SAMPLE_APP_LimitFlush();
+}
 
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
 /*                                                                            */
@@ -46,28 +159,100 @@
 /* * * * * * * * * * * * * * * * * * * * * * * *  * * * * * * *  * *  * * * * */
 CFE_Status_t SAMPLE_APP_SendHkCmd(const SAMPLE_APP_SendHkCmd_t *Msg)
 {
-    int i;
+    SAMPLE_APP_TlmPacket_t Pkt;
+    SAMPLE_APP_HkTlm_t *   HkTlm;
+
+    /*
+    ** Build the housekeeping packet in place, starting from a clean payload...
+    */
+    HkTlm = SAMPLE_APP_TlmBegin(&Pkt, &SAMPLE_APP_Data.HkTlm.TelemetryHeader, sizeof(SAMPLE_APP_HkTlm_t));
+    memset(&HkTlm->Payload, 0, sizeof(HkTlm->Payload));
 
     /*
     ** Get command execution counters...
     */
-    SAMPLE_APP_Data.HkTlm.Payload.CommandErrorCounter = SAMPLE_APP_Data.ErrCounter;
-    SAMPLE_APP_Data.HkTlm.Payload.CommandCounter      = SAMPLE_APP_Data.CmdCounter;
+    HkTlm->Payload.CommandErrorCounter = SAMPLE_APP_Data.ErrCounter;
+    HkTlm->Payload.CommandCounter      = SAMPLE_APP_Data.CmdCounter;
+    HkTlm->Payload.LastWakeupMsgCount  = SAMPLE_APP_Data.LastWakeupMsgCount;
+    HkTlm->Payload.PeakWakeupMsgCount  = SAMPLE_APP_Data.PeakWakeupMsgCount;
+    HkTlm->Payload.DrainLimitHitCount  = SAMPLE_APP_Data.DrainLimitHitCount;
+    HkTlm->Payload.ScrubPassCount      = SAMPLE_APP_Data.ScrubPassCount;
+    HkTlm->Payload.ScrubErrorCount     = SAMPLE_APP_Data.ScrubErrorCount;
+    HkTlm->Payload.LastScrubTime       = SAMPLE_APP_Data.LastScrubTime;
+    HkTlm->Payload.TraceLostCount      = SAMPLE_APP_Data.Trace.LostCount;
+    HkTlm->Payload.TlmCopyCount        = SAMPLE_APP_Data.TlmCopyCount;
+    HkTlm->Payload.HkSuppressedCount   = SAMPLE_APP_Data.HkSuppressedCount;
+    SAMPLE_APP_UpdateWorkerStats(&HkTlm->Payload);
+    SAMPLE_APP_UpdatePipeStats(&HkTlm->Payload);
 
     /*
-    ** Send housekeeping telemetry packet...
+    ** Send housekeeping telemetry packet, unless in change-only mode
+    ** nothing has changed and the keep-alive is not yet due...
     */
-    CFE_SB_TimeStampMsg(CFE_MSG_PTR(SAMPLE_APP_Data.HkTlm.TelemetryHeader));
-    CFE_SB_TransmitMsg(CFE_MSG_PTR(SAMPLE_APP_Data.HkTlm.TelemetryHeader), true);
+    if (SAMPLE_APP_Data.HkChangeOnly && SAMPLE_APP_Data.HkSinceSent < SAMPLE_APP_HK_KEEPALIVE_COUNT - 1 &&
+        !SAMPLE_APP_HkChanged(&HkTlm->Payload))
+    {
+        SAMPLE_APP_Data.HkSinceSent++;
+        SAMPLE_APP_Data.HkSuppressedCount++;
+        SAMPLE_APP_TlmDiscard(&Pkt);
+    }
+    else
+    {
+        SAMPLE_APP_Data.HkSinceSent = 0;
+        SAMPLE_APP_Data.HkLastSent  = HkTlm->Payload;
+        SAMPLE_APP_TlmSend(&Pkt);
+    }
+
+    return CFE_SUCCESS;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+/*                                                                            */
+/* Send the dispatch statistics packet, on its telemetry schedule slot        */
+/*                                                                            */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+CFE_Status_t SAMPLE_APP_SendStatsTlm(const SAMPLE_APP_SendHkCmd_t *Msg)
+{
+    SAMPLE_APP_TlmPacket_t Pkt;
+    SAMPLE_APP_StatsTlm_t *StatsTlm;
 
     /*
-    ** Manage any pending table loads, validations, etc.
+    ** The histograms are accumulated in the app's copy of the packet, so
+    ** unless that copy is the fallback they are copied into the SB buffer.
+    ** This is one whole-payload copy per send, as a send by copy would make.
     */
-    for (i = 0; i < SAMPLE_APP_NUMBER_OF_TABLES; i++)
+    StatsTlm = SAMPLE_APP_TlmBegin(&Pkt, &SAMPLE_APP_Data.StatsTlm.TelemetryHeader, sizeof(SAMPLE_APP_StatsTlm_t));
+    if (StatsTlm != &SAMPLE_APP_Data.StatsTlm)
     {
-        CFE_TBL_Manage(SAMPLE_APP_Data.TblHandles[i]);
+        memcpy(&StatsTlm->Payload, &SAMPLE_APP_Data.StatsTlm.Payload, sizeof(StatsTlm->Payload));
+    }
+
+    SAMPLE_APP_TlmSend(&Pkt);
+
+    return CFE_SUCCESS;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+/*                                                                            */
+/* Send the admission control packet, on its telemetry schedule slot          */
+/*                                                                            */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+CFE_Status_t SAMPLE_APP_SendAdmitTlm(const SAMPLE_APP_SendHkCmd_t *Msg)
+{
+    SAMPLE_APP_TlmPacket_t Pkt;
+    SAMPLE_APP_AdmitTlm_t *AdmitTlm;
+
+    SAMPLE_APP_UpdateAdmitStats();
+
+    /* As for the statistics, the counters live in the app's copy of the packet and are copied once per send */
+    AdmitTlm = SAMPLE_APP_TlmBegin(&Pkt, &SAMPLE_APP_Data.AdmitTlm.TelemetryHeader, sizeof(SAMPLE_APP_AdmitTlm_t));
+    if (AdmitTlm != &SAMPLE_APP_Data.AdmitTlm)
+    {
+        memcpy(&AdmitTlm->Payload, &SAMPLE_APP_Data.AdmitTlm.Payload, sizeof(AdmitTlm->Payload));
     }
 
+    SAMPLE_APP_TlmSend(&Pkt);
+
     return CFE_SUCCESS;
 }
 
@@ -80,8 +265,7 @@ CFE_Status_t SAMPLE_APP_NoopCmd(const SAMPLE_APP_NoopCmd_t *Msg)
 {
     SAMPLE_APP_Data.CmdCounter++;
 
-    CFE_EVS_SendEvent(SAMPLE_APP_NOOP_INF_EID, CFE_EVS_EventType_INFORMATION, "SAMPLE: NOOP command %s",
-                      SAMPLE_APP_VERSION);
+    SAMPLE_APP_Trace(SAMPLE_APP_NOOP_INF_EID, NULL, 0);
 
     return CFE_SUCCESS;
 }
@@ -95,10 +279,24 @@ CFE_Status_t SAMPLE_APP_NoopCmd(const SAMPLE_APP_NoopCmd_t *Msg)
 /* * * * * * * * * * * * * * * * * * * * * * * *  * * * * * * *  * *  * * * * */
 CFE_Status_t SAMPLE_APP_ResetCountersCmd(const SAMPLE_APP_ResetCountersCmd_t *Msg)
 {
-    SAMPLE_APP_Data.CmdCounter = 0;
-    SAMPLE_APP_Data.ErrCounter = 0;
+    int i;
 
-    CFE_EVS_SendEvent(SAMPLE_APP_RESET_INF_EID, CFE_EVS_EventType_INFORMATION, "SAMPLE: RESET command");
+    SAMPLE_APP_Data.CmdCounter         = 0;
+    SAMPLE_APP_Data.ErrCounter         = 0;
+    SAMPLE_APP_Data.PeakWakeupMsgCount = 0;
+    SAMPLE_APP_Data.DrainLimitHitCount = 0;
+    SAMPLE_APP_Data.ScrubPassCount     = 0;
+    SAMPLE_APP_Data.ScrubErrorCount    = 0;
+    SAMPLE_APP_Data.Trace.LostCount    = 0;
+    SAMPLE_APP_Data.TlmCopyCount       = 0;
+    SAMPLE_APP_Data.HkSuppressedCount  = 0;
+
+    for (i = 0; i < SAMPLE_APP_NUM_PIPES; i++)
+    {
+        SAMPLE_APP_Data.Pipe[i].HighWatermark = 0;
+    }
+
+    SAMPLE_APP_Trace(SAMPLE_APP_RESET_INF_EID, NULL, 0);
 
     return CFE_SUCCESS;
 }
@@ -111,35 +309,19 @@ CFE_Status_t SAMPLE_APP_ResetCountersCmd(const SAMPLE_APP_ResetCountersCmd_t *Ms
 /* * * * * * * * * * * * * * * * * * * * * * * *  * * * * * * *  * *  * * * * */
 CFE_Status_t SAMPLE_APP_ProcessCmd(const SAMPLE_APP_ProcessCmd_t *Msg)
 {
-    CFE_Status_t               Status;
-    void *                     TblAddr;
-    SAMPLE_APP_ExampleTable_t *TblPtr;
-    const char *               TableName = "SAMPLE_APP.ExampleTable";
+    CFE_Status_t Status;
 
-    /* Sample Use of Example Table */
-    SAMPLE_APP_Data.CmdCounter++;
-    Status = CFE_TBL_GetAddress(&TblAddr, SAMPLE_APP_Data.TblHandles[0]);
-    if (Status < CFE_SUCCESS)
+    /* The processing runs on a worker task, so the main task is free for other commands */
+    Status = SAMPLE_APP_WorkerSubmit(Msg);
+    if (Status == CFE_SUCCESS)
     {
-        CFE_ES_WriteToSysLog("Sample App: Fail to get table address: 0x%08lx", (unsigned long)Status);
+        SAMPLE_APP_Data.CmdCounter++;
     }
     else
     {
-        TblPtr = TblAddr;
-        CFE_ES_WriteToSysLog("Sample App: Example Table Value 1: %d  Value 2: %d", TblPtr->Int1, TblPtr->Int2);
-
-        SAMPLE_APP_GetCrc(TableName);
-
-        Status = CFE_TBL_ReleaseAddress(SAMPLE_APP_Data.TblHandles[0]);
-        if (Status != CFE_SUCCESS)
-        {
-            CFE_ES_WriteToSysLog("Sample App: Fail to release table address: 0x%08lx", (unsigned long)Status);
-        }
-        else
-        {
-            /* Invoke a function provided by SAMPLE_APP_LIB */
-            SAMPLE_LIB_Function();
-        }
+        SAMPLE_APP_Data.ErrCounter++;
+        CFE_EVS_SendEvent(SAMPLE_APP_WORKER_FULL_ERR_EID, CFE_EVS_EventType_ERROR,
+                          "Sample App: All worker queues full, PROCESS command rejected");
     }
 
     return Status;
@@ -153,9 +335,63 @@ CFE_Status_t SAMPLE_APP_ProcessCmd(const SAMPLE_APP_ProcessCmd_t *Msg)
 CFE_Status_t SAMPLE_APP_DisplayParamCmd(const SAMPLE_APP_DisplayParamCmd_t *Msg)
 {
     SAMPLE_APP_Data.CmdCounter++;
-    CFE_EVS_SendEvent(SAMPLE_APP_VALUE_INF_EID, CFE_EVS_EventType_INFORMATION,
-                      "SAMPLE_APP: ValU32=%lu, ValI16=%d, ValStr=%s", (unsigned long)Msg->Payload.ValU32,
-                      (int)Msg->Payload.ValI16, Msg->Payload.ValStr);
+    SAMPLE_APP_Trace(SAMPLE_APP_VALUE_INF_EID, &Msg->Payload, sizeof(Msg->Payload));
+
+    return CFE_SUCCESS;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+/*                                                                            */
+/*  Purpose:                                                                  */
+/*         This function clears the dispatch latency, admission control and   */
+/*         sensor quantile statistics.                                        */
+/*                                                                            */
+/* * * * * * * * * * * * * * * * * * * * * * * *  * * * * * * *  * *  * * * * */
+CFE_Status_t SAMPLE_APP_ResetStatsCmd(const SAMPLE_APP_ResetStatsCmd_t *Msg)
+{
+    SAMPLE_APP_Data.CmdCounter++;
+
+    SAMPLE_APP_ResetDispatchStats();
+    SAMPLE_APP_ResetAdmitStats();
+    SAMPLE_APP_QuantileReset();
+
+    CFE_EVS_SendEvent(SAMPLE_APP_RESET_STATS_INF_EID, CFE_EVS_EventType_INFORMATION, "SAMPLE: RESET STATS command");
+
+    return CFE_SUCCESS;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+/*                                                                            */
+/*  Purpose:                                                                  */
+/*         This function reports the example table record with the given key, */
+/*         found through the record index of the published table copy.        */
+/*                                                                            */
+/* * * * * * * * * * * * * * * * * * * * * * * *  * * * * * * *  * *  * * * * */
+CFE_Status_t SAMPLE_APP_LookupRecordCmd(const SAMPLE_APP_LookupRecordCmd_t *Msg)
+{
+    const SAMPLE_APP_TableCopy_t *    Copy;
+    const SAMPLE_APP_ExampleRecord_t *Record = NULL;
+    uint32                            Token;
+
+    /* Copies are only written by this task, so the one returned cannot change while it is read here */
+    Copy = SAMPLE_APP_TableCopyBegin(&Token);
+    if (Copy != NULL)
+    {
+        Record = SAMPLE_APP_FindRecord(Copy, Msg->Payload.Key);
+    }
+
+    if (Record == NULL)
+    {
+        SAMPLE_APP_Data.ErrCounter++;
+        CFE_EVS_SendEvent(SAMPLE_APP_LOOKUP_ERR_EID, CFE_EVS_EventType_ERROR,
+                          "Sample App: No example table record with key %u", (unsigned int)Msg->Payload.Key);
+        return SAMPLE_APP_RECORD_NOT_FOUND_ERR_CODE;
+    }
+
+    SAMPLE_APP_Data.CmdCounter++;
+    CFE_EVS_SendEvent(SAMPLE_APP_LOOKUP_INF_EID, CFE_EVS_EventType_INFORMATION,
+                      "SAMPLE: Example table record key %u, value %lu", (unsigned int)Record->Key,
+                      (unsigned long)Record->Value);
 
     return CFE_SUCCESS;
 }
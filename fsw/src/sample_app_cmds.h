@@ -30,10 +30,15 @@
 #include "cfe_error.h"
 #include "sample_app_msg.h"
 
+void         SAMPLE_APP_PerformHousekeeping(void);
 CFE_Status_t SAMPLE_APP_SendHkCmd(const SAMPLE_APP_SendHkCmd_t *Msg);
+CFE_Status_t SAMPLE_APP_SendStatsTlm(const SAMPLE_APP_SendHkCmd_t *Msg);
+CFE_Status_t SAMPLE_APP_SendAdmitTlm(const SAMPLE_APP_SendHkCmd_t *Msg);
 CFE_Status_t SAMPLE_APP_ResetCountersCmd(const SAMPLE_APP_ResetCountersCmd_t *Msg);
 CFE_Status_t SAMPLE_APP_ProcessCmd(const SAMPLE_APP_ProcessCmd_t *Msg);
 CFE_Status_t SAMPLE_APP_NoopCmd(const SAMPLE_APP_NoopCmd_t *Msg);
 CFE_Status_t SAMPLE_APP_DisplayParamCmd(const SAMPLE_APP_DisplayParamCmd_t *Msg);
+CFE_Status_t SAMPLE_APP_ResetStatsCmd(const SAMPLE_APP_ResetStatsCmd_t *Msg);
+CFE_Status_t SAMPLE_APP_LookupRecordCmd(const SAMPLE_APP_LookupRecordCmd_t *Msg);
 
 #endif /* SAMPLE_APP_CMDS_H */
@@ -0,0 +1,215 @@
+/************************************************************************
+ * NASA Docket No. GSC-18,719-1, and identified as “core Flight System: Bootes”
+ *
+ * Copyright (c) 2020 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/**
+ * \file
+ *   This file contains the source code for the Sample App event coalescing functions
+ */
+
+/*
+** Include Files:
+*/
+#include "sample_app.h"
+#include "sample_app_coalesce.h"
+#include "sample_app_eventids.h"
+
+#define SAMPLE_APP_COALESCE_MASK (SAMPLE_APP_COALESCE_SLOTS - 1)
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Home slot of an (EID, MID, CC) key                              */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+static uint32 SAMPLE_APP_CoalesceHash(uint16 EventID, uint32 MsgId, uint16 FcnCode)
+{
+    uint32 Hash;
+
+    Hash = (MsgId * 0x9E3779B1) ^ ((uint32)EventID << 16) ^ FcnCode;
+    Hash ^= Hash >> 15;
+
+    return Hash & SAMPLE_APP_COALESCE_MASK;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Milliseconds from Start to Now.  A Now before Start, as for a   */
+/* command replayed with its original receive time, is no time.    */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+static uint64 SAMPLE_APP_CoalesceElapsed(CFE_TIME_SysTime_t Now, CFE_TIME_SysTime_t Start)
+{
+    CFE_TIME_SysTime_t Elapsed;
+
+    if (CFE_TIME_Compare(Now, Start) == CFE_TIME_A_LT_B)
+    {
+        return 0;
+    }
+
+    Elapsed = CFE_TIME_Subtract(Now, Start);
+
+    return ((uint64)Elapsed.Seconds * 1000) + (CFE_TIME_Sub2MicroSecs(Elapsed.Subseconds) / 1000);
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Send the summary of the repeats absorbed by an entry            */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+static void SAMPLE_APP_CoalesceReport(SAMPLE_APP_CoalesceEntry_t *Entry)
+{
+    if (Entry->Repeats != 0)
+    {
+        CFE_EVS_SendEvent(SAMPLE_APP_REPEAT_ERR_EID, CFE_EVS_EventType_ERROR,
+                          "Sample App: Event %u repeated %lu more times, MID = 0x%X, CC = %u",
+                          (unsigned int)Entry->EventID, (unsigned long)Entry->Repeats, (unsigned int)Entry->MsgId,
+                          (unsigned int)Entry->FcnCode);
+
+        Entry->Repeats = 0;
+    }
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Decide whether an error event for a message should be sent.     */
+/* Returns false if it repeats one sent within the window, which   */
+/* is then counted for the summary instead.                        */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+bool SAMPLE_APP_CoalesceEvent(uint16 EventID, const SAMPLE_APP_MsgContext_t *MsgCtx)
+{
+    SAMPLE_APP_CoalesceEntry_t *Entry;
+    uint32                      MsgId = CFE_SB_MsgIdToValue(MsgCtx->MsgId);
+    uint32                      Slot;
+    uint32                      i;
+
+    /* Linear probe from the home slot to the key or the first free slot */
+    Slot = SAMPLE_APP_CoalesceHash(EventID, MsgId, MsgCtx->FcnCode);
+    for (i = 0; i < SAMPLE_APP_COALESCE_SLOTS; ++i)
+    {
+        Entry = &SAMPLE_APP_Data.Coalesce[(Slot + i) & SAMPLE_APP_COALESCE_MASK];
+
+        if (Entry->EventID == SAMPLE_APP_RESERVED_EID)
+        {
+            Entry->EventID     = EventID;
+            Entry->FcnCode     = MsgCtx->FcnCode;
+            Entry->MsgId       = MsgId;
+            Entry->Repeats     = 0;
+            Entry->WindowStart = MsgCtx->RcvTime;
+            return true;
+        }
+
+        if (Entry->EventID == EventID && Entry->MsgId == MsgId && Entry->FcnCode == MsgCtx->FcnCode)
+        {
+            if (SAMPLE_APP_CoalesceElapsed(MsgCtx->RcvTime, Entry->WindowStart) < SAMPLE_APP_COALESCE_WINDOW)
+            {
+                ++Entry->Repeats;
+                return false;
+            }
+
+            /* The window has closed, so report it and start a new one with this event */
+            SAMPLE_APP_CoalesceReport(Entry);
+            Entry->WindowStart = MsgCtx->RcvTime;
+            return true;
+        }
+    }
+
+    /* Too many distinct errors to track, so send rather than lose it */
+    return true;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Whether an error event for a message is within the window of    */
+/* one already sent.  Nothing is counted.                          */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+bool SAMPLE_APP_CoalesceOpen(uint16 EventID, const SAMPLE_APP_MsgContext_t *MsgCtx)
+{
+    const SAMPLE_APP_CoalesceEntry_t *Entry;
+    uint32                            MsgId = CFE_SB_MsgIdToValue(MsgCtx->MsgId);
+    uint32                            Slot;
+    uint32                            i;
+
+    Slot = SAMPLE_APP_CoalesceHash(EventID, MsgId, MsgCtx->FcnCode);
+    for (i = 0; i < SAMPLE_APP_COALESCE_SLOTS; ++i)
+    {
+        Entry = &SAMPLE_APP_Data.Coalesce[(Slot + i) & SAMPLE_APP_COALESCE_MASK];
+
+        if (Entry->EventID == SAMPLE_APP_RESERVED_EID)
+        {
+            break;
+        }
+
+        if (Entry->EventID == EventID && Entry->MsgId == MsgId && Entry->FcnCode == MsgCtx->FcnCode)
+        {
+            return SAMPLE_APP_CoalesceElapsed(MsgCtx->RcvTime, Entry->WindowStart) < SAMPLE_APP_COALESCE_WINDOW;
+        }
+    }
+
+    return false;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Report and free entries whose window has closed                 */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+void SAMPLE_APP_CoalesceFlush(void)
+{
+    SAMPLE_APP_CoalesceEntry_t  Live[SAMPLE_APP_COALESCE_SLOTS];
+    SAMPLE_APP_CoalesceEntry_t *Entry;
+    CFE_TIME_SysTime_t          Now;
+    uint32                      LiveCount = 0;
+    uint32                      Slot;
+    uint32                      i;
+
+    Now = CFE_TIME_GetTime();
+
+    for (i = 0; i < SAMPLE_APP_COALESCE_SLOTS; ++i)
+    {
+        Entry = &SAMPLE_APP_Data.Coalesce[i];
+        if (Entry->EventID == SAMPLE_APP_RESERVED_EID)
+        {
+            continue;
+        }
+
+        if (SAMPLE_APP_CoalesceElapsed(Now, Entry->WindowStart) < SAMPLE_APP_COALESCE_WINDOW)
+        {
+            Live[LiveCount++] = *Entry;
+        }
+        else
+        {
+            SAMPLE_APP_CoalesceReport(Entry);
+        }
+    }
+
+    /*
+     * Removing entries would break the probe chains of those after them,
+     * so the table is rebuilt from the entries still in their window
+     */
+    memset(SAMPLE_APP_Data.Coalesce, 0, sizeof(SAMPLE_APP_Data.Coalesce));
+    for (i = 0; i < LiveCount; ++i)
+    {
+        Slot = SAMPLE_APP_CoalesceHash(Live[i].EventID, Live[i].MsgId, Live[i].FcnCode);
+        while (SAMPLE_APP_Data.Coalesce[Slot].EventID != SAMPLE_APP_RESERVED_EID)
+        {
+            Slot = (Slot + 1) & SAMPLE_APP_COALESCE_MASK;
+        }
+        SAMPLE_APP_Data.Coalesce[Slot] = Live[i];
+    }
+}
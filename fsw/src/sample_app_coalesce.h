@@ -0,0 +1,40 @@
+/************************************************************************
+ * NASA Docket No. GSC-18,719-1, and identified as “core Flight System: Bootes”
+ *
+ * Copyright (c) 2020 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/**
+ * @file
+ *   This file contains the prototypes for the Sample App event coalescing functions
+ *
+ * Repeats of an error event for the same MID and command code within
+ * SAMPLE_APP_COALESCE_WINDOW are counted instead of sent, and reported
+ * as one summary event when the window closes.
+ */
+
+#ifndef SAMPLE_APP_COALESCE_H
+#define SAMPLE_APP_COALESCE_H
+
+/*
+** Required header files.
+*/
+#include "sample_app.h"
+
+bool SAMPLE_APP_CoalesceEvent(uint16 EventID, const SAMPLE_APP_MsgContext_t *MsgCtx);
+bool SAMPLE_APP_CoalesceOpen(uint16 EventID, const SAMPLE_APP_MsgContext_t *MsgCtx);
+void SAMPLE_APP_CoalesceFlush(void);
+
+#endif /* SAMPLE_APP_COALESCE_H */
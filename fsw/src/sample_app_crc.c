@@ -0,0 +1,174 @@
+/************************************************************************
+ * NASA Docket No. GSC-18,719-1, and identified as “core Flight System: Bootes”
+ *
+ * Copyright (c) 2020 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/**
+ * \file
+ *   This file contains the source code for the Sample App CRC functions
+ */
+
+/*
+** Include Files:
+*/
+#include "sample_app_crc.h"
+
+#include <string.h>
+
+#if defined(__SSE4_2__)
+#include <nmmintrin.h>
+#elif defined(__ARM_FEATURE_CRC32)
+#include <arm_acle.h>
+#endif
+
+/*
+** Reflected generator polynomial
+*/
+#define SAMPLE_APP_CRC32C_POLY 0x82F63B78
+
+/*
+** Slicing-by-8 lookup table, filled in by SAMPLE_APP_CrcInit
+*/
+static uint32 SAMPLE_APP_Crc32cTable[8][256];
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Build the slicing-by-8 tables for one polynomial                */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+static void SAMPLE_APP_CrcBuildTable(uint32 Table[8][256], uint32 Poly)
+{
+    uint32 i;
+    uint32 k;
+    uint32 Crc;
+
+    for (i = 0; i < 256; ++i)
+    {
+        Crc = i;
+        for (k = 0; k < 8; ++k)
+        {
+            Crc = (Crc & 1) ? ((Crc >> 1) ^ Poly) : (Crc >> 1);
+        }
+        Table[0][i] = Crc;
+    }
+
+    /* Table[k][i] is the CRC of byte i followed by k zero bytes */
+    for (i = 0; i < 256; ++i)
+    {
+        for (k = 1; k < 8; ++k)
+        {
+            Table[k][i] = (Table[k - 1][i] >> 8) ^ Table[0][Table[k - 1][i] & 0xFF];
+        }
+    }
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Slicing-by-8 update of a raw (not inverted) CRC                 */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+static uint32 SAMPLE_APP_CrcSlice8(uint32 Table[8][256], uint32 Crc, const uint8 *Ptr, size_t Len)
+{
+    uint32 Lo;
+    uint32 Hi;
+
+    while (Len >= 8)
+    {
+        /* Assemble bytes explicitly so the result does not depend on host byte order */
+        Lo = Crc ^ ((uint32)Ptr[0] | ((uint32)Ptr[1] << 8) | ((uint32)Ptr[2] << 16) | ((uint32)Ptr[3] << 24));
+        Hi = (uint32)Ptr[4] | ((uint32)Ptr[5] << 8) | ((uint32)Ptr[6] << 16) | ((uint32)Ptr[7] << 24);
+
+        Crc = Table[7][Lo & 0xFF] ^ Table[6][(Lo >> 8) & 0xFF] ^ Table[5][(Lo >> 16) & 0xFF] ^ Table[4][Lo >> 24] ^
+              Table[3][Hi & 0xFF] ^ Table[2][(Hi >> 8) & 0xFF] ^ Table[1][(Hi >> 16) & 0xFF] ^ Table[0][Hi >> 24];
+
+        Ptr += 8;
+        Len -= 8;
+    }
+
+    while (Len > 0)
+    {
+        Crc = (Crc >> 8) ^ Table[0][(Crc ^ *Ptr) & 0xFF];
+        ++Ptr;
+        --Len;
+    }
+
+    return Crc;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Build the CRC lookup table, called once during app init         */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+void SAMPLE_APP_CrcInit(void)
+{
+    SAMPLE_APP_CrcBuildTable(SAMPLE_APP_Crc32cTable, SAMPLE_APP_CRC32C_POLY);
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Castagnoli CRC-32C, table driven                                */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+uint32 SAMPLE_APP_Crc32cSoftware(uint32 Crc, const void *Data, size_t Len)
+{
+    return ~SAMPLE_APP_CrcSlice8(SAMPLE_APP_Crc32cTable, ~Crc, Data, Len);
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Castagnoli CRC-32C, using CPU instructions where built for them */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+uint32 SAMPLE_APP_Crc32c(uint32 Crc, const void *Data, size_t Len)
+{
+#if defined(__SSE4_2__) || defined(__ARM_FEATURE_CRC32)
+    const uint8 *Ptr = Data;
+    uint64       Word;
+
+    Crc = ~Crc;
+
+    /* The instructions are defined on little-endian words, as both targets are */
+    while (Len >= 8)
+    {
+        memcpy(&Word, Ptr, sizeof(Word));
+#if defined(__SSE4_2__) && defined(__x86_64__)
+        Crc = (uint32)_mm_crc32_u64(Crc, Word);
+#elif defined(__SSE4_2__)
+        Crc = _mm_crc32_u32(_mm_crc32_u32(Crc, (uint32)Word), (uint32)(Word >> 32));
+#else
+        Crc = __crc32cd(Crc, Word);
+#endif
+        Ptr += 8;
+        Len -= 8;
+    }
+
+    while (Len > 0)
+    {
+#if defined(__SSE4_2__)
+        Crc = _mm_crc32_u8(Crc, *Ptr);
+#else
+        Crc = __crc32cb(Crc, *Ptr);
+#endif
+        ++Ptr;
+        --Len;
+    }
+
+    return ~Crc;
+#else
+    return SAMPLE_APP_Crc32cSoftware(Crc, Data, Len);
+#endif
+}
@@ -0,0 +1,42 @@
+/************************************************************************
+ * NASA Docket No. GSC-18,719-1, and identified as “core Flight System: Bootes”
+ *
+ * Copyright (c) 2020 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/**
+ * @file
+ *   This file contains the prototypes for the Sample App CRC functions
+ *
+ * All functions take the CRC of the data so far (0 to start) and return
+ * the CRC including the new data, so a large buffer can be checked in
+ * pieces.  SAMPLE_APP_Crc32c() is the Castagnoli CRC-32C, which uses
+ * the CPU CRC instructions when the target is built with them, and
+ * SAMPLE_APP_Crc32cSoftware() the table driven reference for it.
+ */
+
+#ifndef SAMPLE_APP_CRC_H
+#define SAMPLE_APP_CRC_H
+
+/*
+** Required header files.
+*/
+#include "common_types.h"
+
+void   SAMPLE_APP_CrcInit(void);
+uint32 SAMPLE_APP_Crc32c(uint32 Crc, const void *Data, size_t Len);
+uint32 SAMPLE_APP_Crc32cSoftware(uint32 Crc, const void *Data, size_t Len);
+
+#endif /* SAMPLE_APP_CRC_H */
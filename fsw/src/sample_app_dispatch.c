@@ -27,36 +27,100 @@
 #include "sample_app.h"
 #include "sample_app_dispatch.h"
 #include "sample_app_cmds.h"
+#include "sample_app_tlmsched.h"
+#include "sample_app_sensor.h"
+#include "sample_app_admit.h"
+#include "sample_app_coalesce.h"
+#include "sample_app_ratelimit.h"
+#include "sample_app_limit.h"
 #include "sample_app_eventids.h"
 #include "sample_app_msgids.h"
 #include "sample_app_msg.h"
 
+/*
+ * All command handlers take a pointer to their own command type, so the
+ * table stores a thin wrapper for each that takes the received buffer.
+ */
+typedef CFE_Status_t (*SAMPLE_APP_CmdHandler_t)(const CFE_SB_Buffer_t *SBBufPtr);
+
+typedef struct
+{
+    size_t                  ExpectedLength; /**< Exact size of the command message */
+    SAMPLE_APP_CmdHandler_t Handler;        /**< NULL for an unused command code */
+} SAMPLE_APP_CmdDispatchEntry_t;
+
+static CFE_Status_t SAMPLE_APP_NoopCmdBuf(const CFE_SB_Buffer_t *SBBufPtr)
+{
+    return SAMPLE_APP_NoopCmd((const SAMPLE_APP_NoopCmd_t *)SBBufPtr);
+}
+
+static CFE_Status_t SAMPLE_APP_ResetCountersCmdBuf(const CFE_SB_Buffer_t *SBBufPtr)
+{
+    return SAMPLE_APP_ResetCountersCmd((const SAMPLE_APP_ResetCountersCmd_t *)SBBufPtr);
+}
+
+static CFE_Status_t SAMPLE_APP_ProcessCmdBuf(const CFE_SB_Buffer_t *SBBufPtr)
+{
+    return SAMPLE_APP_ProcessCmd((const SAMPLE_APP_ProcessCmd_t *)SBBufPtr);
+}
+
+static CFE_Status_t SAMPLE_APP_DisplayParamCmdBuf(const CFE_SB_Buffer_t *SBBufPtr)
+{
+    return SAMPLE_APP_DisplayParamCmd((const SAMPLE_APP_DisplayParamCmd_t *)SBBufPtr);
+}
+
+static CFE_Status_t SAMPLE_APP_ResetStatsCmdBuf(const CFE_SB_Buffer_t *SBBufPtr)
+{
+    return SAMPLE_APP_ResetStatsCmd((const SAMPLE_APP_ResetStatsCmd_t *)SBBufPtr);
+}
+
+static CFE_Status_t SAMPLE_APP_LookupRecordCmdBuf(const CFE_SB_Buffer_t *SBBufPtr)
+{
+    return SAMPLE_APP_LookupRecordCmd((const SAMPLE_APP_LookupRecordCmd_t *)SBBufPtr);
+}
+
+/* Build one dispatch table row from a handler, its command type and its buffer wrapper */
+#define SAMPLE_APP_CMD_ENTRY(HandlerFunc) {sizeof(HandlerFunc##_t), HandlerFunc##Buf}
+
+/*
+ * Define a lookup table for SAMPLE app command codes, indexed by command code.
+ * Adding a command is one entry here; codes without an entry are rejected.
+ * Sizing it by the admission limit makes a code the admission and rate limit
+ * counters cannot track fail to build.
+ */
+static const SAMPLE_APP_CmdDispatchEntry_t SAMPLE_APP_CMD_DISPATCH_TABLE[SAMPLE_APP_ADMIT_MAX_CC] = {
+    [SAMPLE_APP_NOOP_CC]           = SAMPLE_APP_CMD_ENTRY(SAMPLE_APP_NoopCmd),
+    [SAMPLE_APP_RESET_COUNTERS_CC] = SAMPLE_APP_CMD_ENTRY(SAMPLE_APP_ResetCountersCmd),
+    [SAMPLE_APP_PROCESS_CC]        = SAMPLE_APP_CMD_ENTRY(SAMPLE_APP_ProcessCmd),
+    [SAMPLE_APP_DISPLAY_PARAM_CC]  = SAMPLE_APP_CMD_ENTRY(SAMPLE_APP_DisplayParamCmd),
+    [SAMPLE_APP_RESET_STATS_CC]    = SAMPLE_APP_CMD_ENTRY(SAMPLE_APP_ResetStatsCmd),
+    [SAMPLE_APP_LOOKUP_RECORD_CC]  = SAMPLE_APP_CMD_ENTRY(SAMPLE_APP_LookupRecordCmd),
+};
+
+#define SAMPLE_APP_CMD_DISPATCH_TABLE_SIZE \
+    (sizeof(SAMPLE_APP_CMD_DISPATCH_TABLE) / sizeof(SAMPLE_APP_CMD_DISPATCH_TABLE[0]))
+
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
 /*                                                                            */
 /* Verify command packet length                                               */
 /*                                                                            */
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
-bool SAMPLE_APP_VerifyCmdLength(const CFE_MSG_Message_t *MsgPtr, size_t ExpectedLength)
+bool SAMPLE_APP_VerifyCmdLength(const SAMPLE_APP_MsgContext_t *MsgCtx, size_t ExpectedLength)
 {
-    bool              result       = true;
-    size_t            ActualLength = 0;
-    CFE_SB_MsgId_t    MsgId        = CFE_SB_INVALID_MSG_ID;
-    CFE_MSG_FcnCode_t FcnCode      = 0;
-
-    CFE_MSG_GetSize(MsgPtr, &ActualLength);
+    bool result = true;
 
     /*
     ** Verify the command packet length.
     */
-    if (ExpectedLength != ActualLength)
+    if (ExpectedLength != MsgCtx->MsgSize)
     {
-        CFE_MSG_GetMsgId(MsgPtr, &MsgId);
-        CFE_MSG_GetFcnCode(MsgPtr, &FcnCode);
-
-        CFE_EVS_SendEvent(SAMPLE_APP_CMD_LEN_ERR_EID, CFE_EVS_EventType_ERROR,
-                          "Invalid Msg length: ID = 0x%X,  CC = %u, Len = %u, Expected = %u",
-                          (unsigned int)CFE_SB_MsgIdToValue(MsgId), (unsigned int)FcnCode, (unsigned int)ActualLength,
-                          (unsigned int)ExpectedLength);
+        if (SAMPLE_APP_CoalesceEvent(SAMPLE_APP_CMD_LEN_ERR_EID, MsgCtx))
+        {
+            CFE_EVS_SendEvent(SAMPLE_APP_CMD_LEN_ERR_EID, CFE_EVS_EventType_ERROR,
+                              "Invalid Msg length: ID = 0x%X,  CC = %u, Len = %u, Expected = %u",
+                              (unsigned int)CFE_SB_MsgIdToValue(MsgCtx->MsgId), (unsigned int)MsgCtx->FcnCode,
+                              (unsigned int)MsgCtx->MsgSize, (unsigned int)ExpectedLength);
+        }
 
         result = false;
 
@@ -71,50 +135,29 @@ bool SAMPLE_APP_VerifyCmdLength(const CFE_MSG_Message_t *MsgPtr, size_t Expected
 /* SAMPLE ground commands                                                     */
 /*                                                                            */
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
-void SAMPLE_APP_ProcessGroundCommand(const CFE_SB_Buffer_t *SBBufPtr)
+void SAMPLE_APP_ProcessGroundCommand(const CFE_SB_Buffer_t *SBBufPtr, const SAMPLE_APP_MsgContext_t *MsgCtx)
 {
-    CFE_MSG_FcnCode_t CommandCode = 0;
-
-    CFE_MSG_GetFcnCode(&SBBufPtr->Msg, &CommandCode);
+    const SAMPLE_APP_CmdDispatchEntry_t *Entry = NULL;
 
     /*
     ** Process SAMPLE app ground commands
     */
-    switch (CommandCode)
+    if (MsgCtx->FcnCode < SAMPLE_APP_CMD_DISPATCH_TABLE_SIZE)
     {
-        case SAMPLE_APP_NOOP_CC:
-            if (SAMPLE_APP_VerifyCmdLength(&SBBufPtr->Msg, sizeof(SAMPLE_APP_NoopCmd_t)))
-            {
-                SAMPLE_APP_NoopCmd((const SAMPLE_APP_NoopCmd_t *)SBBufPtr);
-            }
-            break;
-
-        case SAMPLE_APP_RESET_COUNTERS_CC:
-            if (SAMPLE_APP_VerifyCmdLength(&SBBufPtr->Msg, sizeof(SAMPLE_APP_ResetCountersCmd_t)))
-            {
-                SAMPLE_APP_ResetCountersCmd((const SAMPLE_APP_ResetCountersCmd_t *)SBBufPtr);
-            }
-            break;
-
-        case SAMPLE_APP_PROCESS_CC:
-            if (SAMPLE_APP_VerifyCmdLength(&SBBufPtr->Msg, sizeof(SAMPLE_APP_ProcessCmd_t)))
-            {
-                SAMPLE_APP_ProcessCmd((const SAMPLE_APP_ProcessCmd_t *)SBBufPtr);
-            }
-            break;
-
-        case SAMPLE_APP_DISPLAY_PARAM_CC:
-            if (SAMPLE_APP_VerifyCmdLength(&SBBufPtr->Msg, sizeof(SAMPLE_APP_DisplayParamCmd_t)))
-            {
-                SAMPLE_APP_DisplayParamCmd((const SAMPLE_APP_DisplayParamCmd_t *)SBBufPtr);
-            }
-            break;
+        Entry = &SAMPLE_APP_CMD_DISPATCH_TABLE[MsgCtx->FcnCode];
+    }
 
-        /* default case already found during FC vs length test */
-        default:
-            CFE_EVS_SendEvent(SAMPLE_APP_CC_ERR_EID, CFE_EVS_EventType_ERROR, "Invalid ground command code: CC = %d",
-                              CommandCode);
-            break;
+    if (Entry != NULL && Entry->Handler != NULL)
+    {
+        if (SAMPLE_APP_VerifyCmdLength(MsgCtx, Entry->ExpectedLength))
+        {
+            Entry->Handler(SBBufPtr);
+        }
+    }
+    else if (SAMPLE_APP_CoalesceEvent(SAMPLE_APP_CC_ERR_EID, MsgCtx))
+    {
+        CFE_EVS_SendEvent(SAMPLE_APP_CC_ERR_EID, CFE_EVS_EventType_ERROR, "Invalid ground command code: CC = %d",
+                          MsgCtx->FcnCode);
     }
 }
 
@@ -125,25 +168,50 @@ void SAMPLE_APP_ProcessGroundCommand(const CFE_SB_Buffer_t *SBBufPtr)
 /*     command pipe.                                                          */
 /*                                                                            */
 /* * * * * * * * * * * * * * * * * * * * * * * *  * * * * * * *  * *  * * * * */
-void SAMPLE_APP_TaskPipe(const CFE_SB_Buffer_t *SBBufPtr)
+void SAMPLE_APP_TaskPipe(const CFE_SB_Buffer_t *SBBufPtr, const SAMPLE_APP_MsgContext_t *MsgCtx)
 {
-    CFE_SB_MsgId_t MsgId = CFE_SB_INVALID_MSG_ID;
+    /* Limit checked telemetry is consumed here, it is not a command */
+    if (SAMPLE_APP_LimitCheckPacket(SBBufPtr, MsgCtx))
+    {
+        return;
+    }
+
+    /* Messages over their configured rate are dropped before any other handling */
+    if (!SAMPLE_APP_RateLimitCheck(MsgCtx))
+    {
+        return;
+    }
 
-    CFE_MSG_GetMsgId(&SBBufPtr->Msg, &MsgId);
+    /* Under load, low priority commands are deferred or shed here */
+    if (!SAMPLE_APP_AdmitCommand(SBBufPtr, MsgCtx))
+    {
+        return;
+    }
 
-    switch (CFE_SB_MsgIdToValue(MsgId))
+    switch (CFE_SB_MsgIdToValue(MsgCtx->MsgId))
     {
         case SAMPLE_APP_CMD_MID:
-            SAMPLE_APP_ProcessGroundCommand(SBBufPtr);
+            SAMPLE_APP_ProcessGroundCommand(SBBufPtr, MsgCtx);
+            break;
+
+        case SAMPLE_APP_SENSOR_DATA_MID:
+            if (SAMPLE_APP_VerifyCmdLength(MsgCtx, sizeof(SAMPLE_APP_SensorDataCmd_t)))
+            {
+                SAMPLE_APP_SensorDataCmd((const SAMPLE_APP_SensorDataCmd_t *)SBBufPtr);
+            }
             break;
 
         case SAMPLE_APP_SEND_HK_MID:
-            SAMPLE_APP_SendHkCmd((const SAMPLE_APP_SendHkCmd_t *)SBBufPtr);
+            SAMPLE_APP_TlmScheduleCmd((const SAMPLE_APP_SendHkCmd_t *)SBBufPtr);
             break;
 
         default:
-            CFE_EVS_SendEvent(SAMPLE_APP_MID_ERR_EID, CFE_EVS_EventType_ERROR,
-                              "SAMPLE: invalid command packet,MID = 0x%x", (unsigned int)CFE_SB_MsgIdToValue(MsgId));
+            if (SAMPLE_APP_CoalesceEvent(SAMPLE_APP_MID_ERR_EID, MsgCtx))
+            {
+                CFE_EVS_SendEvent(SAMPLE_APP_MID_ERR_EID, CFE_EVS_EventType_ERROR,
+                                  "SAMPLE: invalid command packet,MID = 0x%x",
+                                  (unsigned int)CFE_SB_MsgIdToValue(MsgCtx->MsgId));
+            }
             break;
     }
 }
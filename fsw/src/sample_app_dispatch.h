@@ -29,10 +29,11 @@
 ** Required header files.
 */
 #include "cfe.h"
+#include "sample_app.h"
 #include "sample_app_msg.h"
 
-void SAMPLE_APP_TaskPipe(const CFE_SB_Buffer_t *SBBufPtr);
-void SAMPLE_APP_ProcessGroundCommand(const CFE_SB_Buffer_t *SBBufPtr);
-bool SAMPLE_APP_VerifyCmdLength(const CFE_MSG_Message_t *MsgPtr, size_t ExpectedLength);
+void SAMPLE_APP_TaskPipe(const CFE_SB_Buffer_t *SBBufPtr, const SAMPLE_APP_MsgContext_t *MsgCtx);
+void SAMPLE_APP_ProcessGroundCommand(const CFE_SB_Buffer_t *SBBufPtr, const SAMPLE_APP_MsgContext_t *MsgCtx);
+bool SAMPLE_APP_VerifyCmdLength(const SAMPLE_APP_MsgContext_t *MsgCtx, size_t ExpectedLength);
 
 #endif /* SAMPLE_APP_DISPATCH_H */
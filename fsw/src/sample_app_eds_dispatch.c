@@ -27,6 +27,12 @@
 #include "sample_app.h"
 #include "sample_app_dispatch.h"
 #include "sample_app_cmds.h"
+#include "sample_app_tlmsched.h"
+#include "sample_app_sensor.h"
+#include "sample_app_admit.h"
+#include "sample_app_coalesce.h"
+#include "sample_app_ratelimit.h"
+#include "sample_app_limit.h"
 #include "sample_app_eventids.h"
 #include "sample_app_msgids.h"
 #include "sample_app_msg.h"
@@ -38,11 +44,14 @@
  * Define a lookup table for SAMPLE app command codes
  */
 static const EdsDispatchTable_SAMPLE_APP_Application_CFE_SB_Telecommand_t SAMPLE_TC_DISPATCH_TABLE = {
-    .CMD     = {.NoopCmd_indication          = SAMPLE_APP_NoopCmd,
+    .CMD         = {.NoopCmd_indication          = SAMPLE_APP_NoopCmd,
             .ResetCountersCmd_indication = SAMPLE_APP_ResetCountersCmd,
             .ProcessCmd_indication       = SAMPLE_APP_ProcessCmd,
-            .DisplayParamCmd_indication  = SAMPLE_APP_DisplayParamCmd},
-    .SEND_HK = {.indication = SAMPLE_APP_SendHkCmd}};
+            .DisplayParamCmd_indication  = SAMPLE_APP_DisplayParamCmd,
+            .ResetStatsCmd_indication    = SAMPLE_APP_ResetStatsCmd,
+            .LookupRecordCmd_indication  = SAMPLE_APP_LookupRecordCmd},
+    .SENSOR_DATA = {.indication = SAMPLE_APP_SensorDataCmd},
+    .SEND_HK     = {.indication = SAMPLE_APP_TlmScheduleCmd}};
 
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
 /*                                                                            */
@@ -51,37 +60,69 @@ static const EdsDispatchTable_SAMPLE_APP_Application_CFE_SB_Telecommand_t SAMPLE
 /*     command pipe.                                                          */
 /*                                                                            */
 /* * * * * * * * * * * * * * * * * * * * * * * *  * * * * * * *  * *  * * * * */
-void SAMPLE_APP_TaskPipe(const CFE_SB_Buffer_t *SBBufPtr)
+void SAMPLE_APP_TaskPipe(const CFE_SB_Buffer_t *SBBufPtr, const SAMPLE_APP_MsgContext_t *MsgCtx)
 {
-    CFE_Status_t      Status;
-    CFE_SB_MsgId_t    MsgId;
-    CFE_MSG_Size_t    MsgSize;
-    CFE_MSG_FcnCode_t MsgFc;
+    /* Limit checked telemetry is consumed here, it is not a command */
+    if (SAMPLE_APP_LimitCheckPacket(SBBufPtr, MsgCtx))
+    {
+        return;
+    }
+
+    /* Messages over their configured rate are dropped before any other handling */
+    if (!SAMPLE_APP_RateLimitCheck(MsgCtx))
+    {
+        return;
+    }
+
+    /* Under load, low priority commands are deferred or shed here */
+    if (!SAMPLE_APP_AdmitCommand(SBBufPtr, MsgCtx))
+    {
+        return;
+    }
+
+    SAMPLE_APP_ProcessGroundCommand(SBBufPtr, MsgCtx);
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+/*                                                                            */
+/*  Purpose:                                                                  */
+/*     Hand a message that passed the pipe checks to the generated EDS        */
+/*     dispatcher, which routes it by MID and command code.                   */
+/*                                                                            */
+/* * * * * * * * * * * * * * * * * * * * * * * *  * * * * * * *  * *  * * * * */
+void SAMPLE_APP_ProcessGroundCommand(const CFE_SB_Buffer_t *SBBufPtr, const SAMPLE_APP_MsgContext_t *MsgCtx)
+{
+    CFE_Status_t Status;
 
     Status = EdsDispatch_SAMPLE_APP_Application_Telecommand(SBBufPtr, &SAMPLE_TC_DISPATCH_TABLE);
 
     if (Status != CFE_SUCCESS)
     {
-        CFE_MSG_GetMsgId(&SBBufPtr->Msg, &MsgId);
-        CFE_MSG_GetSize(&SBBufPtr->Msg, &MsgSize);
-        CFE_MSG_GetFcnCode(&SBBufPtr->Msg, &MsgFc);
         ++SAMPLE_APP_Data.ErrCounter;
 
         if (Status == CFE_STATUS_UNKNOWN_MSG_ID)
         {
-            CFE_EVS_SendEvent(SAMPLE_APP_MID_ERR_EID, CFE_EVS_EventType_ERROR,
-                              "SAMPLE: invalid command packet,MID = 0x%x", (unsigned int)CFE_SB_MsgIdToValue(MsgId));
+            if (SAMPLE_APP_CoalesceEvent(SAMPLE_APP_MID_ERR_EID, MsgCtx))
+            {
+                CFE_EVS_SendEvent(SAMPLE_APP_MID_ERR_EID, CFE_EVS_EventType_ERROR,
+                                  "SAMPLE: invalid command packet,MID = 0x%x",
+                                  (unsigned int)CFE_SB_MsgIdToValue(MsgCtx->MsgId));
+            }
         }
         else if (Status == CFE_STATUS_WRONG_MSG_LENGTH)
         {
-            CFE_EVS_SendEvent(SAMPLE_APP_CMD_LEN_ERR_EID, CFE_EVS_EventType_ERROR,
-                              "Invalid Msg length: ID = 0x%X,  CC = %u, Len = %u",
-                              (unsigned int)CFE_SB_MsgIdToValue(MsgId), (unsigned int)MsgFc, (unsigned int)MsgSize);
+            if (SAMPLE_APP_CoalesceEvent(SAMPLE_APP_CMD_LEN_ERR_EID, MsgCtx))
+            {
+                CFE_EVS_SendEvent(SAMPLE_APP_CMD_LEN_ERR_EID, CFE_EVS_EventType_ERROR,
+                                  "Invalid Msg length: ID = 0x%X,  CC = %u, Len = %u",
+                                  (unsigned int)CFE_SB_MsgIdToValue(MsgCtx->MsgId), (unsigned int)MsgCtx->FcnCode,
+                                  (unsigned int)MsgCtx->MsgSize);
+            }
         }
-        else
+        else if (SAMPLE_APP_CoalesceEvent(SAMPLE_APP_CC_ERR_EID, MsgCtx))
         {
             CFE_EVS_SendEvent(SAMPLE_APP_CC_ERR_EID, CFE_EVS_EventType_ERROR,
-                              "SAMPLE: Invalid ground command code: CC = %d", (int)MsgFc);
+                              "SAMPLE: Invalid ground command code: CC = %d", (int)MsgCtx->FcnCode);
         }
     }
 }
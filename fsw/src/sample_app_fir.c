@@ -0,0 +1,161 @@
+/************************************************************************
+ * NASA Docket No. GSC-18,719-1, and identified as “core Flight System: Bootes”
+ *
+ * Copyright (c) 2020 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/**
+ * \file
+ *   This file contains the source code for the Sample App FIR filter kernels
+ */
+
+/*
+** Include Files:
+*/
+#include "sample_app_fir.h"
+
+#if defined(__SSE2__)
+#include <immintrin.h>
+#endif
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Round a Q15 sum of products and saturate it to int16            */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+static inline int16 SAMPLE_APP_FirRound(int32 Sum)
+{
+    Sum = (Sum + (SAMPLE_APP_FIR_UNITY_GAIN / 2)) >> 15;
+
+    if (Sum > INT16_MAX)
+    {
+        Sum = INT16_MAX;
+    }
+    else if (Sum < INT16_MIN)
+    {
+        Sum = INT16_MIN;
+    }
+
+    return (int16)Sum;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Portable filter, one product at a time                          */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+void SAMPLE_APP_FirFilterS16Scalar(const int16 *In, int16 *Out, uint32 Count, const int16 *Taps, uint32 NumTaps)
+{
+    int32  Sum;
+    uint32 i;
+    uint32 j;
+
+    for (i = 0; i < Count; ++i)
+    {
+        Sum = 0;
+        for (j = 0; j < NumTaps; ++j)
+        {
+            Sum += (int32)Taps[j] * In[i + j];
+        }
+
+        Out[i] = SAMPLE_APP_FirRound(Sum);
+    }
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Sum of products of one output, using the widest vectors the     */
+/* target was built for                                            */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+static inline int32 SAMPLE_APP_FirDot(const int16 *In, const int16 *Taps, uint32 NumTaps)
+{
+    int32  Sum = 0;
+    uint32 j   = 0;
+
+    /*
+     * madd multiplies 16 bit pairs and adds adjacent products into
+     * 32 bit lanes, which are summed across at the end.  Taps past the
+     * last whole vector are left for the scalar loop.
+     */
+#if defined(__SSE2__)
+    {
+        __m128i Acc = _mm_setzero_si128();
+
+#if defined(__AVX2__)
+        __m256i Acc256 = _mm256_setzero_si256();
+
+        for (; (NumTaps - j) >= 16; j += 16)
+        {
+            Acc256 = _mm256_add_epi32(Acc256, _mm256_madd_epi16(_mm256_loadu_si256((const __m256i *)&In[j]),
+                                                                 _mm256_loadu_si256((const __m256i *)&Taps[j])));
+        }
+
+        Acc = _mm_add_epi32(_mm256_castsi256_si128(Acc256), _mm256_extracti128_si256(Acc256, 1));
+#endif
+
+        for (; (NumTaps - j) >= 8; j += 8)
+        {
+            Acc = _mm_add_epi32(Acc, _mm_madd_epi16(_mm_loadu_si128((const __m128i *)&In[j]),
+                                                    _mm_loadu_si128((const __m128i *)&Taps[j])));
+        }
+
+        Acc = _mm_add_epi32(Acc, _mm_shuffle_epi32(Acc, _MM_SHUFFLE(1, 0, 3, 2)));
+        Acc = _mm_add_epi32(Acc, _mm_shuffle_epi32(Acc, _MM_SHUFFLE(2, 3, 0, 1)));
+        Sum = _mm_cvtsi128_si32(Acc);
+    }
+#endif
+
+    for (; j < NumTaps; ++j)
+    {
+        Sum += (int32)Taps[j] * In[j];
+    }
+
+    return Sum;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Filter using the widest vectors the target was built for        */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+void SAMPLE_APP_FirFilterS16(const int16 *In, int16 *Out, uint32 Count, const int16 *Taps, uint32 NumTaps)
+{
+    uint32 i;
+
+    for (i = 0; i < Count; ++i)
+    {
+        Out[i] = SAMPLE_APP_FirRound(SAMPLE_APP_FirDot(&In[i], Taps, NumTaps));
+    }
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Sum of the magnitudes of the taps, for checking against         */
+/* SAMPLE_APP_FIR_UNITY_GAIN                                       */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+uint32 SAMPLE_APP_FirGain(const int16 *Taps, uint32 NumTaps)
+{
+    uint32 Gain = 0;
+    uint32 j;
+
+    for (j = 0; j < NumTaps; ++j)
+    {
+        Gain += (Taps[j] < 0) ? (uint32)(-(int32)Taps[j]) : (uint32)Taps[j];
+    }
+
+    return Gain;
+}
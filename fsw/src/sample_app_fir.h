@@ -0,0 +1,48 @@
+/************************************************************************
+ * NASA Docket No. GSC-18,719-1, and identified as “core Flight System: Bootes”
+ *
+ * Copyright (c) 2020 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/**
+ * @file
+ *   This file contains the prototypes for the Sample App FIR filter kernels
+ *
+ * Both filter functions compute Count outputs from NumTaps - 1 + Count
+ * inputs, as Out[n] = (sum of Taps[j] * In[n + j] for j < NumTaps) in Q15,
+ * rounded and saturated to int16.  Taps are therefore in reverse time
+ * order, Taps[NumTaps - 1] applying to the newest input of each output.
+ *
+ * The sum of the magnitudes of the taps must not exceed
+ * SAMPLE_APP_FIR_UNITY_GAIN, which keeps every sum within int32.
+ * SAMPLE_APP_FirFilterS16() uses SSE2 or AVX2 when the target is built
+ * with them and always gives the same answer as the scalar reference.
+ */
+
+#ifndef SAMPLE_APP_FIR_H
+#define SAMPLE_APP_FIR_H
+
+/*
+** Required header files.
+*/
+#include "common_types.h"
+
+#define SAMPLE_APP_FIR_UNITY_GAIN 32768 /* 1.0 in Q15 */
+
+void   SAMPLE_APP_FirFilterS16(const int16 *In, int16 *Out, uint32 Count, const int16 *Taps, uint32 NumTaps);
+void   SAMPLE_APP_FirFilterS16Scalar(const int16 *In, int16 *Out, uint32 Count, const int16 *Taps, uint32 NumTaps);
+uint32 SAMPLE_APP_FirGain(const int16 *Taps, uint32 NumTaps);
+
+#endif /* SAMPLE_APP_FIR_H */
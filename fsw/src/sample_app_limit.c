@@ -0,0 +1,569 @@
+/************************************************************************
+ * NASA Docket No. GSC-18,719-1, and identified as “core Flight System: Bootes”
+ *
+ * Copyright (c) 2020 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/**
+ * \file
+ *   This file contains the source code for the Sample App telemetry limit check functions
+ */
+
+/*
+** Include Files:
+*/
+#include "sample_app.h"
+#include "sample_app_coalesce.h"
+#include "sample_app_eventids.h"
+#include "sample_app_msgids.h"
+#include "sample_app_limit.h"
+
+#if defined(__SSE2__)
+#include <immintrin.h>
+#endif
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Size of a point of the given type, 0 if the type is unknown     */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+static uint32 SAMPLE_APP_LimitTypeSize(uint16 Type)
+{
+    switch (Type)
+    {
+        case SAMPLE_APP_LIMIT_TYPE_UINT8:
+            return sizeof(uint8);
+
+        case SAMPLE_APP_LIMIT_TYPE_UINT16:
+            return sizeof(uint16);
+
+        case SAMPLE_APP_LIMIT_TYPE_INT16:
+            return sizeof(int16);
+
+        case SAMPLE_APP_LIMIT_TYPE_INT32:
+            return sizeof(int32);
+
+        default:
+            return 0;
+    }
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Whether a message ID is one the app already subscribes to       */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+static bool SAMPLE_APP_LimitOwnMid(CFE_SB_MsgId_Atom_t MsgId)
+{
+    switch (MsgId)
+    {
+        case SAMPLE_APP_CMD_MID:
+        case SAMPLE_APP_SEND_HK_MID:
+        case SAMPLE_APP_SENSOR_DATA_MID:
+            return true;
+
+        default:
+            return false;
+    }
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Verify contents of the Limit Table buffer                       */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+CFE_Status_t SAMPLE_APP_LimitValidationFunc(void *TblData)
+{
+    SAMPLE_APP_LimitTable_t *      TblDataPtr = (SAMPLE_APP_LimitTable_t *)TblData;
+    const SAMPLE_APP_LimitEntry_t *Entry;
+    uint32                         Size;
+    uint32                         i;
+
+    for (i = 0; i < SAMPLE_APP_LIMIT_MAX_ENTRIES; ++i)
+    {
+        Entry = &TblDataPtr->Entry[i];
+        if (Entry->MsgId == 0)
+        {
+            continue;
+        }
+
+        /* Points lie in the payload of telemetry the app does not otherwise receive */
+        Size = SAMPLE_APP_LimitTypeSize(Entry->Type);
+        if (Size == 0 || SAMPLE_APP_LimitOwnMid(Entry->MsgId) || Entry->Offset < sizeof(CFE_MSG_TelemetryHeader_t) ||
+            (Entry->Offset + Size) > CFE_MISSION_SB_MAX_SB_MSG_SIZE)
+        {
+            return SAMPLE_APP_TABLE_OUT_OF_RANGE_ERR_CODE;
+        }
+
+        if (Entry->RedLow > Entry->YellowLow || Entry->YellowLow > Entry->YellowHigh ||
+            Entry->YellowHigh > Entry->RedHigh)
+        {
+            return SAMPLE_APP_TABLE_OUT_OF_RANGE_ERR_CODE;
+        }
+    }
+
+    return CFE_SUCCESS;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Subscribe to, or unsubscribe from, each limit checked MID       */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+static void SAMPLE_APP_LimitSubscribe(bool Subscribe)
+{
+    const SAMPLE_APP_LimitSet_t *Set    = &SAMPLE_APP_Data.Limit;
+    CFE_SB_PipeId_t              PipeId = SAMPLE_APP_Data.Pipe[SAMPLE_APP_NUM_PIPES - 1].PipeId;
+    CFE_Status_t                 status;
+    uint32                       g;
+
+    /* Groups are ordered by MID, so each MID starts a new run */
+    for (g = 0; g < Set->NumGroups; ++g)
+    {
+        if (g > 0 && Set->Group[g].MsgId == Set->Group[g - 1].MsgId)
+        {
+            continue;
+        }
+
+        if (!Subscribe)
+        {
+            CFE_SB_Unsubscribe(CFE_SB_ValueToMsgId(Set->Group[g].MsgId), PipeId);
+            continue;
+        }
+
+        status = CFE_SB_SubscribeEx(CFE_SB_ValueToMsgId(Set->Group[g].MsgId), PipeId, CFE_SB_DEFAULT_QOS,
+                                    SAMPLE_APP_LIMIT_MSG_LIM);
+        if (status != CFE_SUCCESS)
+        {
+            CFE_EVS_SendEvent(SAMPLE_APP_SUB_CMD_ERR_EID, CFE_EVS_EventType_ERROR,
+                              "Sample App: Error Subscribing to limit checked MID 0x%lX, RC = 0x%08lX",
+                              (unsigned long)Set->Group[g].MsgId, (unsigned long)status);
+        }
+    }
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Whether a limit table entry sorts before another, by MID then   */
+/* by type                                                         */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+static bool SAMPLE_APP_LimitBefore(const SAMPLE_APP_LimitEntry_t *Entry, const SAMPLE_APP_LimitEntry_t *Other)
+{
+    return Entry->MsgId < Other->MsgId || (Entry->MsgId == Other->MsgId && Entry->Type < Other->Type);
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Compile the used limit table entries into columns and groups,   */
+/* with every point starting within limits                         */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+static void SAMPLE_APP_LimitCompile(const SAMPLE_APP_LimitTable_t *TblPtr)
+{
+    SAMPLE_APP_LimitSet_t *        Set   = &SAMPLE_APP_Data.Limit;
+    SAMPLE_APP_LimitGroup_t *      Group = NULL;
+    const SAMPLE_APP_LimitEntry_t *Entry;
+    uint32                         NumCols = 0;
+    uint32                         End;
+    uint32                         i;
+    uint32                         j;
+
+    memset(Set, 0, sizeof(*Set));
+
+    /* Insertion sort of the used entries, keeping table order within a group */
+    for (i = 0; i < SAMPLE_APP_LIMIT_MAX_ENTRIES; ++i)
+    {
+        Entry = &TblPtr->Entry[i];
+        if (Entry->MsgId == 0)
+        {
+            continue;
+        }
+
+        for (j = NumCols; j > 0 && SAMPLE_APP_LimitBefore(Entry, &TblPtr->Entry[Set->EntryIdx[j - 1]]); --j)
+        {
+            Set->EntryIdx[j] = Set->EntryIdx[j - 1];
+        }
+
+        Set->EntryIdx[j] = i;
+        ++NumCols;
+    }
+
+    for (i = 0; i < NumCols; ++i)
+    {
+        Entry = &TblPtr->Entry[Set->EntryIdx[i]];
+
+        if (Group == NULL || Group->MsgId != Entry->MsgId || Group->Type != Entry->Type)
+        {
+            Group        = &Set->Group[Set->NumGroups];
+            Group->MsgId = Entry->MsgId;
+            Group->Type  = Entry->Type;
+            Group->First = i;
+            ++Set->NumGroups;
+        }
+
+        ++Group->Count;
+
+        End = Entry->Offset + SAMPLE_APP_LimitTypeSize(Entry->Type);
+        if (End > Group->MinSize)
+        {
+            Group->MinSize = End;
+        }
+
+        Set->Offset[i]     = Entry->Offset;
+        Set->RedLow[i]     = Entry->RedLow;
+        Set->YellowLow[i]  = Entry->YellowLow;
+        Set->YellowHigh[i] = Entry->YellowHigh;
+        Set->RedHigh[i]    = Entry->RedHigh;
+    }
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Recompile the limit points after a limit table update           */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+void SAMPLE_APP_UpdateLimits(void)
+{
+    CFE_Status_t             status;
+    SAMPLE_APP_LimitTable_t *TblPtr;
+
+    status = CFE_TBL_GetAddress((void *)&TblPtr, SAMPLE_APP_Data.TblHandles[2]);
+    if (status == CFE_TBL_INFO_UPDATED)
+    {
+        /* Entries were checked by the validation function, so every used one is compiled */
+        SAMPLE_APP_LimitSubscribe(false);
+        SAMPLE_APP_LimitCompile(TblPtr);
+        SAMPLE_APP_LimitSubscribe(true);
+    }
+
+    if (status == CFE_SUCCESS || status == CFE_TBL_INFO_UPDATED)
+    {
+        CFE_TBL_ReleaseAddress(SAMPLE_APP_Data.TblHandles[2]);
+    }
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* State of one point, one comparison at a time                    */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+static inline uint8 SAMPLE_APP_LimitState(const SAMPLE_APP_LimitSet_t *Set, uint32 Col, int32 Value)
+{
+    uint8 State = 0;
+
+    if (Value < Set->YellowLow[Col])
+    {
+        State |= SAMPLE_APP_LIMIT_YELLOW_LOW;
+    }
+    if (Value < Set->RedLow[Col])
+    {
+        State |= SAMPLE_APP_LIMIT_RED_LOW;
+    }
+    if (Value > Set->YellowHigh[Col])
+    {
+        State |= SAMPLE_APP_LIMIT_YELLOW_HIGH;
+    }
+    if (Value > Set->RedHigh[Col])
+    {
+        State |= SAMPLE_APP_LIMIT_RED_HIGH;
+    }
+
+    return State;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Portable check of Count values against the limits of the        */
+/* columns from First                                              */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+void SAMPLE_APP_LimitEvalScalar(const SAMPLE_APP_LimitSet_t *Set, uint32 First, uint32 Count, const int32 *Value,
+                                uint8 *State)
+{
+    uint32 i;
+
+    for (i = 0; i < Count; ++i)
+    {
+        State[i] = SAMPLE_APP_LimitState(Set, First + i, Value[i]);
+    }
+}
+
+#if defined(__SSE2__)
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* States of four points, one limit column per comparison          */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+static inline __m128i SAMPLE_APP_LimitState4(const SAMPLE_APP_LimitSet_t *Set, uint32 Col, const int32 *Value)
+{
+    __m128i V = _mm_loadu_si128((const __m128i *)Value);
+    __m128i State;
+
+    State = _mm_and_si128(_mm_cmplt_epi32(V, _mm_loadu_si128((const __m128i *)&Set->YellowLow[Col])),
+                          _mm_set1_epi32(SAMPLE_APP_LIMIT_YELLOW_LOW));
+    State = _mm_or_si128(State, _mm_and_si128(_mm_cmplt_epi32(V, _mm_loadu_si128((const __m128i *)&Set->RedLow[Col])),
+                                              _mm_set1_epi32(SAMPLE_APP_LIMIT_RED_LOW)));
+    State = _mm_or_si128(State,
+                         _mm_and_si128(_mm_cmpgt_epi32(V, _mm_loadu_si128((const __m128i *)&Set->YellowHigh[Col])),
+                                       _mm_set1_epi32(SAMPLE_APP_LIMIT_YELLOW_HIGH)));
+    State = _mm_or_si128(State, _mm_and_si128(_mm_cmpgt_epi32(V, _mm_loadu_si128((const __m128i *)&Set->RedHigh[Col])),
+                                              _mm_set1_epi32(SAMPLE_APP_LIMIT_RED_HIGH)));
+
+    return State;
+}
+#endif
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Check Count values against the limits of the columns from       */
+/* First, eight at a time when the target has SSE2                 */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+void SAMPLE_APP_LimitEval(const SAMPLE_APP_LimitSet_t *Set, uint32 First, uint32 Count, const int32 *Value,
+                          uint8 *State)
+{
+    uint32 i = 0;
+
+#if defined(__SSE2__)
+    {
+        __m128i Packed;
+
+        /* Every state is below 16, so the saturating packs down to bytes are exact */
+        for (; (Count - i) >= 8; i += 8)
+        {
+            Packed = _mm_packs_epi32(SAMPLE_APP_LimitState4(Set, First + i, &Value[i]),
+                                     SAMPLE_APP_LimitState4(Set, First + i + 4, &Value[i + 4]));
+            _mm_storel_epi64((__m128i *)&State[i], _mm_packus_epi16(Packed, Packed));
+        }
+    }
+#endif
+
+    for (; i < Count; ++i)
+    {
+        State[i] = SAMPLE_APP_LimitState(Set, First + i, Value[i]);
+    }
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Gather the values of a group's points from a packet             */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+static void SAMPLE_APP_LimitGather(const uint8 *Packet, const SAMPLE_APP_LimitGroup_t *Group, int32 *Value)
+{
+    const uint16 *Offset = &SAMPLE_APP_Data.Limit.Offset[Group->First];
+    uint16        U16;
+    int16         S16;
+    uint32        i;
+
+    /* Points may sit at any alignment, so multi-byte values are copied out */
+    switch (Group->Type)
+    {
+        case SAMPLE_APP_LIMIT_TYPE_UINT8:
+            for (i = 0; i < Group->Count; ++i)
+            {
+                Value[i] = Packet[Offset[i]];
+            }
+            break;
+
+        case SAMPLE_APP_LIMIT_TYPE_UINT16:
+            for (i = 0; i < Group->Count; ++i)
+            {
+                memcpy(&U16, &Packet[Offset[i]], sizeof(U16));
+                Value[i] = U16;
+            }
+            break;
+
+        case SAMPLE_APP_LIMIT_TYPE_INT16:
+            for (i = 0; i < Group->Count; ++i)
+            {
+                memcpy(&S16, &Packet[Offset[i]], sizeof(S16));
+                Value[i] = S16;
+            }
+            break;
+
+        default:
+            for (i = 0; i < Group->Count; ++i)
+            {
+                memcpy(&Value[i], &Packet[Offset[i]], sizeof(Value[i]));
+            }
+            break;
+    }
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Name of the most severe limit in a state                        */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+static const char *SAMPLE_APP_LimitStateName(uint8 State)
+{
+    if (State & SAMPLE_APP_LIMIT_RED_LOW)
+    {
+        return "red low";
+    }
+    if (State & SAMPLE_APP_LIMIT_RED_HIGH)
+    {
+        return "red high";
+    }
+    if (State & SAMPLE_APP_LIMIT_YELLOW_LOW)
+    {
+        return "yellow low";
+    }
+    if (State & SAMPLE_APP_LIMIT_YELLOW_HIGH)
+    {
+        return "yellow high";
+    }
+
+    return "within limits";
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Send a point's current state and the value that put it there    */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+static void SAMPLE_APP_LimitReport(uint32 Col, CFE_SB_MsgId_Atom_t MsgId)
+{
+    SAMPLE_APP_LimitSet_t *Set = &SAMPLE_APP_Data.Limit;
+
+    Set->Reported[Col] = Set->State[Col];
+
+    CFE_EVS_SendEvent(SAMPLE_APP_LIMIT_ERR_EID,
+                      (Set->State[Col] == 0) ? CFE_EVS_EventType_INFORMATION : CFE_EVS_EventType_ERROR,
+                      "Sample App: Limit point %u, MID 0x%lX offset %u, now %s, value = %ld",
+                      (unsigned int)Set->EntryIdx[Col], (unsigned long)MsgId, (unsigned int)Set->Offset[Col],
+                      SAMPLE_APP_LimitStateName(Set->State[Col]), (long)Set->Value[Col]);
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Record a point's new state and report the transition            */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+static void SAMPLE_APP_LimitTransition(uint32 Col, uint8 State, int32 Value, const SAMPLE_APP_MsgContext_t *MsgCtx)
+{
+    SAMPLE_APP_LimitSet_t * Set      = &SAMPLE_APP_Data.Limit;
+    SAMPLE_APP_MsgContext_t PointCtx = *MsgCtx;
+
+    Set->State[Col] = State;
+    Set->Value[Col] = Value;
+
+    /* Coalesced per point, with its table entry in place of the command code */
+    PointCtx.FcnCode = Set->EntryIdx[Col];
+    if (SAMPLE_APP_CoalesceEvent(SAMPLE_APP_LIMIT_ERR_EID, &PointCtx))
+    {
+        SAMPLE_APP_LimitReport(Col, CFE_SB_MsgIdToValue(MsgCtx->MsgId));
+    }
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Report the current state of each point whose last transition    */
+/* was coalesced, once its window has closed                       */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+void SAMPLE_APP_LimitFlush(void)
+{
+    const SAMPLE_APP_LimitSet_t *  Set = &SAMPLE_APP_Data.Limit;
+    const SAMPLE_APP_LimitGroup_t *Group;
+    SAMPLE_APP_MsgContext_t        PointCtx;
+    uint32                         Col;
+    uint32                         g;
+
+    memset(&PointCtx, 0, sizeof(PointCtx));
+    PointCtx.RcvTime = CFE_TIME_GetTime();
+
+    for (g = 0; g < Set->NumGroups; ++g)
+    {
+        Group          = &Set->Group[g];
+        PointCtx.MsgId = CFE_SB_ValueToMsgId(Group->MsgId);
+
+        for (Col = Group->First; Col < (Group->First + Group->Count); ++Col)
+        {
+            if (Set->State[Col] == Set->Reported[Col])
+            {
+                continue;
+            }
+
+            /* Sent as a new occurrence, so a point still flapping is coalesced again */
+            PointCtx.FcnCode = Set->EntryIdx[Col];
+            if (!SAMPLE_APP_CoalesceOpen(SAMPLE_APP_LIMIT_ERR_EID, &PointCtx) &&
+                SAMPLE_APP_CoalesceEvent(SAMPLE_APP_LIMIT_ERR_EID, &PointCtx))
+            {
+                SAMPLE_APP_LimitReport(Col, Group->MsgId);
+            }
+        }
+    }
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Check the limit points of a received packet.  Returns false if  */
+/* its MID has no limit points, leaving it for other handling.     */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+bool SAMPLE_APP_LimitCheckPacket(const CFE_SB_Buffer_t *SBBufPtr, const SAMPLE_APP_MsgContext_t *MsgCtx)
+{
+    const SAMPLE_APP_LimitSet_t *  Set   = &SAMPLE_APP_Data.Limit;
+    CFE_SB_MsgId_Atom_t            MsgId = CFE_SB_MsgIdToValue(MsgCtx->MsgId);
+    const SAMPLE_APP_LimitGroup_t *Group;
+    int32                          Value[SAMPLE_APP_LIMIT_MAX_ENTRIES];
+    uint8                          State[SAMPLE_APP_LIMIT_MAX_ENTRIES];
+    bool                           Found = false;
+    bool                           Short = false;
+    uint32                         g;
+    uint32                         i;
+
+    /* Groups are ordered by MID, so the packet's groups are one run */
+    for (g = 0; g < Set->NumGroups && Set->Group[g].MsgId <= MsgId; ++g)
+    {
+        Group = &Set->Group[g];
+        if (Group->MsgId != MsgId)
+        {
+            continue;
+        }
+
+        Found = true;
+
+        /* Points past the end of a short packet are left in their last state */
+        if (MsgCtx->MsgSize < Group->MinSize)
+        {
+            Short = true;
+            continue;
+        }
+
+        SAMPLE_APP_LimitGather((const uint8 *)SBBufPtr, Group, Value);
+        SAMPLE_APP_LimitEval(Set, Group->First, Group->Count, Value, State);
+
+        for (i = 0; i < Group->Count; ++i)
+        {
+            if (State[i] != Set->State[Group->First + i])
+            {
+                SAMPLE_APP_LimitTransition(Group->First + i, State[i], Value[i], MsgCtx);
+            }
+        }
+    }
+
+    if (Short && SAMPLE_APP_CoalesceEvent(SAMPLE_APP_LIMIT_LEN_ERR_EID, MsgCtx))
+    {
+        CFE_EVS_SendEvent(SAMPLE_APP_LIMIT_LEN_ERR_EID, CFE_EVS_EventType_ERROR,
+                          "Sample App: Limit checked packet too short, MID = 0x%lX, Len = %lu",
+                          (unsigned long)MsgId, (unsigned long)MsgCtx->MsgSize);
+    }
+
+    return Found;
+}
@@ -0,0 +1,63 @@
+/************************************************************************
+ * NASA Docket No. GSC-18,719-1, and identified as “core Flight System: Bootes”
+ *
+ * Copyright (c) 2020 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/**
+ * @file
+ *   This file contains the prototypes for the Sample App telemetry limit check functions
+ *
+ * Points of subscribed telemetry packets are checked against red and
+ * yellow low/high limits from the limit table.  The table is compiled
+ * into columns grouped by message ID and type, so the values of a group
+ * are gathered by one loop and checked together.  SAMPLE_APP_LimitEval()
+ * uses SSE2 when the target is built with it and always gives the same
+ * answer as the scalar reference.
+ *
+ * A point changing state sends one event, coalesced per point with its
+ * limit table entry in place of the command code.  A transition that was
+ * coalesced is followed, once the window closes, by an event with the
+ * point's state at that time, so the last event for a point is always
+ * its current state.
+ */
+
+#ifndef SAMPLE_APP_LIMIT_H
+#define SAMPLE_APP_LIMIT_H
+
+/*
+** Required header files.
+*/
+#include "sample_app.h"
+
+/*
+** Limit state bits, the limits a value is out of.  A value out of a
+** red limit is also out of the yellow one, and 0 is within limits.
+*/
+#define SAMPLE_APP_LIMIT_YELLOW_LOW  0x01
+#define SAMPLE_APP_LIMIT_RED_LOW     0x02
+#define SAMPLE_APP_LIMIT_YELLOW_HIGH 0x04
+#define SAMPLE_APP_LIMIT_RED_HIGH    0x08
+
+CFE_Status_t SAMPLE_APP_LimitValidationFunc(void *TblData);
+void         SAMPLE_APP_UpdateLimits(void);
+void         SAMPLE_APP_LimitFlush(void);
+bool         SAMPLE_APP_LimitCheckPacket(const CFE_SB_Buffer_t *SBBufPtr, const SAMPLE_APP_MsgContext_t *MsgCtx);
+void         SAMPLE_APP_LimitEval(const SAMPLE_APP_LimitSet_t *Set, uint32 First, uint32 Count, const int32 *Value,
+                                  uint8 *State);
+void         SAMPLE_APP_LimitEvalScalar(const SAMPLE_APP_LimitSet_t *Set, uint32 First, uint32 Count,
+                                        const int32 *Value, uint8 *State);
+
+#endif /* SAMPLE_APP_LIMIT_H */
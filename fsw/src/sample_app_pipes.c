@@ -0,0 +1,227 @@
+/************************************************************************
+ * NASA Docket No. GSC-18,719-1, and identified as “core Flight System: Bootes”
+ *
+ * Copyright (c) 2020 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/**
+ * \file
+ *   This file contains the source code for the Sample App pipe service functions
+ */
+
+/*
+** Include Files:
+*/
+#include "sample_app.h"
+#include "sample_app_eventids.h"
+#include "sample_app_dispatch.h"
+#include "sample_app_stats.h"
+#include "sample_app_utils.h"
+#include "sample_app_admit.h"
+#include "sample_app_pipes.h"
+
+/*
+** Pipes in priority order, highest first
+*/
+static const SAMPLE_APP_PipeConfig_t SAMPLE_APP_PipeConfig[SAMPLE_APP_NUM_PIPES] = SAMPLE_APP_PIPE_CONFIG_TABLE;
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Create the pipes and subscribe each to its message IDs          */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+CFE_Status_t SAMPLE_APP_PipesInit(void)
+{
+    CFE_Status_t                   status = CFE_SUCCESS;
+    const SAMPLE_APP_PipeConfig_t *Config;
+    uint32                         i;
+    uint32                         j;
+
+    SAMPLE_APP_Data.PipeServiceStrict = SAMPLE_APP_PIPE_SERVICE_STRICT;
+
+    for (i = 0; i < SAMPLE_APP_NUM_PIPES && status == CFE_SUCCESS; ++i)
+    {
+        Config = &SAMPLE_APP_PipeConfig[i];
+
+        status = CFE_SB_CreatePipe(&SAMPLE_APP_Data.Pipe[i].PipeId, Config->Depth, Config->Name);
+        if (status != CFE_SUCCESS)
+        {
+            CFE_EVS_SendEvent(SAMPLE_APP_CR_PIPE_ERR_EID, CFE_EVS_EventType_ERROR,
+                              "Sample App: Error creating SB Pipe %s, RC = 0x%08lX", Config->Name,
+                              (unsigned long)status);
+        }
+
+        for (j = 0; j < SAMPLE_APP_PIPE_MAX_SUBS && status == CFE_SUCCESS; ++j)
+        {
+            if (Config->Sub[j].MsgLim == 0)
+            {
+                continue;
+            }
+
+            status = CFE_SB_SubscribeEx(CFE_SB_ValueToMsgId(Config->Sub[j].MsgId), SAMPLE_APP_Data.Pipe[i].PipeId,
+                                        CFE_SB_DEFAULT_QOS, Config->Sub[j].MsgLim);
+            if (status != CFE_SUCCESS)
+            {
+                CFE_EVS_SendEvent((Config->Sub[j].MsgId == SAMPLE_APP_SEND_HK_MID) ? SAMPLE_APP_SUB_HK_ERR_EID
+                                                                                   : SAMPLE_APP_SUB_CMD_ERR_EID,
+                                  CFE_EVS_EventType_ERROR,
+                                  "Sample App: Error Subscribing to MID 0x%lX on %s, RC = 0x%08lX",
+                                  (unsigned long)Config->Sub[j].MsgId, Config->Name, (unsigned long)status);
+            }
+        }
+    }
+
+    return status;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Dispatch one buffer received from a pipe.  Messages taken since */
+/* the pipe was last found empty were all queued on it, so that    */
+/* count, up to the pipe depth, bounds how deep it can have been.  */
+/* Some of them may have arrived after others were taken, so under */
+/* load that never lets the pipe empty the bound reaches the depth */
+/* whatever the pipe really held, and only says it never drained.  */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+static void SAMPLE_APP_ProcessBuffer(uint32 PipeIdx, CFE_SB_Buffer_t *SBBufPtr)
+{
+    SAMPLE_APP_Pipe_t *     Pipe = &SAMPLE_APP_Data.Pipe[PipeIdx];
+    SAMPLE_APP_MsgContext_t MsgCtx;
+
+    SAMPLE_APP_DecodeMsgHeader(SBBufPtr, &MsgCtx);
+    SAMPLE_APP_TaskPipe(SBBufPtr, &MsgCtx);
+    SAMPLE_APP_RecordDispatchLatency(&MsgCtx);
+
+    ++SAMPLE_APP_Data.Backlog;
+
+    if (Pipe->Queued < SAMPLE_APP_PipeConfig[PipeIdx].Depth)
+    {
+        ++Pipe->Queued;
+    }
+    if (Pipe->Queued > Pipe->HighWatermark)
+    {
+        Pipe->HighWatermark = Pipe->Queued;
+    }
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Poll the pipes in priority order until they are all empty or    */
+/* SAMPLE_APP_PIPE_DRAIN_LIMIT is reached.  The buffer that woke   */
+/* the task, if any, came from SAMPLE_APP_PIPE_WAKE and is taken   */
+/* in that pipe's turn.                                            */
+/*                                                                 */
+/* In weighted mode each round takes up to Weight messages from    */
+/* every pipe in turn.  In strict mode each round takes a single   */
+/* message from the highest priority pipe that has one.            */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+CFE_Status_t SAMPLE_APP_ServicePipes(CFE_SB_Buffer_t *SBBufPtr)
+{
+    CFE_Status_t     status     = CFE_SUCCESS;
+    CFE_SB_Buffer_t *WakeBufPtr = SBBufPtr;
+    uint16           MsgCount   = 0;
+    uint16           Quota;
+    bool             Served = true;
+    uint32           i;
+
+    while (status == CFE_SUCCESS && Served && MsgCount < SAMPLE_APP_PIPE_DRAIN_LIMIT)
+    {
+        Served = false;
+
+        for (i = 0; i < SAMPLE_APP_NUM_PIPES && status == CFE_SUCCESS && MsgCount < SAMPLE_APP_PIPE_DRAIN_LIMIT; ++i)
+        {
+            Quota = SAMPLE_APP_Data.PipeServiceStrict ? 1 : SAMPLE_APP_PipeConfig[i].Weight;
+
+            while (Quota > 0 && MsgCount < SAMPLE_APP_PIPE_DRAIN_LIMIT)
+            {
+                if (i == SAMPLE_APP_PIPE_WAKE && WakeBufPtr != NULL)
+                {
+                    SBBufPtr   = WakeBufPtr;
+                    WakeBufPtr = NULL;
+                }
+                else
+                {
+                    status = CFE_SB_ReceiveBuffer(&SBBufPtr, SAMPLE_APP_Data.Pipe[i].PipeId, CFE_SB_POLL);
+                    if (status != CFE_SUCCESS)
+                    {
+                        break;
+                    }
+                }
+
+                SAMPLE_APP_ProcessBuffer(i, SBBufPtr);
+                ++MsgCount;
+                --Quota;
+                Served = true;
+            }
+
+            /* An empty pipe just moves service on to the next one */
+            if (status == CFE_SB_NO_MESSAGE)
+            {
+                SAMPLE_APP_Data.Pipe[i].Queued = 0;
+                status                         = CFE_SUCCESS;
+            }
+
+            /* Strict mode goes back to the highest priority pipe after every message */
+            if (Served && SAMPLE_APP_Data.PipeServiceStrict)
+            {
+                break;
+            }
+        }
+    }
+
+    /* The wakeup buffer is never dropped, even once the budget is used up */
+    if (WakeBufPtr != NULL)
+    {
+        SAMPLE_APP_ProcessBuffer(SAMPLE_APP_PIPE_WAKE, WakeBufPtr);
+        ++MsgCount;
+    }
+
+    /* A round that found nothing means every pipe is empty */
+    if (status == CFE_SUCCESS && !Served)
+    {
+        SAMPLE_APP_AdmitBacklogCleared();
+    }
+
+    if (MsgCount >= SAMPLE_APP_PIPE_DRAIN_LIMIT)
+    {
+        /* Budget used up, remaining messages wait for the next wakeup */
+        ++SAMPLE_APP_Data.DrainLimitHitCount;
+    }
+
+    SAMPLE_APP_Data.LastWakeupMsgCount = MsgCount;
+    if (MsgCount > SAMPLE_APP_Data.PeakWakeupMsgCount)
+    {
+        SAMPLE_APP_Data.PeakWakeupMsgCount = MsgCount;
+    }
+
+    return status;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Fill in the pipe statistics of the housekeeping packet          */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+void SAMPLE_APP_UpdatePipeStats(SAMPLE_APP_HkTlm_Payload_t *Payload)
+{
+    uint32 i;
+
+    for (i = 0; i < SAMPLE_APP_NUM_PIPES; ++i)
+    {
+        Payload->PipeHighWatermark[i] = SAMPLE_APP_Data.Pipe[i].HighWatermark;
+    }
+}
@@ -0,0 +1,46 @@
+/************************************************************************
+ * NASA Docket No. GSC-18,719-1, and identified as “core Flight System: Bootes”
+ *
+ * Copyright (c) 2020 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/**
+ * @file
+ *   This file contains the prototypes for the Sample App pipe service functions
+ *
+ * Messages arrive on one software bus pipe per priority class, so a burst
+ * on one class cannot delay or starve the others.  The pipes and their
+ * subscriptions come from SAMPLE_APP_PIPE_CONFIG_TABLE.
+ *
+ * The software bus cannot report how many messages a pipe holds, so each
+ * pipe's high watermark is the most messages taken from it between two
+ * times it was found empty.  That is an upper bound on its depth, and a
+ * watermark at the configured depth means the pipe never drained rather
+ * than that it filled; it sizes a pipe only under bursty load.
+ */
+
+#ifndef SAMPLE_APP_PIPES_H
+#define SAMPLE_APP_PIPES_H
+
+/*
+** Required header files.
+*/
+#include "sample_app.h"
+
+CFE_Status_t SAMPLE_APP_PipesInit(void);
+CFE_Status_t SAMPLE_APP_ServicePipes(CFE_SB_Buffer_t *SBBufPtr);
+void         SAMPLE_APP_UpdatePipeStats(SAMPLE_APP_HkTlm_Payload_t *Payload);
+
+#endif /* SAMPLE_APP_PIPES_H */
@@ -0,0 +1,251 @@
+/************************************************************************
+ * NASA Docket No. GSC-18,719-1, and identified as “core Flight System: Bootes”
+ *
+ * Copyright (c) 2020 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/**
+ * \file
+ *   This file contains the source code for the Sample App sensor quantile functions
+ */
+
+/*
+** Include Files:
+*/
+#include "sample_app.h"
+#include "sample_app_tlm.h"
+#include "sample_app_quantile.h"
+
+/*
+ * Quantiles estimated for each channel, in thousandths
+ */
+static const uint16 SAMPLE_APP_QUANTILE_PERMILLE[SAMPLE_APP_SENSOR_QUANTILES] = SAMPLE_APP_SENSOR_QUANTILE_PERMILLE;
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Sort the first few samples into marker order                    */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+static void SAMPLE_APP_QuantileSort(float *Height, uint32 Count)
+{
+    uint32 i;
+    uint32 j;
+    float  Value;
+
+    for (i = 1; i < Count; ++i)
+    {
+        Value = Height[i];
+
+        for (j = i; j > 0 && Height[j - 1] > Value; --j)
+        {
+            Height[j] = Height[j - 1];
+        }
+
+        Height[j] = Value;
+    }
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Height a middle marker would have after moving one position in  */
+/* direction Dir, by the parabola through it and its neighbours    */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+static double SAMPLE_APP_QuantileParabolic(const SAMPLE_APP_Quantile_t *Q, uint32 i, int32 Dir)
+{
+    double PosBelow = (double)Q->Pos[i] - Q->Pos[i - 1];
+    double PosAbove = (double)Q->Pos[i + 1] - Q->Pos[i];
+
+    return Q->Height[i] + Dir / (PosBelow + PosAbove) *
+                              ((PosBelow + Dir) * (Q->Height[i + 1] - Q->Height[i]) / PosAbove +
+                               (PosAbove - Dir) * (Q->Height[i] - Q->Height[i - 1]) / PosBelow);
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Add one sample to the estimate of quantile P, Count being the   */
+/* number of samples seen including this one                       */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+static void SAMPLE_APP_QuantileStep(SAMPLE_APP_Quantile_t *Q, uint32 Count, double P, float Value)
+{
+    /* Fraction of the samples each marker should have at or below it */
+    const double Step[SAMPLE_APP_QUANTILE_MARKERS] = {0.0, P / 2, P, (1 + P) / 2, 1.0};
+    uint32       i;
+    uint32       k;
+    int32        Dir;
+    double       Offset;
+    double       Height;
+
+    if (Count <= SAMPLE_APP_QUANTILE_MARKERS)
+    {
+        Q->Height[Count - 1] = Value;
+
+        if (Count == SAMPLE_APP_QUANTILE_MARKERS)
+        {
+            SAMPLE_APP_QuantileSort(Q->Height, Count);
+            for (i = 0; i < SAMPLE_APP_QUANTILE_MARKERS; ++i)
+            {
+                Q->Pos[i] = i + 1;
+            }
+        }
+        return;
+    }
+
+    /* Find the cell the sample falls in, stretching the ends to take it */
+    if (Value < Q->Height[0])
+    {
+        Q->Height[0] = Value;
+        k            = 0;
+    }
+    else if (Value >= Q->Height[4])
+    {
+        Q->Height[4] = Value;
+        k            = 3;
+    }
+    else
+    {
+        k = 0;
+        while (Value >= Q->Height[k + 1])
+        {
+            ++k;
+        }
+    }
+
+    for (i = k + 1; i < SAMPLE_APP_QUANTILE_MARKERS; ++i)
+    {
+        ++Q->Pos[i];
+    }
+
+    /* Move each middle marker a position toward where it should be, if it is a whole one away */
+    for (i = 1; i < SAMPLE_APP_QUANTILE_MARKERS - 1; ++i)
+    {
+        Offset = 1.0 + (Count - 1) * Step[i] - Q->Pos[i];
+
+        if ((Offset >= 1.0 && Q->Pos[i + 1] - Q->Pos[i] > 1) || (Offset <= -1.0 && Q->Pos[i] - Q->Pos[i - 1] > 1))
+        {
+            Dir    = (Offset > 0) ? 1 : -1;
+            Height = SAMPLE_APP_QuantileParabolic(Q, i, Dir);
+
+            /* Fall back to linear if the parabola would break the marker order */
+            if (Height <= Q->Height[i - 1] || Height >= Q->Height[i + 1])
+            {
+                Height = Q->Height[i] + Dir * (Q->Height[i + Dir] - Q->Height[i]) /
+                                            ((double)Q->Pos[i + Dir] - Q->Pos[i]);
+            }
+
+            Q->Height[i] = (float)Height;
+            Q->Pos[i] += Dir;
+        }
+    }
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Current estimate of quantile P                                  */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+static float SAMPLE_APP_QuantileValue(const SAMPLE_APP_Quantile_t *Q, uint32 Count, double P)
+{
+    float Sorted[SAMPLE_APP_QUANTILE_MARKERS];
+
+    if (Count >= SAMPLE_APP_QUANTILE_MARKERS)
+    {
+        return Q->Height[2];
+    }
+
+    if (Count == 0)
+    {
+        return 0.0f;
+    }
+
+    /* Too few samples for the markers yet, so take the nearest rank */
+    memcpy(Sorted, Q->Height, Count * sizeof(Sorted[0]));
+    SAMPLE_APP_QuantileSort(Sorted, Count);
+
+    return Sorted[(uint32)(P * (Count - 1) + 0.5)];
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Add filtered samples of one channel to its quantile estimates.  */
+/* They hold once the sample count is about to wrap, until reset   */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+void SAMPLE_APP_QuantileAdd(uint16 Channel, const int16 *Sample, uint32 NumSamples)
+{
+    SAMPLE_APP_SensorQuantiles_t *Chan = &SAMPLE_APP_Data.SensorQuantiles[Channel];
+    uint32                        i;
+    uint16                        q;
+
+    for (i = 0; i < NumSamples && Chan->Count < UINT32_MAX; ++i)
+    {
+        ++Chan->Count;
+
+        for (q = 0; q < SAMPLE_APP_SENSOR_QUANTILES; ++q)
+        {
+            SAMPLE_APP_QuantileStep(&Chan->Quantile[q], Chan->Count, SAMPLE_APP_QUANTILE_PERMILLE[q] / 1000.0,
+                                    Sample[i]);
+        }
+    }
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Start every channel's quantile estimates afresh                 */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+void SAMPLE_APP_QuantileReset(void)
+{
+    memset(SAMPLE_APP_Data.SensorQuantiles, 0, sizeof(SAMPLE_APP_Data.SensorQuantiles));
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Send the sensor quantile packet, on its telemetry schedule slot */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+CFE_Status_t SAMPLE_APP_SendQuantileTlm(const SAMPLE_APP_SendHkCmd_t *Msg)
+{
+    const SAMPLE_APP_SensorQuantiles_t *Chan;
+    SAMPLE_APP_TlmPacket_t              Pkt;
+    SAMPLE_APP_QuantileTlm_t *          QuantileTlm;
+    SAMPLE_APP_QuantileEstimate_t *     Estimate;
+    uint16                              Channel;
+    uint16                              q;
+
+    QuantileTlm = SAMPLE_APP_TlmBegin(&Pkt, &SAMPLE_APP_Data.QuantileTlm.TelemetryHeader,
+                                      sizeof(SAMPLE_APP_QuantileTlm_t));
+    memset(&QuantileTlm->Payload, 0, sizeof(QuantileTlm->Payload));
+
+    for (Channel = 0; Channel < SAMPLE_APP_SENSOR_CHANNELS; ++Channel)
+    {
+        Chan = &SAMPLE_APP_Data.SensorQuantiles[Channel];
+
+        QuantileTlm->Payload.Count[Channel] = Chan->Count;
+
+        for (q = 0; q < SAMPLE_APP_SENSOR_QUANTILES; ++q)
+        {
+            Estimate           = &QuantileTlm->Payload.Quantile[Channel][q];
+            Estimate->Permille = SAMPLE_APP_QUANTILE_PERMILLE[q];
+            Estimate->Value    = SAMPLE_APP_QuantileValue(&Chan->Quantile[q], Chan->Count,
+                                                          SAMPLE_APP_QUANTILE_PERMILLE[q] / 1000.0);
+        }
+    }
+
+    SAMPLE_APP_TlmSend(&Pkt);
+
+    return CFE_SUCCESS;
+}
@@ -0,0 +1,42 @@
+/************************************************************************
+ * NASA Docket No. GSC-18,719-1, and identified as “core Flight System: Bootes”
+ *
+ * Copyright (c) 2020 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/**
+ * @file
+ *   This file contains the prototypes for the Sample App sensor quantile functions
+ *
+ * Each configured quantile of every channel's filtered samples is
+ * estimated with the P-square algorithm (Jain and Chlamtac, 1985), which
+ * keeps five markers per quantile instead of the samples themselves and
+ * moves them with a piecewise parabolic fit as each sample arrives.  The
+ * estimates cover every sample since the last statistics reset.
+ */
+
+#ifndef SAMPLE_APP_QUANTILE_H
+#define SAMPLE_APP_QUANTILE_H
+
+/*
+** Required header files.
+*/
+#include "sample_app.h"
+
+void         SAMPLE_APP_QuantileAdd(uint16 Channel, const int16 *Sample, uint32 NumSamples);
+void         SAMPLE_APP_QuantileReset(void);
+CFE_Status_t SAMPLE_APP_SendQuantileTlm(const SAMPLE_APP_SendHkCmd_t *Msg);
+
+#endif /* SAMPLE_APP_QUANTILE_H */
@@ -0,0 +1,107 @@
+/************************************************************************
+ * NASA Docket No. GSC-18,719-1, and identified as “core Flight System: Bootes”
+ *
+ * Copyright (c) 2020 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/**
+ * \file
+ *   This file contains the source code for the Sample App range check kernels
+ */
+
+/*
+** Include Files:
+*/
+#include "sample_app_range.h"
+
+#if defined(__SSE2__)
+#include <immintrin.h>
+#endif
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Portable range check, one value at a time                       */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+uint32 SAMPLE_APP_RangeCheckS16Scalar(const int16 *Values, uint32 Count, int16 Min, int16 Max)
+{
+    uint32 i;
+
+    for (i = 0; i < Count; ++i)
+    {
+        if (Values[i] < Min || Values[i] > Max)
+        {
+            break;
+        }
+    }
+
+    return i;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Range check using the widest vectors the target was built for   */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+uint32 SAMPLE_APP_RangeCheckS16(const int16 *Values, uint32 Count, int16 Min, int16 Max)
+{
+    uint32 i = 0;
+
+    /*
+     * A value is out of range when it compares greater than Max or
+     * Min compares greater than it.  Whole blocks are skipped while
+     * they pass; the first failing block is left for the scalar loop,
+     * which finds the exact index within it.
+     */
+#if defined(__AVX2__)
+    {
+        const __m256i VMin = _mm256_set1_epi16(Min);
+        const __m256i VMax = _mm256_set1_epi16(Max);
+        __m256i       V;
+        __m256i       Out;
+
+        for (; (Count - i) >= 16; i += 16)
+        {
+            V   = _mm256_loadu_si256((const __m256i *)&Values[i]);
+            Out = _mm256_or_si256(_mm256_cmpgt_epi16(V, VMax), _mm256_cmpgt_epi16(VMin, V));
+            if (_mm256_movemask_epi8(Out) != 0)
+            {
+                break;
+            }
+        }
+    }
+#endif
+
+#if defined(__SSE2__)
+    {
+        const __m128i VMin = _mm_set1_epi16(Min);
+        const __m128i VMax = _mm_set1_epi16(Max);
+        __m128i       V;
+        __m128i       Out;
+
+        for (; (Count - i) >= 8; i += 8)
+        {
+            V   = _mm_loadu_si128((const __m128i *)&Values[i]);
+            Out = _mm_or_si128(_mm_cmpgt_epi16(V, VMax), _mm_cmpgt_epi16(VMin, V));
+            if (_mm_movemask_epi8(Out) != 0)
+            {
+                break;
+            }
+        }
+    }
+#endif
+
+    return i + SAMPLE_APP_RangeCheckS16Scalar(&Values[i], Count - i, Min, Max);
+}
@@ -0,0 +1,41 @@
+/************************************************************************
+ * NASA Docket No. GSC-18,719-1, and identified as “core Flight System: Bootes”
+ *
+ * Copyright (c) 2020 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/**
+ * @file
+ *   This file contains the prototypes for the Sample App range check kernels
+ *
+ * Both functions check a contiguous column of values against an inclusive
+ * [Min, Max] range and return the index of the first value outside it, or
+ * Count if all are in range.  SAMPLE_APP_RangeCheckS16() uses SSE2 or AVX2
+ * when the target is built with them and always gives the same answer as
+ * the scalar reference.
+ */
+
+#ifndef SAMPLE_APP_RANGE_H
+#define SAMPLE_APP_RANGE_H
+
+/*
+** Required header files.
+*/
+#include "common_types.h"
+
+uint32 SAMPLE_APP_RangeCheckS16(const int16 *Values, uint32 Count, int16 Min, int16 Max);
+uint32 SAMPLE_APP_RangeCheckS16Scalar(const int16 *Values, uint32 Count, int16 Min, int16 Max);
+
+#endif /* SAMPLE_APP_RANGE_H */
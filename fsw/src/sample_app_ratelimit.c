@@ -0,0 +1,206 @@
+/************************************************************************
+ * NASA Docket No. GSC-18,719-1, and identified as “core Flight System: Bootes”
+ *
+ * Copyright (c) 2020 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/**
+ * \file
+ *   This file contains the source code for the Sample App rate limit functions
+ */
+
+/*
+** Include Files:
+*/
+#include "sample_app.h"
+#include "sample_app_eventids.h"
+#include "sample_app_msgids.h"
+#include "sample_app_ratelimit.h"
+
+/* Tokens are kept in thousandths of a message so slow rates still refill */
+#define SAMPLE_APP_TOKEN_SCALE 1000
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Row of token buckets for a message ID, -1 if it has none        */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+static int32 SAMPLE_APP_RateLimitMidSlot(CFE_SB_MsgId_Atom_t MsgId)
+{
+    switch (MsgId)
+    {
+        case SAMPLE_APP_CMD_MID:
+            return 0;
+
+        case SAMPLE_APP_SEND_HK_MID:
+            return 1;
+
+        default:
+            return -1;
+    }
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Verify contents of the Rate Limit Table buffer                  */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+CFE_Status_t SAMPLE_APP_RateLimitValidationFunc(void *TblData)
+{
+    SAMPLE_APP_RateLimitTable_t *      TblDataPtr = (SAMPLE_APP_RateLimitTable_t *)TblData;
+    const SAMPLE_APP_RateLimitEntry_t *Entry;
+    bool                               Used[SAMPLE_APP_RATE_LIMIT_MID_SLOTS][SAMPLE_APP_ADMIT_MAX_CC];
+    int32                              Slot;
+    uint32                             i;
+
+    memset(Used, 0, sizeof(Used));
+
+    for (i = 0; i < SAMPLE_APP_RATE_LIMIT_MAX_ENTRIES; ++i)
+    {
+        Entry = &TblDataPtr->Entry[i];
+        if (Entry->MsgId == 0)
+        {
+            continue;
+        }
+
+        /* Only the app's own message IDs can be limited, once per command code */
+        Slot = SAMPLE_APP_RateLimitMidSlot(Entry->MsgId);
+        if (Slot < 0 || Entry->CommandCode >= SAMPLE_APP_ADMIT_MAX_CC || Used[Slot][Entry->CommandCode] ||
+            Entry->BurstSize == 0 || Entry->RatePerSec == 0)
+        {
+            return SAMPLE_APP_TABLE_OUT_OF_RANGE_ERR_CODE;
+        }
+
+        Used[Slot][Entry->CommandCode] = true;
+    }
+
+    return CFE_SUCCESS;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Rebuild the token buckets after a rate limit table update       */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+void SAMPLE_APP_UpdateRateLimits(void)
+{
+    CFE_Status_t                       status;
+    SAMPLE_APP_RateLimitTable_t *      TblPtr;
+    const SAMPLE_APP_RateLimitEntry_t *Entry;
+    SAMPLE_APP_TokenBucket_t *         Bucket;
+    CFE_TIME_SysTime_t                 Now;
+    uint32                             i;
+
+    status = CFE_TBL_GetAddress((void *)&TblPtr, SAMPLE_APP_Data.TblHandles[1]);
+    if (status == CFE_TBL_INFO_UPDATED)
+    {
+        memset(SAMPLE_APP_Data.RateIndex, 0, sizeof(SAMPLE_APP_Data.RateIndex));
+        Now = CFE_TIME_GetTime();
+
+        /* Entries were checked by the validation function, so every used one has a slot */
+        for (i = 0; i < SAMPLE_APP_RATE_LIMIT_MAX_ENTRIES; ++i)
+        {
+            Entry  = &TblPtr->Entry[i];
+            Bucket = &SAMPLE_APP_Data.RateBucket[i];
+
+            Bucket->MaxTokens  = Entry->BurstSize * SAMPLE_APP_TOKEN_SCALE;
+            Bucket->Tokens     = Bucket->MaxTokens;
+            Bucket->RatePerSec = Entry->RatePerSec;
+            Bucket->LastRefill = Now;
+
+            if (Entry->MsgId != 0)
+            {
+                SAMPLE_APP_Data.RateIndex[SAMPLE_APP_RateLimitMidSlot(Entry->MsgId)][Entry->CommandCode] = i + 1;
+            }
+        }
+    }
+
+    if (status == CFE_SUCCESS || status == CFE_TBL_INFO_UPDATED)
+    {
+        CFE_TBL_ReleaseAddress(SAMPLE_APP_Data.TblHandles[1]);
+    }
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Take a token for a received message.  Returns false, and counts */
+/* the reject, if its bucket is empty.                             */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+bool SAMPLE_APP_RateLimitCheck(const SAMPLE_APP_MsgContext_t *MsgCtx)
+{
+    SAMPLE_APP_TokenBucket_t *Bucket;
+    CFE_TIME_SysTime_t        Elapsed;
+    uint64                    Tokens;
+    int32                     Slot;
+    uint8                     Index;
+
+    Slot = SAMPLE_APP_RateLimitMidSlot(CFE_SB_MsgIdToValue(MsgCtx->MsgId));
+    if (Slot < 0 || MsgCtx->FcnCode >= SAMPLE_APP_ADMIT_MAX_CC)
+    {
+        return true;
+    }
+
+    Index = SAMPLE_APP_Data.RateIndex[Slot][MsgCtx->FcnCode];
+    if (Index == 0)
+    {
+        return true;
+    }
+
+    /*
+     * Refill for the time since the last message, using the receive time already taken.
+     * A receive time older than the last refill counts as no time at all, otherwise the
+     * subtraction wraps and the bucket would be refilled and its refill time moved back.
+     */
+    Bucket = &SAMPLE_APP_Data.RateBucket[Index - 1];
+    if (CFE_TIME_Compare(MsgCtx->RcvTime, Bucket->LastRefill) != CFE_TIME_A_LT_B)
+    {
+        Elapsed = CFE_TIME_Subtract(MsgCtx->RcvTime, Bucket->LastRefill);
+        Tokens  = (((uint64)Elapsed.Seconds * 1000000) + CFE_TIME_Sub2MicroSecs(Elapsed.Subseconds)) *
+                     Bucket->RatePerSec / (1000000 / SAMPLE_APP_TOKEN_SCALE) +
+                 Bucket->Tokens;
+
+        Bucket->Tokens     = (Tokens > Bucket->MaxTokens) ? Bucket->MaxTokens : Tokens;
+        Bucket->LastRefill = MsgCtx->RcvTime;
+    }
+
+    if (Bucket->Tokens < SAMPLE_APP_TOKEN_SCALE)
+    {
+        ++SAMPLE_APP_Data.AdmitTlm.Payload.RateLimitCount[Index - 1];
+        ++SAMPLE_APP_Data.RateLimitReportCount;
+        return false;
+    }
+
+    Bucket->Tokens -= SAMPLE_APP_TOKEN_SCALE;
+
+    return true;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Send one event summarizing the rejects since the last report    */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+void SAMPLE_APP_ReportRateLimits(void)
+{
+    if (SAMPLE_APP_Data.RateLimitReportCount != 0)
+    {
+        CFE_EVS_SendEvent(SAMPLE_APP_RATE_LIMIT_ERR_EID, CFE_EVS_EventType_ERROR,
+                          "Sample App: %lu messages rejected by rate limits since last report",
+                          (unsigned long)SAMPLE_APP_Data.RateLimitReportCount);
+
+        SAMPLE_APP_Data.RateLimitReportCount = 0;
+    }
+}
@@ -0,0 +1,131 @@
+/************************************************************************
+ * NASA Docket No. GSC-18,719-1, and identified as “core Flight System: Bootes”
+ *
+ * Copyright (c) 2020 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/**
+ * \file
+ *   This file contains the source code for the Sample App sensor data functions
+ */
+
+/*
+** Include Files:
+*/
+#include "sample_app.h"
+#include "sample_app_eventids.h"
+#include "sample_app_fir.h"
+#include "sample_app_range.h"
+#include "sample_app_tlm.h"
+#include "sample_app_winstats.h"
+#include "sample_app_quantile.h"
+#include "sample_app_cal.h"
+#include "sample_app_sensor.h"
+
+/*
+ * Samples of history kept ahead of each block, enough for the longest filter
+ */
+#define SAMPLE_APP_SENSOR_HISTORY (SAMPLE_APP_FIR_MAX_TAPS - 1)
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Filter one block of sensor data and publish the result, both   */
+/* in raw counts and in engineering units                          */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+CFE_Status_t SAMPLE_APP_SensorDataCmd(const SAMPLE_APP_SensorDataCmd_t *Msg)
+{
+    SAMPLE_APP_SensorChannel_t *Chan;
+    SAMPLE_APP_TlmPacket_t      Pkt;
+    SAMPLE_APP_TlmPacket_t      EngPkt;
+    SAMPLE_APP_FilteredTlm_t *  FilteredTlm;
+    SAMPLE_APP_EngTlm_t *       EngTlm;
+    uint16                      NumTaps = SAMPLE_APP_Data.FirNumTaps;
+    uint32                      BadIdx;
+
+    if (Msg->Payload.Channel >= SAMPLE_APP_SENSOR_CHANNELS)
+    {
+        SAMPLE_APP_Data.ErrCounter++;
+        CFE_EVS_SendEvent(SAMPLE_APP_SENSOR_ERR_EID, CFE_EVS_EventType_ERROR,
+                          "Sample App: Sensor data for invalid channel %u", (unsigned int)Msg->Payload.Channel);
+        return SAMPLE_APP_SENSOR_CHANNEL_ERR_CODE;
+    }
+
+    BadIdx = SAMPLE_APP_RangeCheckS16(Msg->Payload.Sample, SAMPLE_APP_SENSOR_BLOCK_SAMPLES, SAMPLE_APP_SENSOR_RAW_MIN,
+                                      SAMPLE_APP_SENSOR_RAW_MAX);
+    if (BadIdx < SAMPLE_APP_SENSOR_BLOCK_SAMPLES)
+    {
+        SAMPLE_APP_Data.ErrCounter++;
+        CFE_EVS_SendEvent(SAMPLE_APP_SENSOR_ERR_EID, CFE_EVS_EventType_ERROR,
+                          "Sample App: Sensor channel %u sample %lu out of range: %d",
+                          (unsigned int)Msg->Payload.Channel, (unsigned long)BadIdx, (int)Msg->Payload.Sample[BadIdx]);
+        return SAMPLE_APP_SENSOR_RANGE_ERR_CODE;
+    }
+
+    /* The block goes in after the history so the filter sees one contiguous run */
+    Chan = &SAMPLE_APP_Data.Sensor[Msg->Payload.Channel];
+    memcpy(&Chan->In[SAMPLE_APP_SENSOR_HISTORY], Msg->Payload.Sample, sizeof(Msg->Payload.Sample));
+
+    FilteredTlm = SAMPLE_APP_TlmBegin(&Pkt, &SAMPLE_APP_Data.FilteredTlm.TelemetryHeader,
+                                      sizeof(SAMPLE_APP_FilteredTlm_t));
+    FilteredTlm->Payload.Channel = Msg->Payload.Channel;
+    FilteredTlm->Payload.spare   = 0;
+
+    if (NumTaps == 0)
+    {
+        memcpy(FilteredTlm->Payload.Sample, Msg->Payload.Sample, sizeof(FilteredTlm->Payload.Sample));
+    }
+    else
+    {
+        SAMPLE_APP_FirFilterS16(&Chan->In[SAMPLE_APP_SENSOR_HISTORY + 1 - NumTaps], FilteredTlm->Payload.Sample,
+                                SAMPLE_APP_SENSOR_BLOCK_SAMPLES, SAMPLE_APP_Data.FirTaps, NumTaps);
+    }
+
+    SAMPLE_APP_WinStatsAdd(Msg->Payload.Channel, FilteredTlm->Payload.Sample, SAMPLE_APP_SENSOR_BLOCK_SAMPLES);
+    SAMPLE_APP_QuantileAdd(Msg->Payload.Channel, FilteredTlm->Payload.Sample, SAMPLE_APP_SENSOR_BLOCK_SAMPLES);
+
+    EngTlm = SAMPLE_APP_TlmBegin(&EngPkt, &SAMPLE_APP_Data.EngTlm.TelemetryHeader, sizeof(SAMPLE_APP_EngTlm_t));
+    EngTlm->Payload.Channel = Msg->Payload.Channel;
+    EngTlm->Payload.spare   = 0;
+
+    SAMPLE_APP_CalConvert(&SAMPLE_APP_Data.CalLut.Channel[Msg->Payload.Channel], FilteredTlm->Payload.Sample,
+                          EngTlm->Payload.Value, SAMPLE_APP_SENSOR_BLOCK_SAMPLES);
+
+    SAMPLE_APP_TlmSend(&Pkt);
+    SAMPLE_APP_TlmSend(&EngPkt);
+
+    /* The newest samples become the history of the next block */
+    memmove(Chan->In, &Chan->In[SAMPLE_APP_SENSOR_BLOCK_SAMPLES], SAMPLE_APP_SENSOR_HISTORY * sizeof(Chan->In[0]));
+
+    return CFE_SUCCESS;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Take the filter taps from a checked example table load.  The    */
+/* kernel wants them oldest sample first, the reverse of the table */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+void SAMPLE_APP_SensorSetFilter(const SAMPLE_APP_ExampleTable_t *TblPtr)
+{
+    uint16 i;
+
+    for (i = 0; i < TblPtr->FirNumTaps; ++i)
+    {
+        SAMPLE_APP_Data.FirTaps[i] = TblPtr->FirCoeff[TblPtr->FirNumTaps - 1 - i];
+    }
+
+    SAMPLE_APP_Data.FirNumTaps = TblPtr->FirNumTaps;
+}
@@ -0,0 +1,121 @@
+/************************************************************************
+ * NASA Docket No. GSC-18,719-1, and identified as “core Flight System: Bootes”
+ *
+ * Copyright (c) 2020 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/**
+ * \file
+ *   This file contains the source code for the Sample App dispatch statistics functions
+ */
+
+/*
+** Include Files:
+*/
+#include "sample_app.h"
+#include "sample_app_stats.h"
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Convert a latency in microseconds to its log2 histogram bin     */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+static uint32 SAMPLE_APP_LatencyBin(uint32 Latency)
+{
+    uint32 Bin = 0;
+
+    while (Latency > 1 && Bin < (SAMPLE_APP_LATENCY_HIST_BINS - 1))
+    {
+        Latency >>= 1;
+        ++Bin;
+    }
+
+    return Bin;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Add one dispatch to the histogram of its MID/CC pair            */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+void SAMPLE_APP_RecordDispatchLatency(const SAMPLE_APP_MsgContext_t *MsgCtx)
+{
+    CFE_TIME_SysTime_t          Elapsed;
+    CFE_SB_MsgId_Atom_t         MsgIdValue;
+    uint32                      Latency;
+    uint32                      i;
+    SAMPLE_APP_DispatchStats_t *Entry = NULL;
+
+    Elapsed = CFE_TIME_Subtract(CFE_TIME_GetTime(), MsgCtx->RcvTime);
+
+    /* Anything over an hour saturates, it lands in the last bin either way */
+    if (Elapsed.Seconds >= 3600)
+    {
+        Latency = 0xFFFFFFFF;
+    }
+    else
+    {
+        Latency = (Elapsed.Seconds * 1000000) + CFE_TIME_Sub2MicroSecs(Elapsed.Subseconds);
+    }
+
+    MsgIdValue = CFE_SB_MsgIdToValue(MsgCtx->MsgId);
+
+    /*
+    ** Find the entry for this MID/CC, or the first unused one.
+    ** Entries are never freed except by a reset, so the first
+    ** unused entry marks the end of the search.
+    */
+    for (i = 0; i < SAMPLE_APP_STATS_MAX_ENTRIES; i++)
+    {
+        Entry = &SAMPLE_APP_Data.StatsTlm.Payload.Entry[i];
+
+        if (Entry->DispatchCount == 0)
+        {
+            Entry->MsgId       = MsgIdValue;
+            Entry->CommandCode = MsgCtx->FcnCode;
+            break;
+        }
+
+        if (Entry->MsgId == MsgIdValue && Entry->CommandCode == MsgCtx->FcnCode)
+        {
+            break;
+        }
+    }
+
+    if (i < SAMPLE_APP_STATS_MAX_ENTRIES)
+    {
+        ++Entry->DispatchCount;
+        ++Entry->LatencyHist[SAMPLE_APP_LatencyBin(Latency)];
+
+        if (Latency > Entry->MaxLatency)
+        {
+            Entry->MaxLatency = Latency;
+        }
+    }
+    else
+    {
+        ++SAMPLE_APP_Data.StatsTlm.Payload.UntrackedCount;
+    }
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Clear all dispatch statistics                                   */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+void SAMPLE_APP_ResetDispatchStats(void)
+{
+    memset(&SAMPLE_APP_Data.StatsTlm.Payload, 0, sizeof(SAMPLE_APP_Data.StatsTlm.Payload));
+}
@@ -0,0 +1,184 @@
+/************************************************************************
+ * NASA Docket No. GSC-18,719-1, and identified as “core Flight System: Bootes”
+ *
+ * Copyright (c) 2020 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/**
+ * \file
+ *   This file contains the source code for the Sample App example table copy functions
+ */
+
+/*
+** Include Files:
+*/
+#include "sample_app.h"
+#include "sample_app_eventids.h"
+#include "sample_app_tblcopy.h"
+
+#include <stdlib.h>
+
+/*
+ * Readers run in other tasks, so the sequence and active pointer are
+ * accessed with compiler atomics to get the required memory ordering.
+ */
+#define SAMPLE_APP_ATOMIC_LOAD(Ptr)       __atomic_load_n((Ptr), __ATOMIC_ACQUIRE)
+#define SAMPLE_APP_ATOMIC_STORE(Ptr, Val) __atomic_store_n((Ptr), (Val), __ATOMIC_RELEASE)
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Order index entries by key, then by record position             */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+static int SAMPLE_APP_CompareIndexEntry(const void *Ptr1, const void *Ptr2)
+{
+    const SAMPLE_APP_RecordIndexEntry_t *Entry1 = Ptr1;
+    const SAMPLE_APP_RecordIndexEntry_t *Entry2 = Ptr2;
+
+    if (Entry1->Key != Entry2->Key)
+    {
+        return (Entry1->Key < Entry2->Key) ? -1 : 1;
+    }
+
+    return (Entry1->RecordIdx < Entry2->RecordIdx) ? -1 : (Entry1->RecordIdx > Entry2->RecordIdx);
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Rebuild the sorted record index of a table copy                 */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+static void SAMPLE_APP_BuildRecordIndex(SAMPLE_APP_TableCopy_t *Copy)
+{
+    uint16 i;
+
+    Copy->IndexCount = Copy->Tbl.NumRecords;
+    if (Copy->IndexCount > SAMPLE_APP_TBL_MAX_RECORDS)
+    {
+        Copy->IndexCount = SAMPLE_APP_TBL_MAX_RECORDS;
+    }
+
+    for (i = 0; i < Copy->IndexCount; ++i)
+    {
+        Copy->Index[i].Key       = Copy->Tbl.Record[i].Key;
+        Copy->Index[i].RecordIdx = i;
+    }
+
+    qsort(Copy->Index, Copy->IndexCount, sizeof(Copy->Index[0]), SAMPLE_APP_CompareIndexEntry);
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Copy a new table load into the inactive copy and make it active */
+/* Only called from the main task                                  */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+void SAMPLE_APP_PublishTableCopy(const SAMPLE_APP_ExampleTable_t *TblPtr)
+{
+    SAMPLE_APP_TableCopy_t *NextCopy;
+    uint32                  Seq = SAMPLE_APP_Data.TblCopySeq;
+    CFE_TIME_SysTime_t      StartTime;
+    CFE_TIME_SysTime_t      Elapsed;
+
+    /* Load number N always goes to copy N % 2, the one not currently active */
+    NextCopy = &SAMPLE_APP_Data.TblCopy[((Seq / 2) + 1) & 1];
+
+    /* Odd sequence tells readers a copy is being overwritten */
+    SAMPLE_APP_ATOMIC_STORE(&SAMPLE_APP_Data.TblCopySeq, Seq + 1);
+    __atomic_thread_fence(__ATOMIC_RELEASE);
+
+    memcpy(&NextCopy->Tbl, TblPtr, sizeof(NextCopy->Tbl));
+    NextCopy->Crc = SAMPLE_APP_Data.ExampleTblCrc;
+
+    StartTime = CFE_TIME_GetTime();
+    SAMPLE_APP_BuildRecordIndex(NextCopy);
+    Elapsed = CFE_TIME_Subtract(CFE_TIME_GetTime(), StartTime);
+
+    CFE_EVS_SendEvent(SAMPLE_APP_TBL_INDEX_INF_EID, CFE_EVS_EventType_INFORMATION,
+                      "SAMPLE: Example table indexed, %u records in %lu.%06lu sec",
+                      (unsigned int)NextCopy->IndexCount, (unsigned long)Elapsed.Seconds,
+                      (unsigned long)CFE_TIME_Sub2MicroSecs(Elapsed.Subseconds));
+
+    SAMPLE_APP_ATOMIC_STORE(&SAMPLE_APP_Data.TblCopyActive, NextCopy);
+    SAMPLE_APP_ATOMIC_STORE(&SAMPLE_APP_Data.TblCopySeq, Seq + 2);
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Get the active table copy, NULL if nothing has been published   */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+const SAMPLE_APP_TableCopy_t *SAMPLE_APP_TableCopyBegin(uint32 *Token)
+{
+    *Token = SAMPLE_APP_ATOMIC_LOAD(&SAMPLE_APP_Data.TblCopySeq);
+
+    return SAMPLE_APP_ATOMIC_LOAD(&SAMPLE_APP_Data.TblCopyActive);
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Check the copy returned with Token was not overwritten since    */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+bool SAMPLE_APP_TableCopyValid(uint32 Token)
+{
+    uint32 Seq;
+
+    /* All reads of the copy must complete before the sequence is checked */
+    __atomic_thread_fence(__ATOMIC_ACQUIRE);
+    Seq = __atomic_load_n(&SAMPLE_APP_Data.TblCopySeq, __ATOMIC_RELAXED);
+
+    /*
+     * The copy a reader got is not written again until the second load
+     * after the one it was published by.  If the reader caught a load in
+     * progress it may hold the older copy, so measure from the last even
+     * (completed) sequence.
+     */
+    return (Seq - (Token & ~1U)) <= 2;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Look up a record by key, NULL if the copy has no such record    */
+/* With duplicate keys the first one in the table is returned      */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+const SAMPLE_APP_ExampleRecord_t *SAMPLE_APP_FindRecord(const SAMPLE_APP_TableCopy_t *Copy, uint16 Key)
+{
+    uint16 Lo = 0;
+    uint16 Hi = Copy->IndexCount;
+    uint16 Mid;
+
+    /* Find the first index entry with a key not less than the one wanted */
+    while (Lo < Hi)
+    {
+        Mid = Lo + ((Hi - Lo) / 2);
+        if (Copy->Index[Mid].Key < Key)
+        {
+            Lo = Mid + 1;
+        }
+        else
+        {
+            Hi = Mid;
+        }
+    }
+
+    if (Lo == Copy->IndexCount || Copy->Index[Lo].Key != Key)
+    {
+        return NULL;
+    }
+
+    return &Copy->Tbl.Record[Copy->Index[Lo].RecordIdx];
+}
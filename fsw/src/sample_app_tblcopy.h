@@ -0,0 +1,46 @@
+/************************************************************************
+ * NASA Docket No. GSC-18,719-1, and identified as “core Flight System: Bootes”
+ *
+ * Copyright (c) 2020 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/**
+ * @file
+ *   This file contains the prototypes for the Sample App example table copy functions
+ *
+ * The main task publishes each new table load into one of two app-owned
+ * copies.  Readers in other tasks never block: they take the active copy
+ * with SAMPLE_APP_TableCopyBegin() and, once done with it, confirm with
+ * SAMPLE_APP_TableCopyValid() that it was not overwritten in the meantime.
+ * If it was, the reader discards its result and starts again.
+ *
+ * Each copy carries an index of its records sorted by key, rebuilt when
+ * the copy is published, so SAMPLE_APP_FindRecord() is a binary search.
+ */
+
+#ifndef SAMPLE_APP_TBLCOPY_H
+#define SAMPLE_APP_TBLCOPY_H
+
+/*
+** Required header files.
+*/
+#include "sample_app.h"
+
+void                              SAMPLE_APP_PublishTableCopy(const SAMPLE_APP_ExampleTable_t *TblPtr);
+const SAMPLE_APP_TableCopy_t *    SAMPLE_APP_TableCopyBegin(uint32 *Token);
+bool                              SAMPLE_APP_TableCopyValid(uint32 Token);
+const SAMPLE_APP_ExampleRecord_t *SAMPLE_APP_FindRecord(const SAMPLE_APP_TableCopy_t *Copy, uint16 Key);
+
+#endif /* SAMPLE_APP_TBLCOPY_H */
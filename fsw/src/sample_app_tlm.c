@@ -0,0 +1,90 @@
+/************************************************************************
+ * NASA Docket No. GSC-18,719-1, and identified as “core Flight System: Bootes”
+ *
+ * Copyright (c) 2020 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/**
+ * \file
+ *   This file contains the source code for the Sample App telemetry transmit functions
+ */
+
+/*
+** Include Files:
+*/
+#include "sample_app.h"
+#include "sample_app_tlm.h"
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Start a telemetry packet of the given size.  Fallback is the    */
+/* app's initialized copy of the packet, whose header is reused.   */
+/* Returns the packet to fill in.                                  */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+void *SAMPLE_APP_TlmBegin(SAMPLE_APP_TlmPacket_t *Pkt, CFE_MSG_TelemetryHeader_t *Fallback, size_t Size)
+{
+    Pkt->SBBufPtr = CFE_SB_AllocateMessageBuffer(Size);
+    if (Pkt->SBBufPtr == NULL)
+    {
+        SAMPLE_APP_Data.TlmCopyCount++;
+        Pkt->MsgPtr = CFE_MSG_PTR(*Fallback);
+    }
+    else
+    {
+        /* Only the header is copied, the payload is built in place */
+        memcpy(Pkt->SBBufPtr, Fallback, sizeof(*Fallback));
+        Pkt->MsgPtr = &Pkt->SBBufPtr->Msg;
+    }
+
+    return Pkt->MsgPtr;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Timestamp and send a packet started by SAMPLE_APP_TlmBegin      */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+void SAMPLE_APP_TlmSend(SAMPLE_APP_TlmPacket_t *Pkt)
+{
+    CFE_SB_TimeStampMsg(Pkt->MsgPtr);
+
+    if (Pkt->SBBufPtr == NULL)
+    {
+        CFE_SB_TransmitMsg(Pkt->MsgPtr, true);
+    }
+    else if (CFE_SB_TransmitBuffer(Pkt->SBBufPtr, true) != CFE_SUCCESS)
+    {
+        /* The buffer is only handed over on success */
+        CFE_SB_ReleaseMessageBuffer(Pkt->SBBufPtr);
+    }
+
+    Pkt->SBBufPtr = NULL;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Drop a packet started by SAMPLE_APP_TlmBegin without sending it */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+void SAMPLE_APP_TlmDiscard(SAMPLE_APP_TlmPacket_t *Pkt)
+{
+    if (Pkt->SBBufPtr != NULL)
+    {
+        CFE_SB_ReleaseMessageBuffer(Pkt->SBBufPtr);
+    }
+
+    Pkt->SBBufPtr = NULL;
+}
@@ -0,0 +1,44 @@
+/************************************************************************
+ * NASA Docket No. GSC-18,719-1, and identified as “core Flight System: Bootes”
+ *
+ * Copyright (c) 2020 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/**
+ * @file
+ *   This file contains the prototypes for the Sample App telemetry transmit functions
+ *
+ * Packets are built directly in a buffer allocated from the software bus
+ * and handed over with no copy.  If no buffer is available the app's own
+ * copy of the packet is used and sent by copy instead.
+ *
+ * The dispatch statistics and admission control packets are the exception.
+ * Their counters accumulate in the app's copy between sends, so each send
+ * copies the payload into the buffer once, the same cost as a send by copy.
+ */
+
+#ifndef SAMPLE_APP_TLM_H
+#define SAMPLE_APP_TLM_H
+
+/*
+** Required header files.
+*/
+#include "sample_app.h"
+
+void *SAMPLE_APP_TlmBegin(SAMPLE_APP_TlmPacket_t *Pkt, CFE_MSG_TelemetryHeader_t *Fallback, size_t Size);
+void  SAMPLE_APP_TlmSend(SAMPLE_APP_TlmPacket_t *Pkt);
+void  SAMPLE_APP_TlmDiscard(SAMPLE_APP_TlmPacket_t *Pkt);
+
+#endif /* SAMPLE_APP_TLM_H */
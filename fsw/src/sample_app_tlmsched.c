@@ -0,0 +1,86 @@
+/************************************************************************
+ * NASA Docket No. GSC-18,719-1, and identified as “core Flight System: Bootes”
+ *
+ * Copyright (c) 2020 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/**
+ * \file
+ *   This file contains the source code for the Sample App telemetry scheduler.
+ */
+
+/*
+** Include Files:
+*/
+#include "sample_app.h"
+#include "sample_app_cmds.h"
+#include "sample_app_winstats.h"
+#include "sample_app_quantile.h"
+#include "sample_app_tlmsched.h"
+
+/*
+ * Every product is sent by a housekeeping request handler, called
+ * with the request that woke the scheduler
+ */
+typedef CFE_Status_t (*SAMPLE_APP_TlmProduct_t)(const SAMPLE_APP_SendHkCmd_t *Msg);
+
+typedef struct
+{
+    SAMPLE_APP_TlmProduct_t Product;
+    uint16                  Divisor; /**< Sent on one wakeup in this many */
+    uint16                  Slot;    /**< Which one, must be less than Divisor */
+} SAMPLE_APP_TlmScheduleEntry_t;
+
+/*
+ * Telemetry schedule.  Adding a product is one entry here.
+ */
+static const SAMPLE_APP_TlmScheduleEntry_t SAMPLE_APP_TLM_SCHEDULE[] = {
+    {SAMPLE_APP_SendHkCmd, SAMPLE_APP_HK_TLM_DIVISOR, SAMPLE_APP_HK_TLM_SLOT},
+    {SAMPLE_APP_SendStatsTlm, SAMPLE_APP_STATS_TLM_DIVISOR, SAMPLE_APP_STATS_TLM_SLOT},
+    {SAMPLE_APP_SendAdmitTlm, SAMPLE_APP_ADMIT_TLM_DIVISOR, SAMPLE_APP_ADMIT_TLM_SLOT},
+    {SAMPLE_APP_SendWinStatsTlm, SAMPLE_APP_WINSTATS_TLM_DIVISOR, SAMPLE_APP_WINSTATS_TLM_SLOT},
+    {SAMPLE_APP_SendQuantileTlm, SAMPLE_APP_QUANTILE_TLM_DIVISOR, SAMPLE_APP_QUANTILE_TLM_SLOT},
+};
+
+#define SAMPLE_APP_TLM_SCHEDULE_SIZE (sizeof(SAMPLE_APP_TLM_SCHEDULE) / sizeof(SAMPLE_APP_TLM_SCHEDULE[0]))
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Do the per-request upkeep, then send the telemetry products     */
+/* due on this wakeup                                              */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+CFE_Status_t SAMPLE_APP_TlmScheduleCmd(const SAMPLE_APP_SendHkCmd_t *Msg)
+{
+    const SAMPLE_APP_TlmScheduleEntry_t *Entry;
+    uint32                               i;
+
+    /* Table management runs on every wakeup, not just those that send housekeeping */
+    SAMPLE_APP_PerformHousekeeping();
+
+    for (i = 0; i < SAMPLE_APP_TLM_SCHEDULE_SIZE; ++i)
+    {
+        Entry = &SAMPLE_APP_TLM_SCHEDULE[i];
+
+        if (SAMPLE_APP_Data.TlmWakeupCount % Entry->Divisor == Entry->Slot)
+        {
+            Entry->Product(Msg);
+        }
+    }
+
+    ++SAMPLE_APP_Data.TlmWakeupCount;
+
+    return CFE_SUCCESS;
+}
@@ -0,0 +1,41 @@
+/************************************************************************
+ * NASA Docket No. GSC-18,719-1, and identified as “core Flight System: Bootes”
+ *
+ * Copyright (c) 2020 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/**
+ * @file
+ *   This file contains the prototypes for the Sample App telemetry scheduler
+ *
+ * Each housekeeping request is one wakeup of the scheduler, which first
+ * does the app's table management and other upkeep, then sends every
+ * telemetry product whose slot comes up in its divisor on that wakeup.
+ * Products sharing a divisor are given different slots so that they are
+ * spread over the wakeups rather than all sent on one.
+ */
+
+#ifndef SAMPLE_APP_TLMSCHED_H
+#define SAMPLE_APP_TLMSCHED_H
+
+/*
+** Required header files.
+*/
+#include "cfe_error.h"
+#include "sample_app_msg.h"
+
+CFE_Status_t SAMPLE_APP_TlmScheduleCmd(const SAMPLE_APP_SendHkCmd_t *Msg);
+
+#endif /* SAMPLE_APP_TLMSCHED_H */
@@ -0,0 +1,144 @@
+/************************************************************************
+ * NASA Docket No. GSC-18,719-1, and identified as “core Flight System: Bootes”
+ *
+ * Copyright (c) 2020 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/**
+ * \file
+ *   This file contains the source code for the Sample App binary trace functions
+ */
+
+/*
+** Include Files:
+*/
+#include "sample_app.h"
+#include "sample_app_eventids.h"
+#include "sample_app_trace.h"
+#include "sample_app_version.h"
+
+#define SAMPLE_APP_TRACE_MASK (SAMPLE_APP_TRACE_DEPTH - 1)
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Record an event with its raw arguments, callable from any task  */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+void SAMPLE_APP_Trace(uint16 EventID, const void *Args, size_t ArgSize)
+{
+    SAMPLE_APP_TraceRec_t *Rec;
+    uint32                 Pos;
+
+    Pos = __atomic_fetch_add(&SAMPLE_APP_Data.Trace.Head, 1, __ATOMIC_RELAXED);
+    Rec = &SAMPLE_APP_Data.Trace.Rec[Pos & SAMPLE_APP_TRACE_MASK];
+
+    /* Mark the record incomplete before any of it changes */
+    __atomic_store_n(&Rec->Seq, 0, __ATOMIC_RELAXED);
+    __atomic_thread_fence(__ATOMIC_RELEASE);
+
+    Rec->EventID = EventID;
+    Rec->Time    = CFE_TIME_GetTime();
+    if (Args != NULL)
+    {
+        memcpy(&Rec->Args, Args, (ArgSize < sizeof(Rec->Args)) ? ArgSize : sizeof(Rec->Args));
+    }
+
+    __atomic_store_n(&Rec->Seq, Pos + 1, __ATOMIC_RELEASE);
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Send the text for one trace record                              */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+static void SAMPLE_APP_TraceFormat(const SAMPLE_APP_TraceRec_t *Rec)
+{
+    switch (Rec->EventID)
+    {
+        case SAMPLE_APP_NOOP_INF_EID:
+            CFE_EVS_SendTimedEvent(Rec->Time, Rec->EventID, CFE_EVS_EventType_INFORMATION, "SAMPLE: NOOP command %s",
+                                   SAMPLE_APP_VERSION);
+            break;
+
+        case SAMPLE_APP_RESET_INF_EID:
+            CFE_EVS_SendTimedEvent(Rec->Time, Rec->EventID, CFE_EVS_EventType_INFORMATION, "SAMPLE: RESET command");
+            break;
+
+        case SAMPLE_APP_VALUE_INF_EID:
+            CFE_EVS_SendTimedEvent(Rec->Time, Rec->EventID, CFE_EVS_EventType_INFORMATION,
+                                   "SAMPLE_APP: ValU32=%lu, ValI16=%d, ValStr=%.*s",
+                                   (unsigned long)Rec->Args.DisplayParam.ValU32, (int)Rec->Args.DisplayParam.ValI16,
+                                   (int)sizeof(Rec->Args.DisplayParam.ValStr), Rec->Args.DisplayParam.ValStr);
+            break;
+
+        case SAMPLE_APP_TBL_VALUES_INF_EID:
+            CFE_ES_WriteToSysLog("Sample App: Example Table Value 1: %d  Value 2: %d  CRC: 0x%08lX",
+                                 Rec->Args.TblValues.Int1, Rec->Args.TblValues.Int2,
+                                 (unsigned long)Rec->Args.TblValues.Crc);
+            break;
+
+        default:
+            break;
+    }
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Format the oldest trace records, main task only                 */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+void SAMPLE_APP_TraceFlush(void)
+{
+    SAMPLE_APP_TraceLog_t *Trace = &SAMPLE_APP_Data.Trace;
+    SAMPLE_APP_TraceRec_t  Rec;
+    uint32                 Head;
+    uint32                 Seq;
+    uint32                 Count;
+
+    /* Records more than a ring behind have been overwritten */
+    Head = __atomic_load_n(&Trace->Head, __ATOMIC_ACQUIRE);
+    if (Head - Trace->Tail > SAMPLE_APP_TRACE_DEPTH)
+    {
+        Trace->LostCount += Head - Trace->Tail - SAMPLE_APP_TRACE_DEPTH;
+        Trace->Tail = Head - SAMPLE_APP_TRACE_DEPTH;
+    }
+
+    for (Count = 0; Count < SAMPLE_APP_TRACE_FLUSH_BUDGET && Trace->Tail != Head; ++Count)
+    {
+        /* Copy the record out, then confirm no writer touched it meanwhile */
+        Seq = __atomic_load_n(&Trace->Rec[Trace->Tail & SAMPLE_APP_TRACE_MASK].Seq, __ATOMIC_ACQUIRE);
+        memcpy(&Rec, &Trace->Rec[Trace->Tail & SAMPLE_APP_TRACE_MASK], sizeof(Rec));
+        __atomic_thread_fence(__ATOMIC_ACQUIRE);
+
+        if (Seq != __atomic_load_n(&Trace->Rec[Trace->Tail & SAMPLE_APP_TRACE_MASK].Seq, __ATOMIC_RELAXED) ||
+            (int32)(Seq - (Trace->Tail + 1)) < 0)
+        {
+            /* Still being written, left for the next cycle */
+            break;
+        }
+
+        if (Seq != Trace->Tail + 1)
+        {
+            /* Overwritten by a writer that has lapped the ring */
+            ++Trace->LostCount;
+        }
+        else
+        {
+            SAMPLE_APP_TraceFormat(&Rec);
+        }
+
+        ++Trace->Tail;
+    }
+}
@@ -28,6 +28,11 @@
 #include "sample_app_eventids.h"
 #include "sample_app_tbl.h"
 #include "sample_app_utils.h"
+#include "sample_app_tblcopy.h"
+#include "sample_app_crc.h"
+#include "sample_app_fir.h"
+#include "sample_app_range.h"
+#include "sample_app_sensor.h"
 
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 /*                                                                 */
@@ -38,6 +43,8 @@ CFE_Status_t SAMPLE_APP_TblValidationFunc(void *TblData)
 {
     CFE_Status_t               ReturnCode = CFE_SUCCESS;
     SAMPLE_APP_ExampleTable_t *TblDataPtr = (SAMPLE_APP_ExampleTable_t *)TblData;
+    uint32                     Unused;
+    uint32                     BadIdx;
 
     /*
     ** Sample Example Table Validation
@@ -47,29 +54,276 @@ CFE_Status_t SAMPLE_APP_TblValidationFunc(void *TblData)
         /* First element is out of range, return an appropriate error code */
         ReturnCode = SAMPLE_APP_TABLE_OUT_OF_RANGE_ERR_CODE;
     }
+    else if (TblDataPtr->NumRecords > SAMPLE_APP_TBL_MAX_RECORDS)
+    {
+        /* More records claimed than the table holds */
+        ReturnCode = SAMPLE_APP_TABLE_OUT_OF_RANGE_ERR_CODE;
+    }
+    else if (TblDataPtr->FirNumTaps > SAMPLE_APP_FIR_MAX_TAPS ||
+             SAMPLE_APP_FirGain(TblDataPtr->FirCoeff, TblDataPtr->FirNumTaps) > SAMPLE_APP_FIR_UNITY_GAIN)
+    {
+        /* Too many taps, or enough gain that the filter sums could overflow */
+        ReturnCode = SAMPLE_APP_TABLE_OUT_OF_RANGE_ERR_CODE;
+    }
+    else
+    {
+        /* Taps past those in use must be 0, so a tap count set too low is not taken as a shorter filter */
+        Unused = SAMPLE_APP_FIR_MAX_TAPS - TblDataPtr->FirNumTaps;
+        BadIdx = SAMPLE_APP_RangeCheckS16(&TblDataPtr->FirCoeff[TblDataPtr->FirNumTaps], Unused, 0, 0);
+        if (BadIdx < Unused)
+        {
+            BadIdx += TblDataPtr->FirNumTaps;
+            CFE_EVS_SendEvent(SAMPLE_APP_TBL_FIR_ERR_EID, CFE_EVS_EventType_ERROR,
+                              "Sample App: Example Table filter tap %lu is %d, past the %u in use",
+                              (unsigned long)BadIdx, (int)TblDataPtr->FirCoeff[BadIdx],
+                              (unsigned int)TblDataPtr->FirNumTaps);
+            ReturnCode = SAMPLE_APP_TABLE_OUT_OF_RANGE_ERR_CODE;
+        }
+    }
 
     return ReturnCode;
 }
 
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 /*                                                                 */
-/* Output CRC                                                      */
+/* Check the next batch of example table records, resuming from    */
+/* Cursor.  The record count is bounded by the validation function */
+/* above, which runs inside CFE_TBL_Manage and so must stay O(1).  */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+CFE_Status_t SAMPLE_APP_TblCheckRecords(const SAMPLE_APP_ExampleTable_t *TblPtr, uint16 *Cursor)
+{
+    uint32 End = (uint32)*Cursor + SAMPLE_APP_TBL_CHECK_BUDGET;
+
+    if (End > TblPtr->NumRecords)
+    {
+        End = TblPtr->NumRecords;
+    }
+
+    while (*Cursor < End)
+    {
+        if (TblPtr->Record[*Cursor].Value > SAMPLE_APP_TBL_RECORD_VALUE_MAX)
+        {
+            /* Leave the cursor on the failing record for the caller to report */
+            return SAMPLE_APP_TABLE_OUT_OF_RANGE_ERR_CODE;
+        }
+
+        ++(*Cursor);
+    }
+
+    if (*Cursor < TblPtr->NumRecords)
+    {
+        return SAMPLE_APP_TABLE_CHECK_PENDING;
+    }
+
+    return CFE_SUCCESS;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Compute, cache and output the CRC of the held example table    */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+void SAMPLE_APP_GetCrc(void)
+{
+    if (SAMPLE_APP_Data.ExampleTblPtr == NULL)
+    {
+        SAMPLE_APP_Data.ExampleTblCrc = 0;
+        CFE_ES_WriteToSysLog("Sample App: Example Table not available for CRC");
+    }
+    else
+    {
+        SAMPLE_APP_Data.ExampleTblCrc =
+            SAMPLE_APP_Crc32c(0, SAMPLE_APP_Data.ExampleTblPtr, sizeof(*SAMPLE_APP_Data.ExampleTblPtr));
+        CFE_ES_WriteToSysLog("Sample App: CRC: 0x%08lX\n\n", (unsigned long)SAMPLE_APP_Data.ExampleTblCrc);
+    }
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Spend one cycle's budget on the pending record check, and       */
+/* publish the load to readers once it has all been checked.       */
+/* CFE_TBL_Manage has already made a failing load active, so it is */
+/* dropped and the last published image loaded back in its place. */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+static void SAMPLE_APP_ContinueTableCheck(void)
+{
+    CFE_Status_t                  status;
+    const SAMPLE_APP_TableCopy_t *LastGood;
+
+    status = SAMPLE_APP_TblCheckRecords(SAMPLE_APP_Data.ExampleTblPtr, &SAMPLE_APP_Data.TblCheckCursor);
+    if (status == CFE_SUCCESS)
+    {
+        SAMPLE_APP_Data.TblCheckPending = false;
+        SAMPLE_APP_PublishTableCopy(SAMPLE_APP_Data.ExampleTblPtr);
+        SAMPLE_APP_SensorSetFilter(SAMPLE_APP_Data.ExampleTblPtr);
+    }
+    else if (status == SAMPLE_APP_TABLE_OUT_OF_RANGE_ERR_CODE)
+    {
+        /* Readers keep the last good copy, and the rejected image is no longer held */
+        SAMPLE_APP_Data.TblCheckPending = false;
+        SAMPLE_APP_Data.TblRejected     = true;
+        SAMPLE_APP_ReleaseExampleTable();
+
+        LastGood = SAMPLE_APP_Data.TblCopyActive;
+        if (LastGood == NULL)
+        {
+            CFE_EVS_SendEvent(SAMPLE_APP_TBL_RECORD_ERR_EID, CFE_EVS_EventType_ERROR,
+                              "Sample App: Example table record %u out of range, no good load to revert to",
+                              (unsigned int)SAMPLE_APP_Data.TblCheckCursor);
+        }
+        else
+        {
+            CFE_EVS_SendEvent(SAMPLE_APP_TBL_RECORD_ERR_EID, CFE_EVS_EventType_ERROR,
+                              "Sample App: Example table record %u out of range, reverting to last good load",
+                              (unsigned int)SAMPLE_APP_Data.TblCheckCursor);
+
+            status = CFE_TBL_Load(SAMPLE_APP_Data.TblHandles[0], CFE_TBL_SRC_ADDRESS, &LastGood->Tbl);
+            if (status != CFE_SUCCESS)
+            {
+                CFE_ES_WriteToSysLog("Sample App: Error Reverting Example Table, RC = 0x%08lX\n",
+                                     (unsigned long)status);
+            }
+        }
+    }
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Lock the example table and cache its address                    */
 /*                                                                 */
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
-void SAMPLE_APP_GetCrc(const char *TableName)
+CFE_Status_t SAMPLE_APP_AcquireExampleTable(void)
 {
-    CFE_Status_t   status;
-    uint32         Crc;
-    CFE_TBL_Info_t TblInfoPtr;
+    CFE_Status_t status;
+    void *       TblAddr = NULL;
 
-    status = CFE_TBL_GetInfo(&TblInfoPtr, TableName);
-    if (status != CFE_SUCCESS)
+    status = CFE_TBL_GetAddress(&TblAddr, SAMPLE_APP_Data.TblHandles[0]);
+    if (status == CFE_TBL_INFO_UPDATED)
+    {
+        /* New contents since the last acquire, refresh the cached info and restart the record check */
+        SAMPLE_APP_Data.ExampleTblPtr   = TblAddr;
+        SAMPLE_APP_Data.TblCheckPending = true;
+        SAMPLE_APP_Data.TblRejected     = false;
+        SAMPLE_APP_Data.TblCheckCursor  = 0;
+        SAMPLE_APP_Data.ScrubOffset     = 0;
+        SAMPLE_APP_Data.ScrubCrc        = 0;
+        SAMPLE_APP_GetCrc();
+    }
+    else if (status == CFE_SUCCESS)
     {
-        CFE_ES_WriteToSysLog("Sample App: Error Getting Example Table Info");
+        SAMPLE_APP_Data.ExampleTblPtr = TblAddr;
     }
     else
     {
-        Crc = TblInfoPtr.Crc;
-        CFE_ES_WriteToSysLog("Sample App: CRC: 0x%08lX\n\n", (unsigned long)Crc);
+        SAMPLE_APP_Data.ExampleTblPtr = NULL;
+        CFE_ES_WriteToSysLog("Sample App: Fail to get table address: 0x%08lx", (unsigned long)status);
+    }
+
+    if (SAMPLE_APP_Data.ExampleTblPtr != NULL && SAMPLE_APP_Data.TblCheckPending)
+    {
+        SAMPLE_APP_ContinueTableCheck();
+    }
+
+    /* A rejected load stays active in table services until replaced, but is not handed out */
+    if (SAMPLE_APP_Data.TblRejected)
+    {
+        SAMPLE_APP_ReleaseExampleTable();
+    }
+
+    return status;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Unlock the example table, if held                               */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+void SAMPLE_APP_ReleaseExampleTable(void)
+{
+    CFE_Status_t status;
+
+    if (SAMPLE_APP_Data.ExampleTblPtr != NULL)
+    {
+        SAMPLE_APP_Data.ExampleTblPtr = NULL;
+
+        status = CFE_TBL_ReleaseAddress(SAMPLE_APP_Data.TblHandles[0]);
+        if (status != CFE_SUCCESS)
+        {
+            CFE_ES_WriteToSysLog("Sample App: Fail to release table address: 0x%08lx", (unsigned long)status);
+        }
     }
 }
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Re-checksum the next slice of the held example table image and  */
+/* compare against the load CRC at the end of each pass.           */
+/* Returns true if a completed pass found the image corrupted.     */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+bool SAMPLE_APP_ScrubExampleTable(void)
+{
+    const uint8 *      Image     = (const uint8 *)SAMPLE_APP_Data.ExampleTblPtr;
+    bool               Corrupted = false;
+    size_t             Len;
+    CFE_TIME_SysTime_t StartTime;
+    CFE_TIME_SysTime_t Elapsed;
+
+    /* A load still being checked is not published yet, so its CRC is not scrubbed either */
+    if (Image == NULL || SAMPLE_APP_Data.TblCheckPending)
+    {
+        SAMPLE_APP_Data.LastScrubTime = 0;
+        return false;
+    }
+
+    StartTime = CFE_TIME_GetTime();
+
+    Len = sizeof(*SAMPLE_APP_Data.ExampleTblPtr) - SAMPLE_APP_Data.ScrubOffset;
+    if (Len > SAMPLE_APP_SCRUB_BYTES_PER_CYCLE)
+    {
+        Len = SAMPLE_APP_SCRUB_BYTES_PER_CYCLE;
+    }
+
+    SAMPLE_APP_Data.ScrubCrc = SAMPLE_APP_Crc32c(SAMPLE_APP_Data.ScrubCrc, &Image[SAMPLE_APP_Data.ScrubOffset], Len);
+    SAMPLE_APP_Data.ScrubOffset += Len;
+
+    if (SAMPLE_APP_Data.ScrubOffset >= sizeof(*SAMPLE_APP_Data.ExampleTblPtr))
+    {
+        if (SAMPLE_APP_Data.ScrubCrc != SAMPLE_APP_Data.ExampleTblCrc)
+        {
+            Corrupted = true;
+            SAMPLE_APP_Data.ScrubErrorCount++;
+            CFE_EVS_SendEvent(SAMPLE_APP_TBL_SCRUB_ERR_EID, CFE_EVS_EventType_ERROR,
+                              "Sample App: Example table scrub CRC 0x%08lX does not match load CRC 0x%08lX",
+                              (unsigned long)SAMPLE_APP_Data.ScrubCrc, (unsigned long)SAMPLE_APP_Data.ExampleTblCrc);
+        }
+
+        SAMPLE_APP_Data.ScrubPassCount++;
+        SAMPLE_APP_Data.ScrubOffset = 0;
+        SAMPLE_APP_Data.ScrubCrc    = 0;
+    }
+
+    Elapsed                       = CFE_TIME_Subtract(CFE_TIME_GetTime(), StartTime);
+    SAMPLE_APP_Data.LastScrubTime = (Elapsed.Seconds * 1000000) + CFE_TIME_Sub2MicroSecs(Elapsed.Subseconds);
+
+    return Corrupted;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Decode the message header fields used along the dispatch path   */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+void SAMPLE_APP_DecodeMsgHeader(const CFE_SB_Buffer_t *SBBufPtr, SAMPLE_APP_MsgContext_t *MsgCtx)
+{
+    MsgCtx->RcvTime = CFE_TIME_GetTime();
+    MsgCtx->MsgId   = CFE_SB_INVALID_MSG_ID;
+    MsgCtx->FcnCode = 0;
+    MsgCtx->MsgSize = 0;
+
+    CFE_MSG_GetMsgId(&SBBufPtr->Msg, &MsgCtx->MsgId);
+    CFE_MSG_GetFcnCode(&SBBufPtr->Msg, &MsgCtx->FcnCode);
+    CFE_MSG_GetSize(&SBBufPtr->Msg, &MsgCtx->MsgSize);
+}
@@ -30,6 +30,11 @@
 #include "sample_app.h"
 
 CFE_Status_t SAMPLE_APP_TblValidationFunc(void *TblData);
-void         SAMPLE_APP_GetCrc(const char *TableName);
+CFE_Status_t SAMPLE_APP_TblCheckRecords(const SAMPLE_APP_ExampleTable_t *TblPtr, uint16 *Cursor);
+void         SAMPLE_APP_GetCrc(void);
+CFE_Status_t SAMPLE_APP_AcquireExampleTable(void);
+void         SAMPLE_APP_ReleaseExampleTable(void);
+bool         SAMPLE_APP_ScrubExampleTable(void);
+void         SAMPLE_APP_DecodeMsgHeader(const CFE_SB_Buffer_t *SBBufPtr, SAMPLE_APP_MsgContext_t *MsgCtx);
 
 #endif /* SAMPLE_APP_UTILS_H */
\ No newline at end of file
@@ -0,0 +1,188 @@
+/************************************************************************
+ * NASA Docket No. GSC-18,719-1, and identified as “core Flight System: Bootes”
+ *
+ * Copyright (c) 2020 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/**
+ * \file
+ *   This file contains the source code for the Sample App sensor window statistics functions
+ */
+
+/*
+** Include Files:
+*/
+#include "sample_app.h"
+#include "sample_app_tlm.h"
+#include "sample_app_winstats.h"
+
+#define SAMPLE_APP_SENSOR_RING_MASK (SAMPLE_APP_SENSOR_RING_DEPTH - 1)
+
+/*
+ * Length of each statistics window, in samples
+ */
+static const uint16 SAMPLE_APP_WINDOW_SAMPLES[SAMPLE_APP_SENSOR_STAT_WINDOWS] = SAMPLE_APP_SENSOR_WINDOW_SAMPLES;
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Drop the head of a deque if it is the sample leaving the window */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+static inline void SAMPLE_APP_DequeExpire(SAMPLE_APP_MonoDeque_t *Q, uint16 LeavingPos)
+{
+    if (Q->Head != Q->Tail && Q->Pos[Q->Head & SAMPLE_APP_SENSOR_RING_MASK] == LeavingPos)
+    {
+        ++Q->Head;
+    }
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Add a sample to the tail of a deque, first removing the samples */
+/* it makes irrelevant: any no smaller for a minimum, or no larger */
+/* for a maximum, as they leave the window before it does          */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+static inline void SAMPLE_APP_DequePush(SAMPLE_APP_MonoDeque_t *Q, const int16 *Ring, uint16 Pos, int16 Value,
+                                        bool IsMax)
+{
+    int16 Prev;
+
+    while (Q->Head != Q->Tail)
+    {
+        Prev = Ring[Q->Pos[(Q->Tail - 1) & SAMPLE_APP_SENSOR_RING_MASK]];
+
+        if (IsMax ? (Prev > Value) : (Prev < Value))
+        {
+            break;
+        }
+
+        --Q->Tail;
+    }
+
+    Q->Pos[Q->Tail & SAMPLE_APP_SENSOR_RING_MASK] = Pos;
+    ++Q->Tail;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Add filtered samples of one channel, oldest first, to its ring  */
+/* and update the statistics of every window                       */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+void SAMPLE_APP_WinStatsAdd(uint16 Channel, const int16 *Sample, uint32 NumSamples)
+{
+    SAMPLE_APP_SensorHistory_t *Hist = &SAMPLE_APP_Data.SensorHistory[Channel];
+    SAMPLE_APP_SensorWindow_t * Win;
+    uint32                      i;
+    uint16                      w;
+    uint16                      Pos;
+    uint16                      LeavingPos;
+    int16                       Leaving;
+    int16                       Value;
+
+    for (i = 0; i < NumSamples; ++i)
+    {
+        Value = Sample[i];
+        Pos   = Hist->Next & SAMPLE_APP_SENSOR_RING_MASK;
+
+        for (w = 0; w < SAMPLE_APP_SENSOR_STAT_WINDOWS; ++w)
+        {
+            Win = &Hist->Window[w];
+
+            /*
+             * Once the window is full its oldest sample leaves as this one
+             * enters.  It is read before the new sample is stored, as for the
+             * longest window they share a ring slot.
+             */
+            if (Hist->Fill >= SAMPLE_APP_WINDOW_SAMPLES[w])
+            {
+                LeavingPos = (Hist->Next - SAMPLE_APP_WINDOW_SAMPLES[w]) & SAMPLE_APP_SENSOR_RING_MASK;
+                Leaving    = Hist->Ring[LeavingPos];
+
+                Win->Sum -= Leaving;
+                Win->SumSq -= (uint32)(Leaving * Leaving);
+                SAMPLE_APP_DequeExpire(&Win->MinQ, LeavingPos);
+                SAMPLE_APP_DequeExpire(&Win->MaxQ, LeavingPos);
+            }
+
+            Win->Sum += Value;
+            Win->SumSq += (uint32)(Value * Value);
+            SAMPLE_APP_DequePush(&Win->MinQ, Hist->Ring, Pos, Value, false);
+            SAMPLE_APP_DequePush(&Win->MaxQ, Hist->Ring, Pos, Value, true);
+        }
+
+        Hist->Ring[Pos] = Value;
+        ++Hist->Next;
+
+        if (Hist->Fill < SAMPLE_APP_SENSOR_RING_DEPTH)
+        {
+            ++Hist->Fill;
+        }
+    }
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Send the sensor window statistics packet, on its telemetry      */
+/* schedule slot                                                   */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+CFE_Status_t SAMPLE_APP_SendWinStatsTlm(const SAMPLE_APP_SendHkCmd_t *Msg)
+{
+    const SAMPLE_APP_SensorHistory_t *Hist;
+    const SAMPLE_APP_SensorWindow_t * Win;
+    SAMPLE_APP_TlmPacket_t            Pkt;
+    SAMPLE_APP_WinStatsTlm_t *        WinStatsTlm;
+    SAMPLE_APP_WindowStats_t *        Stats;
+    uint16                            Channel;
+    uint16                            w;
+    uint16                            Count;
+    uint64                            SpreadSq;
+
+    WinStatsTlm = SAMPLE_APP_TlmBegin(&Pkt, &SAMPLE_APP_Data.WinStatsTlm.TelemetryHeader,
+                                      sizeof(SAMPLE_APP_WinStatsTlm_t));
+    memset(&WinStatsTlm->Payload, 0, sizeof(WinStatsTlm->Payload));
+
+    for (Channel = 0; Channel < SAMPLE_APP_SENSOR_CHANNELS; ++Channel)
+    {
+        Hist = &SAMPLE_APP_Data.SensorHistory[Channel];
+
+        for (w = 0; w < SAMPLE_APP_SENSOR_STAT_WINDOWS; ++w)
+        {
+            Win   = &Hist->Window[w];
+            Stats = &WinStatsTlm->Payload.Window[Channel][w];
+            Count = Hist->Fill < SAMPLE_APP_WINDOW_SAMPLES[w] ? Hist->Fill : SAMPLE_APP_WINDOW_SAMPLES[w];
+
+            Stats->Length = SAMPLE_APP_WINDOW_SAMPLES[w];
+            Stats->Count  = Count;
+
+            if (Count > 0)
+            {
+                /* Count * SumSq - Sum^2 is exact in 64 bits and never negative */
+                SpreadSq = Count * Win->SumSq - (uint64)((int64)Win->Sum * Win->Sum);
+
+                Stats->Min      = Hist->Ring[Win->MinQ.Pos[Win->MinQ.Head & SAMPLE_APP_SENSOR_RING_MASK]];
+                Stats->Max      = Hist->Ring[Win->MaxQ.Pos[Win->MaxQ.Head & SAMPLE_APP_SENSOR_RING_MASK]];
+                Stats->Mean     = (float)((double)Win->Sum / Count);
+                Stats->Variance = (float)((double)SpreadSq / ((double)Count * Count));
+            }
+        }
+    }
+
+    SAMPLE_APP_TlmSend(&Pkt);
+
+    return CFE_SUCCESS;
+}
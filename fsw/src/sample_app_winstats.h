@@ -0,0 +1,40 @@
+/************************************************************************
+ * NASA Docket No. GSC-18,719-1, and identified as “core Flight System: Bootes”
+ *
+ * Copyright (c) 2020 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/**
+ * @file
+ *   This file contains the prototypes for the Sample App sensor window statistics functions
+ *
+ * The filtered samples of each channel are kept in a ring, and the mean,
+ * variance, minimum and maximum over the newest samples are kept current
+ * for each configured window length as every sample arrives, at constant
+ * cost per sample and window.  The statistics packet reports them all.
+ */
+
+#ifndef SAMPLE_APP_WINSTATS_H
+#define SAMPLE_APP_WINSTATS_H
+
+/*
+** Required header files.
+*/
+#include "sample_app.h"
+
+void         SAMPLE_APP_WinStatsAdd(uint16 Channel, const int16 *Sample, uint32 NumSamples);
+CFE_Status_t SAMPLE_APP_SendWinStatsTlm(const SAMPLE_APP_SendHkCmd_t *Msg);
+
+#endif /* SAMPLE_APP_WINSTATS_H */
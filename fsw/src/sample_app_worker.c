@@ -0,0 +1,247 @@
+/************************************************************************
+ * NASA Docket No. GSC-18,719-1, and identified as “core Flight System: Bootes”
+ *
+ * Copyright (c) 2020 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/**
+ * \file
+ *   This file contains the source code for the Sample App worker task functions
+ */
+
+/*
+** Include Files:
+*/
+#include "sample_app.h"
+#include "sample_app_eventids.h"
+#include "sample_app_tblcopy.h"
+#include "sample_app_trace.h"
+#include "sample_app_worker.h"
+
+/* The sample_lib module provides the SAMPLE_Function() prototype */
+#include "sample_lib.h"
+
+#include <stdio.h>
+
+/*
+ * Ring indices are shared between the main task and a worker, so they
+ * are accessed with compiler atomics to get the required memory ordering.
+ */
+#define SAMPLE_APP_ATOMIC_LOAD(Ptr)       __atomic_load_n((Ptr), __ATOMIC_ACQUIRE)
+#define SAMPLE_APP_ATOMIC_STORE(Ptr, Val) __atomic_store_n((Ptr), (Val), __ATOMIC_RELEASE)
+
+#define SAMPLE_APP_WORKER_RING_MASK (SAMPLE_APP_WORKER_RING_DEPTH - 1)
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Number of jobs waiting in a worker's ring                       */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+static uint32 SAMPLE_APP_WorkerQueueDepth(SAMPLE_APP_Worker_t *Worker)
+{
+    return SAMPLE_APP_ATOMIC_LOAD(&Worker->Ring.Head) - SAMPLE_APP_ATOMIC_LOAD(&Worker->Ring.Tail);
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Create the worker wake semaphores and child tasks               */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+CFE_Status_t SAMPLE_APP_WorkerInit(void)
+{
+    CFE_Status_t status = CFE_SUCCESS;
+    int32        OsStatus;
+    uint32       i;
+    char         Name[OS_MAX_API_NAME];
+
+    SAMPLE_APP_Data.LastHkTime = CFE_TIME_GetTime();
+
+    for (i = 0; i < SAMPLE_APP_NUM_WORKERS && status == CFE_SUCCESS; ++i)
+    {
+        snprintf(Name, sizeof(Name), "%s_%lu", SAMPLE_APP_WORKER_NAME, (unsigned long)i);
+
+        OsStatus = OS_CountSemCreate(&SAMPLE_APP_Data.Worker[i].WakeSemId, Name, 0, 0);
+        if (OsStatus != OS_SUCCESS)
+        {
+            status = CFE_STATUS_EXTERNAL_RESOURCE_FAIL;
+        }
+        else
+        {
+            status = CFE_ES_CreateChildTask(&SAMPLE_APP_Data.Worker[i].TaskId, Name, SAMPLE_APP_WorkerMain, NULL,
+                                            SAMPLE_APP_WORKER_STACK_SIZE, SAMPLE_APP_WORKER_PRIORITY, 0);
+        }
+
+        if (status != CFE_SUCCESS)
+        {
+            CFE_EVS_SendEvent(SAMPLE_APP_WORKER_ERR_EID, CFE_EVS_EventType_ERROR,
+                              "Sample App: Error starting worker %lu, RC = 0x%08lX", (unsigned long)i,
+                              (unsigned long)status);
+        }
+    }
+
+    return status;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Queue a job to the least loaded worker, main task only          */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+CFE_Status_t SAMPLE_APP_WorkerSubmit(const SAMPLE_APP_ProcessCmd_t *Msg)
+{
+    SAMPLE_APP_Worker_t *Worker = &SAMPLE_APP_Data.Worker[0];
+    uint32               Depth  = SAMPLE_APP_WorkerQueueDepth(Worker);
+    uint32               Head;
+    uint32               i;
+
+    for (i = 1; i < SAMPLE_APP_NUM_WORKERS; ++i)
+    {
+        if (SAMPLE_APP_WorkerQueueDepth(&SAMPLE_APP_Data.Worker[i]) < Depth)
+        {
+            Worker = &SAMPLE_APP_Data.Worker[i];
+            Depth  = SAMPLE_APP_WorkerQueueDepth(Worker);
+        }
+    }
+
+    if (Depth >= SAMPLE_APP_WORKER_RING_DEPTH)
+    {
+        return SAMPLE_APP_WORKER_QUEUE_FULL_ERR_CODE;
+    }
+
+    /* Fill the slot before publishing it to the worker by advancing Head */
+    Head = Worker->Ring.Head;
+    memcpy(&Worker->Ring.Job[Head & SAMPLE_APP_WORKER_RING_MASK], Msg, sizeof(*Msg));
+    SAMPLE_APP_ATOMIC_STORE(&Worker->Ring.Head, Head + 1);
+
+    if (Depth + 1 > Worker->PeakQueueDepth)
+    {
+        Worker->PeakQueueDepth = Depth + 1;
+    }
+
+    OS_CountSemGive(Worker->WakeSemId);
+
+    return CFE_SUCCESS;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Worker child task entry point                                   */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+void SAMPLE_APP_WorkerMain(void)
+{
+    SAMPLE_APP_Worker_t *   Worker;
+    SAMPLE_APP_ProcessCmd_t Job;
+    uint32                  Tail;
+    CFE_TIME_SysTime_t      StartTime;
+    CFE_TIME_SysTime_t      Elapsed;
+
+    /* Workers take their slot in start order, as the entry point has no argument */
+    Worker = &SAMPLE_APP_Data.Worker[__atomic_fetch_add(&SAMPLE_APP_Data.WorkerStartCount, 1, __ATOMIC_RELAXED) %
+                                     SAMPLE_APP_NUM_WORKERS];
+
+    /* Each give of the semaphore matches one job pushed to the ring */
+    while (OS_CountSemTake(Worker->WakeSemId) == OS_SUCCESS)
+    {
+        /* Copy the job out, then release the slot back to the main task */
+        Tail = Worker->Ring.Tail;
+        memcpy(&Job, &Worker->Ring.Job[Tail & SAMPLE_APP_WORKER_RING_MASK], sizeof(Job));
+        SAMPLE_APP_ATOMIC_STORE(&Worker->Ring.Tail, Tail + 1);
+
+        StartTime = CFE_TIME_GetTime();
+        SAMPLE_APP_ProcessJob(&Job);
+        Elapsed = CFE_TIME_Subtract(CFE_TIME_GetTime(), StartTime);
+
+        Worker->BusyTime += (Elapsed.Seconds * 1000000) + CFE_TIME_Sub2MicroSecs(Elapsed.Subseconds);
+        Worker->CompletedCount++;
+    }
+
+    CFE_ES_ExitChildTask();
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Process command work, run by a worker task                      */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+CFE_Status_t SAMPLE_APP_ProcessJob(const SAMPLE_APP_ProcessCmd_t *Msg)
+{
+    const SAMPLE_APP_TableCopy_t *Copy;
+    uint32                        Token;
+    SAMPLE_APP_TraceTblValues_t   Values;
+
+    /* Sample use of the example table, through the copy published for readers outside the main task */
+    do
+    {
+        Copy = SAMPLE_APP_TableCopyBegin(&Token);
+        if (Copy == NULL)
+        {
+            CFE_ES_WriteToSysLog("Sample App: Example Table not available");
+            return CFE_TBL_ERR_NEVER_LOADED;
+        }
+
+        Values.Int1 = Copy->Tbl.Int1;
+        Values.Int2 = Copy->Tbl.Int2;
+        Values.Crc  = Copy->Crc;
+    } while (!SAMPLE_APP_TableCopyValid(Token));
+
+    SAMPLE_APP_Trace(SAMPLE_APP_TBL_VALUES_INF_EID, &Values, sizeof(Values));
+
+    /* Invoke a function provided by SAMPLE_APP_LIB */
+    SAMPLE_LIB_Function();
+
+    return CFE_SUCCESS;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Fill in the worker statistics of the housekeeping packet        */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+void SAMPLE_APP_UpdateWorkerStats(SAMPLE_APP_HkTlm_Payload_t *Payload)
+{
+    SAMPLE_APP_Worker_t *     Worker;
+    SAMPLE_APP_WorkerStats_t *Stats;
+    CFE_TIME_SysTime_t        Now;
+    CFE_TIME_SysTime_t        Interval;
+    uint64                    IntervalTime;
+    uint64                    Utilization;
+    uint32                    BusyTime;
+    uint32                    i;
+
+    Now                        = CFE_TIME_GetTime();
+    Interval                   = CFE_TIME_Subtract(Now, SAMPLE_APP_Data.LastHkTime);
+    IntervalTime               = ((uint64)Interval.Seconds * 1000000) + CFE_TIME_Sub2MicroSecs(Interval.Subseconds);
+    SAMPLE_APP_Data.LastHkTime = Now;
+
+    for (i = 0; i < SAMPLE_APP_NUM_WORKERS; ++i)
+    {
+        Worker = &SAMPLE_APP_Data.Worker[i];
+        Stats  = &Payload->Worker[i];
+
+        BusyTime    = __atomic_load_n(&Worker->BusyTime, __ATOMIC_RELAXED);
+        Utilization = 0;
+        if (IntervalTime > 0)
+        {
+            Utilization = ((uint64)(BusyTime - Worker->LastBusyTime) * 10000) / IntervalTime;
+        }
+        Worker->LastBusyTime = BusyTime;
+
+        Stats->QueueDepth     = SAMPLE_APP_WorkerQueueDepth(Worker);
+        Stats->PeakQueueDepth = Worker->PeakQueueDepth;
+        Stats->CompletedCount = __atomic_load_n(&Worker->CompletedCount, __ATOMIC_RELAXED);
+        Stats->Utilization    = (Utilization > 10000) ? 10000 : Utilization;
+    }
+}
@@ -0,0 +1,43 @@
+/************************************************************************
+ * NASA Docket No. GSC-18,719-1, and identified as “core Flight System: Bootes”
+ *
+ * Copyright (c) 2020 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/**
+ * @file
+ *   This file contains the prototypes for the Sample App worker task functions
+ *
+ * Heavy commands are queued by the main task to a pool of worker child
+ * tasks through one lock-free single-producer/single-consumer ring per
+ * worker.  A counting semaphore per worker only wakes it; the ring
+ * itself is never locked.
+ */
+
+#ifndef SAMPLE_APP_WORKER_H
+#define SAMPLE_APP_WORKER_H
+
+/*
+** Required header files.
+*/
+#include "sample_app.h"
+
+CFE_Status_t SAMPLE_APP_WorkerInit(void);
+CFE_Status_t SAMPLE_APP_WorkerSubmit(const SAMPLE_APP_ProcessCmd_t *Msg);
+void         SAMPLE_APP_WorkerMain(void);
+CFE_Status_t SAMPLE_APP_ProcessJob(const SAMPLE_APP_ProcessCmd_t *Msg);
+void         SAMPLE_APP_UpdateWorkerStats(SAMPLE_APP_HkTlm_Payload_t *Payload);
+
+#endif /* SAMPLE_APP_WORKER_H */
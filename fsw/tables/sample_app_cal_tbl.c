@@ -0,0 +1,45 @@
+/************************************************************************
+ * NASA Docket No. GSC-18,719-1, and identified as “core Flight System: Bootes”
+ *
+ * Copyright (c) 2020 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+#include "cfe_tbl_filedef.h" /* Required to obtain the CFE_TBL_FILEDEF macro definition */
+#include "sample_app_tbl.h"
+
+/*
+** Default curves, one of each type.  Channel 0 reports raw counts.
+** Channel 1 is a +/-10 V input at full scale.  Channel 2 is a
+** temperature sensor given by breakpoints, which are best put on
+** multiples of 256 counts where the lookup table is exact.  Channel 3
+** is a pressure sensor with a small square law term.
+*/
+SAMPLE_APP_CalTable_t CalibrationTable = {
+    .Channel = {{.Type = SAMPLE_APP_CAL_TYPE_NONE},
+                {.Type = SAMPLE_APP_CAL_TYPE_POLY, .NumPoints = 2, .Eng = {0.0f, 10.0f / 32768}},
+                {.Type      = SAMPLE_APP_CAL_TYPE_PIECEWISE,
+                 .NumPoints = 5,
+                 .Raw       = {-16384, -4096, 0, 4096, 16384},
+                 .Eng       = {-55.0f, -20.0f, 0.0f, 25.0f, 125.0f}},
+                {.Type = SAMPLE_APP_CAL_TYPE_POLY, .NumPoints = 3, .Eng = {-1.5f, 2.0e-3f, 1.0e-8f}}}};
+
+/*
+** The macro below identifies:
+**    1) the data structure type to use as the table image format
+**    2) the name of the table to be placed into the cFE Example Table File Header
+**    3) a brief description of the contents of the file image
+**    4) the desired name of the table image binary file that is cFE compatible
+*/
+CFE_TBL_FILEDEF(CalibrationTable, SAMPLE_APP.CalibrationTable, Sensor Calibration Table, sample_app_cal_tbl.tbl)
@@ -0,0 +1,54 @@
+/************************************************************************
+ * NASA Docket No. GSC-18,719-1, and identified as “core Flight System: Bootes”
+ *
+ * Copyright (c) 2020 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+#include <stddef.h>
+
+#include "cfe_tbl_filedef.h" /* Required to obtain the CFE_TBL_FILEDEF macro definition */
+#include "sample_app_tbl.h"
+#include "sample_app_msgids.h"
+#include "sample_app_msg.h"
+
+/*
+** Default limits, on the app's own housekeeping packet: command errors
+** building up, and wakeups nearing the default pipe drain limit of 8.
+** Unused entries have a message ID of zero.
+*/
+SAMPLE_APP_LimitTable_t LimitTable = {
+    .Entry = {{.MsgId      = SAMPLE_APP_HK_TLM_MID,
+               .Offset     = offsetof(SAMPLE_APP_HkTlm_t, Payload.CommandErrorCounter),
+               .Type       = SAMPLE_APP_LIMIT_TYPE_UINT8,
+               .RedLow     = 0,
+               .YellowLow  = 0,
+               .YellowHigh = 5,
+               .RedHigh    = 20},
+              {.MsgId      = SAMPLE_APP_HK_TLM_MID,
+               .Offset     = offsetof(SAMPLE_APP_HkTlm_t, Payload.LastWakeupMsgCount),
+               .Type       = SAMPLE_APP_LIMIT_TYPE_UINT16,
+               .RedLow     = 0,
+               .YellowLow  = 0,
+               .YellowHigh = 6,
+               .RedHigh    = 7}}};
+
+/*
+** The macro below identifies:
+**    1) the data structure type to use as the table image format
+**    2) the name of the table to be placed into the cFE Example Table File Header
+**    3) a brief description of the contents of the file image
+**    4) the desired name of the table image binary file that is cFE compatible
+*/
+CFE_TBL_FILEDEF(LimitTable, SAMPLE_APP.LimitTable, Telemetry Limit Table, sample_app_limit_tbl.tbl)
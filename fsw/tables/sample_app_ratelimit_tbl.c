@@ -0,0 +1,44 @@
+/************************************************************************
+ * NASA Docket No. GSC-18,719-1, and identified as “core Flight System: Bootes”
+ *
+ * Copyright (c) 2020 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+#include "cfe_tbl_filedef.h" /* Required to obtain the CFE_TBL_FILEDEF macro definition */
+#include "sample_app_tbl.h"
+#include "sample_app_msgids.h"
+#include "sample_app_fcncodes.h"
+
+/*
+** Default rate limits: the processing commands are held to a steady
+** rate with a modest burst, and housekeeping requests to a few per second.
+** Unused entries have a message ID of zero.
+*/
+SAMPLE_APP_RateLimitTable_t RateLimitTable = {
+    .Entry = {{.MsgId = SAMPLE_APP_CMD_MID, .CommandCode = SAMPLE_APP_PROCESS_CC, .BurstSize = 20, .RatePerSec = 10},
+              {.MsgId       = SAMPLE_APP_CMD_MID,
+               .CommandCode = SAMPLE_APP_DISPLAY_PARAM_CC,
+               .BurstSize   = 10,
+               .RatePerSec  = 5},
+              {.MsgId = SAMPLE_APP_SEND_HK_MID, .CommandCode = 0, .BurstSize = 4, .RatePerSec = 4}}};
+
+/*
+** The macro below identifies:
+**    1) the data structure type to use as the table image format
+**    2) the name of the table to be placed into the cFE Example Table File Header
+**    3) a brief description of the contents of the file image
+**    4) the desired name of the table image binary file that is cFE compatible
+*/
+CFE_TBL_FILEDEF(RateLimitTable, SAMPLE_APP.RateLimitTable, Command Rate Limit Table, sample_app_ratelimit_tbl.tbl)
@@ -23,7 +23,15 @@
 ** The following is an example of the declaration statement that defines the desired
 ** contents of the table image.
 */
-SAMPLE_APP_ExampleTable_t ExampleTable = {1, 2};
+SAMPLE_APP_ExampleTable_t ExampleTable = {.Int1       = 1,
+                                          .Int2       = 2,
+                                          .NumRecords = 4,
+                                          .FirNumTaps = 8,
+                                          .FirCoeff   = {4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096},
+                                          .Record     = {{.Key = 40, .Value = 4000},
+                                                     {.Key = 10, .Value = 1000},
+                                                     {.Key = 30, .Value = 3000},
+                                                     {.Key = 20, .Value = 2000}}};
 
 /*
 ** The macro below identifies:
@@ -46,8 +46,6 @@
 
 void Test_SAMPLE_APP_Main(void)
 {
-    CFE_SB_MsgId_t MsgId = CFE_SB_INVALID_MSG_ID;
-
     /*
      * Test Case For:
      * void SAMPLE_APP_Main( void )
@@ -106,18 +104,26 @@ void Test_SAMPLE_APP_Main(void)
      */
     UT_SetDeferredRetcode(UT_KEY(CFE_ES_RunLoop), 1, true);
 
-    /* Set up buffer for command processing */
-    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgId), &MsgId, sizeof(MsgId), false);
-
     /*
      * Invoke again
      */
     SAMPLE_APP_Main();
 
     /*
-     * Confirm that CFE_SB_ReceiveBuffer() (inside the loop) was called
+     * Confirm that CFE_SB_ReceiveBuffer() (inside the loop) was called,
+     * and the pipes were then serviced
      */
     UtAssert_STUB_COUNT(CFE_SB_ReceiveBuffer, 1);
+    UtAssert_STUB_COUNT(SAMPLE_APP_ServicePipes, 1);
+
+    /*
+     * A pend timeout still services the lower priority pipes
+     */
+    UT_SetDeferredRetcode(UT_KEY(CFE_ES_RunLoop), 1, true);
+    UT_SetDeferredRetcode(UT_KEY(CFE_SB_ReceiveBuffer), 1, CFE_SB_TIME_OUT);
+    SAMPLE_APP_Main();
+    UtAssert_STUB_COUNT(SAMPLE_APP_ServicePipes, 2);
+    UtAssert_UINT32_EQ(SAMPLE_APP_Data.RunStatus, CFE_ES_RunStatus_APP_RUN);
 
     /*
      * Now also make the CFE_SB_ReceiveBuffer call fail,
@@ -137,6 +143,15 @@ void Test_SAMPLE_APP_Main(void)
      * Confirm that the event was generated
      */
     UtAssert_UINT32_EQ(EventTest.MatchCount, 1);
+
+    /*
+     * A read error while servicing the pipes is treated the same way
+     */
+    UT_SetDeferredRetcode(UT_KEY(CFE_ES_RunLoop), 1, true);
+    UT_SetDeferredRetcode(UT_KEY(SAMPLE_APP_ServicePipes), 1, CFE_SB_PIPE_RD_ERR);
+    SAMPLE_APP_Main();
+    UtAssert_UINT32_EQ(EventTest.MatchCount, 2);
+    UtAssert_UINT32_EQ(SAMPLE_APP_Data.RunStatus, CFE_ES_RunStatus_APP_ERROR);
 }
 
 void Test_SAMPLE_APP_Init(void)
@@ -146,8 +161,15 @@ void Test_SAMPLE_APP_Init(void)
      * CFE_Status_t SAMPLE_APP_Init( void )
      */
 
-    /* nominal case should return CFE_SUCCESS */
+    /* nominal case should return CFE_SUCCESS, with the example table held */
     UtAssert_INT32_EQ(SAMPLE_APP_Init(), CFE_SUCCESS);
+    UtAssert_STUB_COUNT(SAMPLE_APP_AcquireExampleTable, 1);
+    UtAssert_STUB_COUNT(SAMPLE_APP_CrcInit, 1);
+    UtAssert_STUB_COUNT(SAMPLE_APP_WorkerInit, 1);
+    UtAssert_STUB_COUNT(SAMPLE_APP_PipesInit, 1);
+    UtAssert_STUB_COUNT(SAMPLE_APP_UpdateRateLimits, 1);
+    UtAssert_STUB_COUNT(SAMPLE_APP_UpdateLimits, 1);
+    UtAssert_STUB_COUNT(SAMPLE_APP_UpdateCalibration, 1);
 
     /*
      * Trigger a failure for each of the sub-calls, and confirm a write to syslog for
@@ -158,21 +180,38 @@ void Test_SAMPLE_APP_Init(void)
     UtAssert_INT32_EQ(SAMPLE_APP_Init(), CFE_EVS_INVALID_PARAMETER);
     UtAssert_STUB_COUNT(CFE_ES_WriteToSysLog, 1);
 
-    UT_SetDeferredRetcode(UT_KEY(CFE_SB_CreatePipe), 1, CFE_SB_BAD_ARGUMENT);
-    UtAssert_INT32_EQ(SAMPLE_APP_Init(), CFE_SB_BAD_ARGUMENT);
-    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 2); /* 1 from previous nominal case, 1 from this error path */
-
-    UT_SetDeferredRetcode(UT_KEY(CFE_SB_Subscribe), 1, CFE_SB_BAD_ARGUMENT);
+    UT_SetDeferredRetcode(UT_KEY(SAMPLE_APP_PipesInit), 1, CFE_SB_BAD_ARGUMENT);
     UtAssert_INT32_EQ(SAMPLE_APP_Init(), CFE_SB_BAD_ARGUMENT);
-    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 3); /* 1 additional event sent from this error path */
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1); /* the pipe module sends its own event */
+    UtAssert_STUB_COUNT(SAMPLE_APP_WorkerInit, 1);
 
-    UT_SetDeferredRetcode(UT_KEY(CFE_SB_Subscribe), 2, CFE_SB_BAD_ARGUMENT);
-    UtAssert_INT32_EQ(SAMPLE_APP_Init(), CFE_SB_BAD_ARGUMENT);
-    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 4); /* 1 additional event sent from this error path */
+    UT_SetDeferredRetcode(UT_KEY(SAMPLE_APP_WorkerInit), 1, CFE_STATUS_EXTERNAL_RESOURCE_FAIL);
+    UtAssert_INT32_EQ(SAMPLE_APP_Init(), CFE_STATUS_EXTERNAL_RESOURCE_FAIL);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1); /* the worker module sends its own event */
 
     UT_SetDeferredRetcode(UT_KEY(CFE_TBL_Register), 1, CFE_TBL_ERR_INVALID_OPTIONS);
     UtAssert_INT32_EQ(SAMPLE_APP_Init(), CFE_TBL_ERR_INVALID_OPTIONS);
-    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 6); /* 1 from table registration error, 1 from successful init event */
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 3); /* 1 from table registration error, 1 from successful init event */
+
+    /* the rate limit table is registered second, its buckets are only built once loaded */
+    UT_SetDeferredRetcode(UT_KEY(CFE_TBL_Register), 2, CFE_TBL_ERR_INVALID_OPTIONS);
+    UtAssert_INT32_EQ(SAMPLE_APP_Init(), CFE_TBL_ERR_INVALID_OPTIONS);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 5);
+    UtAssert_STUB_COUNT(SAMPLE_APP_UpdateRateLimits, 1);
+
+    /* the limit table is registered third, subscribing to its packets only once loaded */
+    UT_SetDeferredRetcode(UT_KEY(CFE_TBL_Register), 3, CFE_TBL_ERR_INVALID_OPTIONS);
+    UtAssert_INT32_EQ(SAMPLE_APP_Init(), CFE_TBL_ERR_INVALID_OPTIONS);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 7);
+    UtAssert_STUB_COUNT(SAMPLE_APP_UpdateRateLimits, 2);
+    UtAssert_STUB_COUNT(SAMPLE_APP_UpdateLimits, 1);
+
+    /* the calibration table is registered fourth, its lookup tables are only built once loaded */
+    UT_SetDeferredRetcode(UT_KEY(CFE_TBL_Register), 4, CFE_TBL_ERR_INVALID_OPTIONS);
+    UtAssert_INT32_EQ(SAMPLE_APP_Init(), CFE_TBL_ERR_INVALID_OPTIONS);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 9);
+    UtAssert_STUB_COUNT(SAMPLE_APP_UpdateLimits, 2);
+    UtAssert_STUB_COUNT(SAMPLE_APP_UpdateCalibration, 1);
 }
 
 /*
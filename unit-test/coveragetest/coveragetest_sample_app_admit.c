@@ -0,0 +1,216 @@
+/************************************************************************
+ * NASA Docket No. GSC-18,719-1, and identified as “core Flight System: Bootes”
+ *
+ * Copyright (c) 2020 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/*
+** File: coveragetest_sample_app.c
+**
+** Purpose:
+** Coverage Unit Test cases for the Sample Application
+**
+** Notes:
+** This implements various test cases to exercise all code
+** paths through all functions defined in the Sample application.
+**
+** It is primarily focused at providing examples of the various
+** stub configurations, hook functions, and wrapper calls that
+** are often needed when coercing certain code paths through
+** complex functions.
+*/
+
+
+/*
+ * Includes
+ */
+#include "sample_app_coveragetest_common.h"
+
+/*
+ * Handler to capture the last command handed to the command handlers
+ */
+static void UT_Handler_SAMPLE_APP_ProcessGroundCommand(void *UserObj, UT_EntryKey_t FuncKey,
+                                                       const UT_StubContext_t *Context)
+{
+    const CFE_SB_Buffer_t **SBBufPtr = UserObj;
+
+    *SBBufPtr = UT_Hook_GetArgValueByName(Context, "SBBufPtr", const CFE_SB_Buffer_t *);
+}
+
+/*
+**********************************************************************************
+**          TEST CASE FUNCTIONS
+**********************************************************************************
+*/
+
+void Test_SAMPLE_APP_AdmitCommand(void)
+{
+    /*
+     * Test Case For:
+     * bool SAMPLE_APP_AdmitCommand( const CFE_SB_Buffer_t *SBBufPtr, const SAMPLE_APP_MsgContext_t *MsgCtx )
+     */
+    union
+    {
+        CFE_SB_Buffer_t              SBBuf;
+        SAMPLE_APP_DisplayParamCmd_t DisplayParam;
+    } TestMsg;
+    SAMPLE_APP_MsgContext_t        MsgCtx;
+    SAMPLE_APP_AdmitTlm_Payload_t *Stats = &SAMPLE_APP_Data.AdmitTlm.Payload;
+    uint16                         i;
+
+    memset(&TestMsg, 0, sizeof(TestMsg));
+    memset(&MsgCtx, 0, sizeof(MsgCtx));
+    memset(&SAMPLE_APP_Data, 0, sizeof(SAMPLE_APP_Data));
+
+    MsgCtx.MsgId                        = CFE_SB_ValueToMsgId(SAMPLE_APP_CMD_MID);
+    MsgCtx.FcnCode                      = SAMPLE_APP_DISPLAY_PARAM_CC;
+    MsgCtx.MsgSize                      = sizeof(TestMsg.DisplayParam);
+    TestMsg.DisplayParam.Payload.ValU32 = 42;
+
+    /* everything is admitted below the defer level */
+    SAMPLE_APP_Data.Backlog = SAMPLE_APP_ADMIT_DEFER_BACKLOG - 1;
+    UtAssert_BOOL_TRUE(SAMPLE_APP_AdmitCommand(&TestMsg.SBBuf, &MsgCtx));
+
+    /* at the defer level low priority commands are held until the hold is full */
+    SAMPLE_APP_Data.Backlog = SAMPLE_APP_ADMIT_DEFER_BACKLOG;
+    for (i = 0; i < SAMPLE_APP_ADMIT_DEFER_DEPTH; ++i)
+    {
+        UtAssert_BOOL_FALSE(SAMPLE_APP_AdmitCommand(&TestMsg.SBBuf, &MsgCtx));
+    }
+    UtAssert_UINT32_EQ(SAMPLE_APP_Data.DeferredCount, SAMPLE_APP_ADMIT_DEFER_DEPTH);
+    UtAssert_UINT32_EQ(SAMPLE_APP_Data.Deferred[0].MsgCtx.FcnCode, SAMPLE_APP_DISPLAY_PARAM_CC);
+    UtAssert_UINT32_EQ(SAMPLE_APP_Data.Deferred[0].Msg.DisplayParamCmd.Payload.ValU32, 42);
+    UtAssert_UINT32_EQ(Stats->DeferCount[SAMPLE_APP_DISPLAY_PARAM_CC], SAMPLE_APP_ADMIT_DEFER_DEPTH);
+    UtAssert_UINT32_EQ(Stats->PeakBacklog, SAMPLE_APP_ADMIT_DEFER_BACKLOG);
+
+    UtAssert_BOOL_FALSE(SAMPLE_APP_AdmitCommand(&TestMsg.SBBuf, &MsgCtx));
+    UtAssert_UINT32_EQ(Stats->ShedCount[SAMPLE_APP_DISPLAY_PARAM_CC], 1);
+
+    /* at the shed level they are dropped even with room to hold them */
+    SAMPLE_APP_Data.DeferredCount = 0;
+    SAMPLE_APP_Data.Backlog       = SAMPLE_APP_ADMIT_SHED_BACKLOG;
+    UtAssert_BOOL_FALSE(SAMPLE_APP_AdmitCommand(&TestMsg.SBBuf, &MsgCtx));
+    UtAssert_UINT32_EQ(Stats->ShedCount[SAMPLE_APP_DISPLAY_PARAM_CC], 2);
+    UtAssert_ZERO(SAMPLE_APP_Data.DeferredCount);
+    UtAssert_UINT32_EQ(Stats->PeakBacklog, SAMPLE_APP_ADMIT_SHED_BACKLOG);
+
+    /* a message too large to hold is dropped */
+    SAMPLE_APP_Data.Backlog = SAMPLE_APP_ADMIT_DEFER_BACKLOG;
+    MsgCtx.MsgSize          = sizeof(SAMPLE_APP_Data.Deferred[0].Msg) + 1;
+    UtAssert_BOOL_FALSE(SAMPLE_APP_AdmitCommand(&TestMsg.SBBuf, &MsgCtx));
+    UtAssert_UINT32_EQ(Stats->ShedCount[SAMPLE_APP_DISPLAY_PARAM_CC], 3);
+
+    /* NOOP, out of range codes and housekeeping requests are always admitted */
+    SAMPLE_APP_Data.Backlog = SAMPLE_APP_ADMIT_SHED_BACKLOG;
+    MsgCtx.FcnCode          = SAMPLE_APP_NOOP_CC;
+    UtAssert_BOOL_TRUE(SAMPLE_APP_AdmitCommand(&TestMsg.SBBuf, &MsgCtx));
+    MsgCtx.FcnCode = SAMPLE_APP_ADMIT_MAX_CC;
+    UtAssert_BOOL_TRUE(SAMPLE_APP_AdmitCommand(&TestMsg.SBBuf, &MsgCtx));
+    MsgCtx.MsgId   = CFE_SB_ValueToMsgId(SAMPLE_APP_SEND_HK_MID);
+    MsgCtx.FcnCode = SAMPLE_APP_DISPLAY_PARAM_CC;
+    UtAssert_BOOL_TRUE(SAMPLE_APP_AdmitCommand(&TestMsg.SBBuf, &MsgCtx));
+    UtAssert_ZERO(Stats->ShedCount[SAMPLE_APP_NOOP_CC]);
+}
+
+void Test_SAMPLE_APP_AdmitBacklogCleared(void)
+{
+    /*
+     * Test Case For:
+     * void SAMPLE_APP_AdmitBacklogCleared( void )
+     */
+    union
+    {
+        CFE_SB_Buffer_t         SBBuf;
+        SAMPLE_APP_ProcessCmd_t Process;
+    } TestMsg;
+    SAMPLE_APP_MsgContext_t MsgCtx;
+    const CFE_SB_Buffer_t * Replayed = NULL;
+
+    memset(&TestMsg, 0, sizeof(TestMsg));
+    memset(&MsgCtx, 0, sizeof(MsgCtx));
+    memset(&SAMPLE_APP_Data, 0, sizeof(SAMPLE_APP_Data));
+
+    UT_SetHandlerFunction(UT_KEY(SAMPLE_APP_ProcessGroundCommand), UT_Handler_SAMPLE_APP_ProcessGroundCommand,
+                          &Replayed);
+
+    /* a rate limited command that already passed its bucket is held under load */
+    MsgCtx.MsgId                                        = CFE_SB_ValueToMsgId(SAMPLE_APP_CMD_MID);
+    MsgCtx.FcnCode                                      = SAMPLE_APP_PROCESS_CC;
+    MsgCtx.MsgSize                                      = sizeof(TestMsg.Process);
+    MsgCtx.RcvTime.Seconds                              = 10;
+    SAMPLE_APP_Data.RateIndex[0][SAMPLE_APP_PROCESS_CC] = 1;
+    SAMPLE_APP_Data.Backlog                             = SAMPLE_APP_ADMIT_DEFER_BACKLOG;
+    UtAssert_BOOL_FALSE(SAMPLE_APP_AdmitCommand(&TestMsg.SBBuf, &MsgCtx));
+    UtAssert_BOOL_FALSE(SAMPLE_APP_AdmitCommand(&TestMsg.SBBuf, &MsgCtx));
+    UtAssert_UINT32_EQ(SAMPLE_APP_Data.DeferredCount, 2);
+
+    /*
+     * held commands go straight to the command handlers in order, without being
+     * charged to their rate limit or admission checked a second time
+     */
+    SAMPLE_APP_Data.Backlog = 12;
+    SAMPLE_APP_AdmitBacklogCleared();
+    UtAssert_STUB_COUNT(SAMPLE_APP_ProcessGroundCommand, 2);
+    UtAssert_ADDRESS_EQ(Replayed, &SAMPLE_APP_Data.Deferred[1].Msg.SBBuf);
+    UtAssert_STUB_COUNT(SAMPLE_APP_RateLimitCheck, 0);
+    UtAssert_STUB_COUNT(SAMPLE_APP_TaskPipe, 0);
+    UtAssert_ZERO(SAMPLE_APP_Data.Backlog);
+    UtAssert_ZERO(SAMPLE_APP_Data.DeferredCount);
+    UtAssert_UINT32_EQ(SAMPLE_APP_Data.AdmitTlm.Payload.PeakBacklog, 12);
+
+    /* nothing held, nothing replayed */
+    SAMPLE_APP_AdmitBacklogCleared();
+    UtAssert_STUB_COUNT(SAMPLE_APP_ProcessGroundCommand, 2);
+    UtAssert_UINT32_EQ(SAMPLE_APP_Data.AdmitTlm.Payload.PeakBacklog, 12);
+}
+
+void Test_SAMPLE_APP_UpdateAdmitStats(void)
+{
+    /*
+     * Test Case For:
+     * void SAMPLE_APP_UpdateAdmitStats( void )
+     */
+    memset(&SAMPLE_APP_Data, 0, sizeof(SAMPLE_APP_Data));
+
+    SAMPLE_APP_Data.Backlog = 5;
+    SAMPLE_APP_UpdateAdmitStats();
+    UtAssert_UINT32_EQ(SAMPLE_APP_Data.AdmitTlm.Payload.Backlog, 5);
+    UtAssert_UINT32_EQ(SAMPLE_APP_Data.AdmitTlm.Payload.PeakBacklog, 5);
+}
+
+void Test_SAMPLE_APP_ResetAdmitStats(void)
+{
+    /*
+     * Test Case For:
+     * void SAMPLE_APP_ResetAdmitStats( void )
+     */
+    SAMPLE_APP_Data.AdmitTlm.Payload.PeakBacklog                           = 5;
+    SAMPLE_APP_Data.AdmitTlm.Payload.ShedCount[SAMPLE_APP_DISPLAY_PARAM_CC] = 3;
+
+    SAMPLE_APP_ResetAdmitStats();
+    UtAssert_ZERO(SAMPLE_APP_Data.AdmitTlm.Payload.PeakBacklog);
+    UtAssert_ZERO(SAMPLE_APP_Data.AdmitTlm.Payload.ShedCount[SAMPLE_APP_DISPLAY_PARAM_CC]);
+}
+
+/*
+ * Register the test cases to execute with the unit test tool
+ */
+void UtTest_Setup(void)
+{
+    ADD_TEST(SAMPLE_APP_AdmitCommand);
+    ADD_TEST(SAMPLE_APP_AdmitBacklogCleared);
+    ADD_TEST(SAMPLE_APP_UpdateAdmitStats);
+    ADD_TEST(SAMPLE_APP_ResetAdmitStats);
+}
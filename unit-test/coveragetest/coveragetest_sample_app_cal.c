@@ -0,0 +1,365 @@
+/************************************************************************
+ * NASA Docket No. GSC-18,719-1, and identified as “core Flight System: Bootes”
+ *
+ * Copyright (c) 2020 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/*
+** File: coveragetest_sample_app.c
+**
+** Purpose:
+** Coverage Unit Test cases for the Sample Application
+**
+** Notes:
+** This implements various test cases to exercise all code
+** paths through all functions defined in the Sample application.
+**
+** It is primarily focused at providing examples of the various
+** stub configurations, hook functions, and wrapper calls that
+** are often needed when coercing certain code paths through
+** complex functions.
+*/
+
+
+/*
+ * Includes
+ */
+#include "sample_app_coveragetest_common.h"
+
+/*
+ * Number of randomized blocks compared between the two conversions
+ */
+#define UT_CAL_RANDOM_BLOCKS 200
+
+/*
+ * Set up the lookup tables from TestTblData, as after a table update
+ */
+static void UT_CalLoad(SAMPLE_APP_CalTable_t *TestTblData)
+{
+    void *TblPtr = TestTblData;
+
+    UT_SetDataBuffer(UT_KEY(CFE_TBL_GetAddress), &TblPtr, sizeof(TblPtr), false);
+    UT_SetDeferredRetcode(UT_KEY(CFE_TBL_GetAddress), 1, CFE_TBL_INFO_UPDATED);
+    SAMPLE_APP_UpdateCalibration();
+}
+
+/*
+**********************************************************************************
+**          TEST CASE FUNCTIONS
+**********************************************************************************
+*/
+
+void Test_SAMPLE_APP_CalValidationFunc(void)
+{
+    /*
+     * Test Case For:
+     * CFE_Status_t SAMPLE_APP_CalValidationFunc( void *TblData )
+     */
+    SAMPLE_APP_CalTable_t  TestTblData;
+    SAMPLE_APP_CalCurve_t *Curve = &TestTblData.Channel[SAMPLE_APP_SENSOR_CHANNELS - 1];
+    float                  Zero  = 0.0f;
+
+    memset(&TestTblData, 0, sizeof(TestTblData));
+
+    /* uncalibrated channels are valid */
+    UtAssert_INT32_EQ(SAMPLE_APP_CalValidationFunc(&TestTblData), CFE_SUCCESS);
+
+    /* a constant is the shortest polynomial */
+    Curve->Type      = SAMPLE_APP_CAL_TYPE_POLY;
+    Curve->NumPoints = 1;
+    Curve->Eng[0]    = 5.0f;
+    UtAssert_INT32_EQ(SAMPLE_APP_CalValidationFunc(&TestTblData), CFE_SUCCESS);
+
+    Curve->NumPoints = 0;
+    UtAssert_INT32_EQ(SAMPLE_APP_CalValidationFunc(&TestTblData), SAMPLE_APP_TABLE_OUT_OF_RANGE_ERR_CODE);
+
+    Curve->NumPoints = SAMPLE_APP_CAL_MAX_POINTS + 1;
+    UtAssert_INT32_EQ(SAMPLE_APP_CalValidationFunc(&TestTblData), SAMPLE_APP_TABLE_OUT_OF_RANGE_ERR_CODE);
+
+    /* a coefficient that is not a number */
+    Curve->NumPoints = 2;
+    Curve->Eng[1]    = Zero / Zero;
+    UtAssert_INT32_EQ(SAMPLE_APP_CalValidationFunc(&TestTblData), SAMPLE_APP_TABLE_OUT_OF_RANGE_ERR_CODE);
+
+    /* or a curve that leaves the float range at full scale */
+    Curve->Eng[1] = 1.0e38f;
+    UtAssert_INT32_EQ(SAMPLE_APP_CalValidationFunc(&TestTblData), SAMPLE_APP_TABLE_OUT_OF_RANGE_ERR_CODE);
+
+    /* piecewise curves need two breakpoints, strictly increasing */
+    Curve->Type      = SAMPLE_APP_CAL_TYPE_PIECEWISE;
+    Curve->NumPoints = 1;
+    UtAssert_INT32_EQ(SAMPLE_APP_CalValidationFunc(&TestTblData), SAMPLE_APP_TABLE_OUT_OF_RANGE_ERR_CODE);
+
+    Curve->NumPoints = 3;
+    Curve->Raw[0]    = -100;
+    Curve->Raw[1]    = 0;
+    Curve->Raw[2]    = 100;
+    UtAssert_INT32_EQ(SAMPLE_APP_CalValidationFunc(&TestTblData), CFE_SUCCESS);
+
+    Curve->Raw[2] = 0;
+    UtAssert_INT32_EQ(SAMPLE_APP_CalValidationFunc(&TestTblData), SAMPLE_APP_TABLE_OUT_OF_RANGE_ERR_CODE);
+
+    /* a lookup segment holds one breakpoint besides one at its start, not two */
+    Curve->Raw[0] = 0;
+    Curve->Raw[1] = 100;
+    Curve->Raw[2] = 200;
+    UtAssert_INT32_EQ(SAMPLE_APP_CalValidationFunc(&TestTblData), SAMPLE_APP_TABLE_OUT_OF_RANGE_ERR_CODE);
+
+    Curve->Raw[2] = 1 << SAMPLE_APP_CAL_LUT_SHIFT;
+    UtAssert_INT32_EQ(SAMPLE_APP_CalValidationFunc(&TestTblData), CFE_SUCCESS);
+
+    Curve->NumPoints = SAMPLE_APP_CAL_MAX_POINTS + 1;
+    UtAssert_INT32_EQ(SAMPLE_APP_CalValidationFunc(&TestTblData), SAMPLE_APP_TABLE_OUT_OF_RANGE_ERR_CODE);
+
+    /* an unknown type */
+    Curve->Type = SAMPLE_APP_CAL_TYPE_PIECEWISE + 1;
+    UtAssert_INT32_EQ(SAMPLE_APP_CalValidationFunc(&TestTblData), SAMPLE_APP_TABLE_OUT_OF_RANGE_ERR_CODE);
+}
+
+void Test_SAMPLE_APP_UpdateCalibration(void)
+{
+    /*
+     * Test Case For:
+     * void SAMPLE_APP_UpdateCalibration( void )
+     */
+    SAMPLE_APP_CalTable_t TestTblData;
+    void *                TblPtr = &TestTblData;
+    SAMPLE_APP_CalLut_t * Lut    = &SAMPLE_APP_Data.CalLut;
+    uint32                Mid    = SAMPLE_APP_CAL_LUT_SEGMENTS / 2;
+
+    memset(&TestTblData, 0, sizeof(TestTblData));
+    memset(&SAMPLE_APP_Data, 0, sizeof(SAMPLE_APP_Data));
+
+    TestTblData.Channel[1].Type      = SAMPLE_APP_CAL_TYPE_POLY;
+    TestTblData.Channel[1].NumPoints = 2;
+    TestTblData.Channel[1].Eng[0]    = 1.0f;
+    TestTblData.Channel[1].Eng[1]    = 2.0f;
+    TestTblData.Channel[2].Type      = SAMPLE_APP_CAL_TYPE_PIECEWISE;
+    TestTblData.Channel[2].NumPoints = 2;
+    TestTblData.Channel[2].Raw[0]    = -256;
+    TestTblData.Channel[2].Raw[1]    = 256;
+    TestTblData.Channel[2].Eng[0]    = -10.0f;
+    TestTblData.Channel[2].Eng[1]    = 10.0f;
+
+    /* unchanged table, nothing is compiled */
+    UT_SetDataBuffer(UT_KEY(CFE_TBL_GetAddress), &TblPtr, sizeof(TblPtr), false);
+    SAMPLE_APP_UpdateCalibration();
+    UtAssert_True(Lut->Channel[0].Slope[0] == 0.0f, "Lookup table untouched");
+    UtAssert_STUB_COUNT(CFE_TBL_ReleaseAddress, 1);
+
+    /* a table that cannot be read is not released */
+    UT_SetDeferredRetcode(UT_KEY(CFE_TBL_GetAddress), 1, CFE_TBL_ERR_NEVER_LOADED);
+    SAMPLE_APP_UpdateCalibration();
+    UtAssert_STUB_COUNT(CFE_TBL_ReleaseAddress, 1);
+
+    /* updated table, each segment starts on its curve */
+    UT_CalLoad(&TestTblData);
+    UtAssert_STUB_COUNT(CFE_TBL_ReleaseAddress, 2);
+    UtAssert_True(Lut->Channel[0].Base[0] == -32768.0f && Lut->Channel[0].Slope[0] == 1.0f,
+                  "Raw counts from INT16_MIN");
+    UtAssert_True(Lut->Channel[1].Base[Mid] == 1.0f && Lut->Channel[1].Slope[Mid] == 2.0f, "Polynomial at zero");
+    UtAssert_True(Lut->Channel[2].Base[0] == -10.0f && Lut->Channel[2].Slope[0] == 0.0f,
+                  "Flat below the first breakpoint");
+    UtAssert_True(Lut->Channel[2].Base[Mid - 1] == -10.0f && Lut->Channel[2].Base[Mid] == 0.0f,
+                  "Breakpoint segments %f, %f", (double)Lut->Channel[2].Base[Mid - 1],
+                  (double)Lut->Channel[2].Base[Mid]);
+    UtAssert_True(Lut->Channel[2].Slope[Mid] == 10.0f / 256, "Piecewise slope %f",
+                  (double)Lut->Channel[2].Slope[Mid]);
+    UtAssert_True(Lut->Channel[2].Base[SAMPLE_APP_CAL_LUT_SEGMENTS - 1] == 10.0f, "Flat above the last breakpoint");
+
+    /* breakpoints on segment boundaries need no knot */
+    UtAssert_INT32_EQ(Lut->Channel[1].Knot[Mid], 1 << SAMPLE_APP_CAL_LUT_SHIFT);
+    UtAssert_INT32_EQ(Lut->Channel[2].Knot[Mid - 1], 1 << SAMPLE_APP_CAL_LUT_SHIFT);
+
+    /* a breakpoint inside a segment becomes its knot */
+    TestTblData.Channel[2].Raw[0] = -100;
+    TestTblData.Channel[2].Raw[1] = 100;
+    UT_CalLoad(&TestTblData);
+    UtAssert_INT32_EQ(Lut->Channel[2].Knot[Mid - 1], 156);
+    UtAssert_INT32_EQ(Lut->Channel[2].Knot[Mid], 100);
+    UtAssert_True(Lut->Channel[2].Slope[Mid - 1] == 0.0f && Lut->Channel[2].KnotBase[Mid - 1] == -10.0f &&
+                      Lut->Channel[2].KnotSlope[Mid - 1] == 0.1f,
+                  "Knot into the ramp, slope %f", (double)Lut->Channel[2].KnotSlope[Mid - 1]);
+    UtAssert_True(Lut->Channel[2].KnotBase[Mid] == 10.0f && Lut->Channel[2].KnotSlope[Mid] == 0.0f,
+                  "Knot out of the ramp at %f", (double)Lut->Channel[2].KnotBase[Mid]);
+}
+
+void Test_SAMPLE_APP_CalConvertScalar(void)
+{
+    /*
+     * Test Case For:
+     * void SAMPLE_APP_CalConvertScalar( const SAMPLE_APP_CalSegments_t *Lut, const int16 *Raw, float *Eng,
+     *                                   uint32 Count )
+     */
+    SAMPLE_APP_CalTable_t TestTblData;
+    SAMPLE_APP_CalLut_t * Lut    = &SAMPLE_APP_Data.CalLut;
+    int16                 Raw[5] = {-32768, -256, 128, 256, 32767};
+    float                 Eng[5];
+    double                Exact;
+    int32                 r;
+
+    memset(&TestTblData, 0, sizeof(TestTblData));
+    memset(&SAMPLE_APP_Data, 0, sizeof(SAMPLE_APP_Data));
+
+    TestTblData.Channel[1].Type      = SAMPLE_APP_CAL_TYPE_PIECEWISE;
+    TestTblData.Channel[1].NumPoints = 2;
+    TestTblData.Channel[1].Raw[0]    = -256;
+    TestTblData.Channel[1].Raw[1]    = 256;
+    TestTblData.Channel[1].Eng[0]    = -10.0f;
+    TestTblData.Channel[1].Eng[1]    = 10.0f;
+    TestTblData.Channel[2].Type      = SAMPLE_APP_CAL_TYPE_POLY;
+    TestTblData.Channel[2].NumPoints = 3;
+    TestTblData.Channel[2].Eng[2]    = 1.0e-4f;
+    TestTblData.Channel[3].Type      = SAMPLE_APP_CAL_TYPE_PIECEWISE;
+    TestTblData.Channel[3].NumPoints = 3;
+    TestTblData.Channel[3].Raw[0]    = -100;
+    TestTblData.Channel[3].Raw[1]    = 0;
+    TestTblData.Channel[3].Raw[2]    = 100;
+    TestTblData.Channel[3].Eng[0]    = -25.0f;
+    TestTblData.Channel[3].Eng[1]    = 0.0f;
+    TestTblData.Channel[3].Eng[2]    = 50.0f;
+    UT_CalLoad(&TestTblData);
+
+    /* uncalibrated channels give back the raw counts over the whole range */
+    SAMPLE_APP_CalConvertScalar(&Lut->Channel[0], Raw, Eng, 5);
+    UtAssert_True(Eng[0] == -32768.0f && Eng[4] == 32767.0f, "Raw counts %f .. %f", (double)Eng[0], (double)Eng[4]);
+
+    /* piecewise curves are exact at breakpoints on segment boundaries, and between them */
+    SAMPLE_APP_CalConvertScalar(&Lut->Channel[1], Raw, Eng, 5);
+    UtAssert_True(Eng[0] == -10.0f && Eng[1] == -10.0f, "Low end %f, %f", (double)Eng[0], (double)Eng[1]);
+    UtAssert_True(Eng[2] == 5.0f, "Midway %f == 5", (double)Eng[2]);
+    UtAssert_True(Eng[3] == 10.0f && Eng[4] == 10.0f, "High end %f, %f", (double)Eng[3], (double)Eng[4]);
+
+    /*
+     * A square law stays within the most a chord strays from it over one
+     * segment, a quarter of its coefficient times the segment width squared
+     */
+    for (r = INT16_MIN; r <= INT16_MAX; r += 7)
+    {
+        Raw[0] = (int16)r;
+        SAMPLE_APP_CalConvertScalar(&Lut->Channel[2], Raw, Eng, 1);
+        Exact = 1.0e-4f * (double)r * r;
+        if (Eng[0] - Exact > 2.0 || Exact - Eng[0] > 2.0)
+        {
+            break;
+        }
+    }
+    UtAssert_True(r > INT16_MAX, "Square law within 2 of exact, stopped at %ld", (long)r);
+
+    /* breakpoints off the segment boundaries are followed exactly at every count */
+    for (r = INT16_MIN; r <= INT16_MAX; ++r)
+    {
+        Raw[0] = (int16)r;
+        SAMPLE_APP_CalConvertScalar(&Lut->Channel[3], Raw, Eng, 1);
+        if (r <= -100)
+        {
+            Exact = -25.0;
+        }
+        else if (r < 0)
+        {
+            Exact = 0.25 * (r + 100) - 25.0;
+        }
+        else if (r < 100)
+        {
+            Exact = 0.5 * r;
+        }
+        else
+        {
+            Exact = 50.0;
+        }
+        if (Eng[0] != Exact)
+        {
+            break;
+        }
+    }
+    UtAssert_True(r > INT16_MAX, "Unaligned breakpoints exact, stopped at %ld", (long)r);
+}
+
+void Test_SAMPLE_APP_CalConvert(void)
+{
+    /*
+     * Test Case For:
+     * void SAMPLE_APP_CalConvert( const SAMPLE_APP_CalSegments_t *Lut, const int16 *Raw, float *Eng,
+     *                             uint32 Count )
+     */
+    SAMPLE_APP_CalSegments_t Lut;
+    int16                    Raw[SAMPLE_APP_SENSOR_BLOCK_SAMPLES];
+    float                    Eng[SAMPLE_APP_SENSOR_BLOCK_SAMPLES];
+    float                    Ref[SAMPLE_APP_SENSOR_BLOCK_SAMPLES];
+    uint32                   Seed = 1;
+    uint32                   Count;
+    uint32                   Mismatches = 0;
+    uint32                   i;
+    uint32                   n;
+
+    /* about half the segments have a knot, the rest have theirs past the end */
+    for (i = 0; i < SAMPLE_APP_CAL_LUT_SEGMENTS; ++i)
+    {
+        Lut.Base[i]      = (float)((int32)(UT_Random(&Seed) % 2001) - 1000);
+        Lut.Slope[i]     = (float)((int32)(UT_Random(&Seed) % 2001) - 1000) / 100;
+        Lut.Knot[i]      = (int32)(UT_Random(&Seed) % (2 << SAMPLE_APP_CAL_LUT_SHIFT));
+        Lut.KnotBase[i]  = (float)((int32)(UT_Random(&Seed) % 2001) - 1000);
+        Lut.KnotSlope[i] = (float)((int32)(UT_Random(&Seed) % 2001) - 1000) / 100;
+        if (Lut.Knot[i] > (1 << SAMPLE_APP_CAL_LUT_SHIFT))
+        {
+            Lut.Knot[i] = 1 << SAMPLE_APP_CAL_LUT_SHIFT;
+        }
+    }
+
+    /*
+     * Randomized blocks of every length up to a full block, including
+     * both ends of the raw range, must match the scalar reference.  A
+     * tolerance allows for the scalar loop being built with a fused
+     * multiply-add, which rounds once where the vectors round twice.
+     */
+    for (n = 0; n < UT_CAL_RANDOM_BLOCKS; ++n)
+    {
+        Count = UT_Random(&Seed) % (SAMPLE_APP_SENSOR_BLOCK_SAMPLES + 1);
+
+        for (i = 0; i < Count; ++i)
+        {
+            Raw[i] = (int16)UT_Random(&Seed);
+        }
+        if (Count > 1)
+        {
+            Raw[0]         = INT16_MIN;
+            Raw[Count - 1] = INT16_MAX;
+        }
+
+        SAMPLE_APP_CalConvert(&Lut, Raw, Eng, Count);
+        SAMPLE_APP_CalConvertScalar(&Lut, Raw, Ref, Count);
+
+        for (i = 0; i < Count; ++i)
+        {
+            if (Eng[i] - Ref[i] > 0.01f || Ref[i] - Eng[i] > 0.01f)
+            {
+                ++Mismatches;
+            }
+        }
+    }
+
+    UtAssert_ZERO(Mismatches);
+}
+
+/*
+ * Register the test cases to execute with the unit test tool
+ */
+void UtTest_Setup(void)
+{
+    ADD_TEST(SAMPLE_APP_CalValidationFunc);
+    ADD_TEST(SAMPLE_APP_UpdateCalibration);
+    ADD_TEST(SAMPLE_APP_CalConvertScalar);
+    ADD_TEST(SAMPLE_APP_CalConvert);
+}
@@ -36,12 +36,29 @@
  * Includes
  */
 
-#include "sample_lib.h" /* For SAMPLE_LIB_Function */
 #include "sample_app_coveragetest_common.h"
 #include "sample_app.h"
 #include "sample_app_dispatch.h"
 #include "sample_app_cmds.h"
 
+/*
+ * Handler to capture the event ID recorded by SAMPLE_APP_Trace
+ */
+static void UT_Handler_SAMPLE_APP_Trace(void *UserObj, UT_EntryKey_t FuncKey, const UT_StubContext_t *Context)
+{
+    uint16 *EventID = UserObj;
+
+    *EventID = UT_Hook_GetArgValueByName(Context, "EventID", uint16);
+}
+
+/*
+ * Handler to return the pointer given as UserObj, for stubs returning a pointer
+ */
+static void UT_Handler_ReturnPointer(void *UserObj, UT_EntryKey_t FuncKey, const UT_StubContext_t *Context)
+{
+    UT_Stub_SetReturnValue(FuncKey, UserObj);
+}
+
 /*
 **********************************************************************************
 **          TEST CASE FUNCTIONS
@@ -54,30 +71,201 @@ void Test_SAMPLE_APP_ReportHousekeeping(void)
      * Test Case For:
      * void SAMPLE_APP_ReportHousekeeping( const CFE_SB_CmdHdr_t *Msg )
      */
-    CFE_MSG_Message_t *MsgSend;
-    CFE_MSG_Message_t *MsgTimestamp;
-
-    /* Set up to capture send message address */
-    UT_SetDataBuffer(UT_KEY(CFE_SB_TransmitMsg), &MsgSend, sizeof(MsgSend), false);
 
-    /* Set up to capture timestamp message address */
-    UT_SetDataBuffer(UT_KEY(CFE_SB_TimeStampMsg), &MsgTimestamp, sizeof(MsgTimestamp), false);
+    /* Housekeeping is built through the telemetry module, here into the app's copy */
+    UT_SetHandlerFunction(UT_KEY(SAMPLE_APP_TlmBegin), UT_Handler_SAMPLE_APP_TlmBegin, NULL);
+    SAMPLE_APP_Data.ErrCounter                    = 2;
+    SAMPLE_APP_Data.TlmCopyCount                  = 3;
+    SAMPLE_APP_Data.HkTlm.Payload.Worker[0].spare = 0xFFFF;
 
     /* Call unit under test, NULL pointer confirms command access is through APIs */
     SAMPLE_APP_SendHkCmd(NULL);
 
-    /* Confirm message sent*/
-    UtAssert_STUB_COUNT(CFE_SB_TransmitMsg, 1);
-    UtAssert_ADDRESS_EQ(MsgSend, &SAMPLE_APP_Data.HkTlm);
+    /* Confirm housekeeping sent, with every field filled in */
+    UtAssert_STUB_COUNT(SAMPLE_APP_TlmBegin, 1);
+    UtAssert_STUB_COUNT(SAMPLE_APP_TlmSend, 1);
+    UtAssert_STUB_COUNT(SAMPLE_APP_UpdateWorkerStats, 1);
+    UtAssert_STUB_COUNT(SAMPLE_APP_UpdatePipeStats, 1);
+    UtAssert_UINT32_EQ(SAMPLE_APP_Data.HkTlm.Payload.CommandErrorCounter, 2);
+    UtAssert_UINT32_EQ(SAMPLE_APP_Data.HkTlm.Payload.TlmCopyCount, 3);
+    UtAssert_ZERO(SAMPLE_APP_Data.HkTlm.Payload.Worker[0].spare);
+
+    /* Statistics and admission control have their own schedule slots */
+    UtAssert_STUB_COUNT(CFE_SB_TransmitMsg, 0);
+    UtAssert_STUB_COUNT(SAMPLE_APP_UpdateAdmitStats, 0);
+
+    /* Table management and the other upkeep are left to the scheduler wakeup */
+    UtAssert_STUB_COUNT(CFE_TBL_Manage, 0);
+    UtAssert_STUB_COUNT(SAMPLE_APP_ScrubExampleTable, 0);
+    UtAssert_STUB_COUNT(SAMPLE_APP_TraceFlush, 0);
+}
 
-    /* Confirm timestamp msg address */
-    UtAssert_STUB_COUNT(CFE_SB_TimeStampMsg, 1);
-    UtAssert_ADDRESS_EQ(MsgTimestamp, &SAMPLE_APP_Data.HkTlm);
+void Test_SAMPLE_APP_PerformHousekeeping(void)
+{
+    /*
+     * Test Case For:
+     * void SAMPLE_APP_PerformHousekeeping( void )
+     */
+
+    SAMPLE_APP_PerformHousekeeping();
+
+    /*
+     * Confirm that the CFE_TBL_Manage() call was done, with the
+     * example table released around it
+     */
+    UtAssert_STUB_COUNT(SAMPLE_APP_ReleaseExampleTable, 1);
+    UtAssert_STUB_COUNT(CFE_TBL_Manage, SAMPLE_APP_NUMBER_OF_TABLES);
+    UtAssert_STUB_COUNT(SAMPLE_APP_AcquireExampleTable, 1);
+
+    /* rate limit, limit and calibration table updates are picked up and rejects are summarized */
+    UtAssert_STUB_COUNT(SAMPLE_APP_UpdateRateLimits, 1);
+    UtAssert_STUB_COUNT(SAMPLE_APP_UpdateLimits, 1);
+    UtAssert_STUB_COUNT(SAMPLE_APP_UpdateCalibration, 1);
+    UtAssert_STUB_COUNT(SAMPLE_APP_ReportRateLimits, 1);
+    UtAssert_STUB_COUNT(SAMPLE_APP_CoalesceFlush, 1);
+    UtAssert_STUB_COUNT(SAMPLE_APP_LimitFlush, 1);
+
+    UtAssert_STUB_COUNT(SAMPLE_APP_TraceFlush, 1);
+
+    /* no telemetry is sent from here */
+    UtAssert_STUB_COUNT(SAMPLE_APP_TlmBegin, 0);
+
+    /* a clean scrub does not reload the table */
+    UtAssert_STUB_COUNT(SAMPLE_APP_ScrubExampleTable, 1);
+    UtAssert_STUB_COUNT(CFE_TBL_Load, 0);
+
+    /* a corrupted image is reloaded from file before the manage call */
+    UT_SetDefaultReturnValue(UT_KEY(SAMPLE_APP_ScrubExampleTable), true);
+    SAMPLE_APP_PerformHousekeeping();
+    UtAssert_STUB_COUNT(CFE_TBL_Load, 1);
+    UtAssert_STUB_COUNT(CFE_TBL_Manage, 2 * SAMPLE_APP_NUMBER_OF_TABLES);
+
+    /* a failed reload is reported to syslog */
+    UT_SetDeferredRetcode(UT_KEY(CFE_TBL_Load), 1, CFE_TBL_ERR_ACCESS);
+    SAMPLE_APP_PerformHousekeeping();
+    UtAssert_STUB_COUNT(CFE_TBL_Load, 2);
+    UtAssert_STUB_COUNT(CFE_ES_WriteToSysLog, 1);
+}
 
+void Test_SAMPLE_APP_ReportHousekeepingChangeOnly(void)
+{
     /*
-     * Confirm that the CFE_TBL_Manage() call was done
+     * Test Case For:
+     * void SAMPLE_APP_ReportHousekeeping( const CFE_SB_CmdHdr_t *Msg )
+     * in change-only mode
      */
-    UtAssert_STUB_COUNT(CFE_TBL_Manage, 1);
+    uint32 i;
+
+    UT_SetHandlerFunction(UT_KEY(SAMPLE_APP_TlmBegin), UT_Handler_SAMPLE_APP_TlmBegin, NULL);
+    SAMPLE_APP_Data.HkChangeOnly      = true;
+    SAMPLE_APP_Data.HkSinceSent       = SAMPLE_APP_HK_KEEPALIVE_COUNT - 1;
+    SAMPLE_APP_Data.HkSuppressedCount = 0;
+
+    /* the first request always sends */
+    SAMPLE_APP_SendHkCmd(NULL);
+    UtAssert_STUB_COUNT(SAMPLE_APP_TlmSend, 1);
+    UtAssert_STUB_COUNT(SAMPLE_APP_TlmDiscard, 0);
+
+    /* with nothing changed, requests are suppressed until the keep-alive is due */
+    for (i = 1; i < SAMPLE_APP_HK_KEEPALIVE_COUNT; ++i)
+    {
+        SAMPLE_APP_SendHkCmd(NULL);
+    }
+    UtAssert_STUB_COUNT(SAMPLE_APP_TlmSend, 1);
+    UtAssert_STUB_COUNT(SAMPLE_APP_TlmDiscard, SAMPLE_APP_HK_KEEPALIVE_COUNT - 1);
+    UtAssert_UINT32_EQ(SAMPLE_APP_Data.HkSuppressedCount, SAMPLE_APP_HK_KEEPALIVE_COUNT - 1);
+
+    SAMPLE_APP_SendHkCmd(NULL);
+    UtAssert_STUB_COUNT(SAMPLE_APP_TlmSend, 2);
+    UtAssert_ZERO(SAMPLE_APP_Data.HkSinceSent);
+
+    /* a changed counter sends straight away */
+    SAMPLE_APP_Data.CmdCounter++;
+    SAMPLE_APP_SendHkCmd(NULL);
+    UtAssert_STUB_COUNT(SAMPLE_APP_TlmSend, 3);
+
+    /* as does a worker or pipe statistic that differs from the last packet */
+    SAMPLE_APP_Data.HkLastSent.Worker[0].CompletedCount++;
+    SAMPLE_APP_SendHkCmd(NULL);
+    UtAssert_STUB_COUNT(SAMPLE_APP_TlmSend, 4);
+
+    SAMPLE_APP_Data.HkLastSent.PipeHighWatermark[0]++;
+    SAMPLE_APP_SendHkCmd(NULL);
+    UtAssert_STUB_COUNT(SAMPLE_APP_TlmSend, 5);
+
+    /* a gauge alone does not */
+    SAMPLE_APP_Data.HkLastSent.Worker[0].QueueDepth++;
+    SAMPLE_APP_SendHkCmd(NULL);
+    UtAssert_STUB_COUNT(SAMPLE_APP_TlmSend, 5);
+    UtAssert_STUB_COUNT(SAMPLE_APP_TlmDiscard, SAMPLE_APP_HK_KEEPALIVE_COUNT);
+
+    /* nor do the passes of an idle background scrub, though the count is sent with the next packet */
+    SAMPLE_APP_Data.ScrubPassCount++;
+    SAMPLE_APP_SendHkCmd(NULL);
+    SAMPLE_APP_Data.ScrubPassCount++;
+    SAMPLE_APP_SendHkCmd(NULL);
+    UtAssert_STUB_COUNT(SAMPLE_APP_TlmSend, 5);
+    UtAssert_STUB_COUNT(SAMPLE_APP_TlmDiscard, SAMPLE_APP_HK_KEEPALIVE_COUNT + 2);
+
+    SAMPLE_APP_Data.CmdCounter++;
+    SAMPLE_APP_SendHkCmd(NULL);
+    UtAssert_STUB_COUNT(SAMPLE_APP_TlmSend, 6);
+    UtAssert_UINT32_EQ(SAMPLE_APP_Data.HkLastSent.ScrubPassCount, SAMPLE_APP_Data.ScrubPassCount);
+
+    SAMPLE_APP_Data.HkChangeOnly = false;
+}
+
+void Test_SAMPLE_APP_SendStatsTlm(void)
+{
+    /*
+     * Test Case For:
+     * CFE_Status_t SAMPLE_APP_SendStatsTlm( const SAMPLE_APP_SendHkCmd_t *Msg )
+     */
+    SAMPLE_APP_StatsTlm_t TestBuf;
+
+    memset(&TestBuf, 0, sizeof(TestBuf));
+    SAMPLE_APP_Data.StatsTlm.Payload.UntrackedCount = 5;
+
+    /* with an SB buffer, the statistics are copied into it and it is handed over */
+    UT_SetHandlerFunction(UT_KEY(SAMPLE_APP_TlmBegin), UT_Handler_ReturnPointer, &TestBuf);
+    UtAssert_INT32_EQ(SAMPLE_APP_SendStatsTlm(NULL), CFE_SUCCESS);
+    UtAssert_STUB_COUNT(SAMPLE_APP_TlmBegin, 1);
+    UtAssert_STUB_COUNT(SAMPLE_APP_TlmSend, 1);
+    UtAssert_UINT32_EQ(TestBuf.Payload.UntrackedCount, 5);
+    UtAssert_STUB_COUNT(CFE_SB_TransmitMsg, 0);
+
+    /* without one, the app's own copy is sent as it stands */
+    UT_SetHandlerFunction(UT_KEY(SAMPLE_APP_TlmBegin), UT_Handler_SAMPLE_APP_TlmBegin, NULL);
+    UtAssert_INT32_EQ(SAMPLE_APP_SendStatsTlm(NULL), CFE_SUCCESS);
+    UtAssert_STUB_COUNT(SAMPLE_APP_TlmSend, 2);
+    UtAssert_UINT32_EQ(SAMPLE_APP_Data.StatsTlm.Payload.UntrackedCount, 5);
+}
+
+void Test_SAMPLE_APP_SendAdmitTlm(void)
+{
+    /*
+     * Test Case For:
+     * CFE_Status_t SAMPLE_APP_SendAdmitTlm( const SAMPLE_APP_SendHkCmd_t *Msg )
+     */
+    SAMPLE_APP_AdmitTlm_t TestBuf;
+
+    memset(&TestBuf, 0, sizeof(TestBuf));
+    SAMPLE_APP_Data.AdmitTlm.Payload.PeakBacklog = 9;
+
+    /* the backlog is refreshed, then the counters are copied into the SB buffer and sent */
+    UT_SetHandlerFunction(UT_KEY(SAMPLE_APP_TlmBegin), UT_Handler_ReturnPointer, &TestBuf);
+    UtAssert_INT32_EQ(SAMPLE_APP_SendAdmitTlm(NULL), CFE_SUCCESS);
+    UtAssert_STUB_COUNT(SAMPLE_APP_UpdateAdmitStats, 1);
+    UtAssert_STUB_COUNT(SAMPLE_APP_TlmBegin, 1);
+    UtAssert_STUB_COUNT(SAMPLE_APP_TlmSend, 1);
+    UtAssert_UINT32_EQ(TestBuf.Payload.PeakBacklog, 9);
+    UtAssert_STUB_COUNT(CFE_SB_TransmitMsg, 0);
+
+    /* without one, the app's own copy is sent as it stands */
+    UT_SetHandlerFunction(UT_KEY(SAMPLE_APP_TlmBegin), UT_Handler_SAMPLE_APP_TlmBegin, NULL);
+    UtAssert_INT32_EQ(SAMPLE_APP_SendAdmitTlm(NULL), CFE_SUCCESS);
+    UtAssert_STUB_COUNT(SAMPLE_APP_TlmSend, 2);
+    UtAssert_UINT32_EQ(SAMPLE_APP_Data.AdmitTlm.Payload.PeakBacklog, 9);
 }
 
 void Test_SAMPLE_APP_NoopCmd(void)
@@ -87,19 +275,21 @@ void Test_SAMPLE_APP_NoopCmd(void)
      * void SAMPLE_APP_NoopCmd( const SAMPLE_APP_Noop_t *Msg )
      */
     SAMPLE_APP_NoopCmd_t TestMsg;
-    UT_CheckEvent_t      EventTest;
+    uint16               EventID = 0;
 
     memset(&TestMsg, 0, sizeof(TestMsg));
 
     /* test dispatch of NOOP */
-    UT_CHECKEVENT_SETUP(&EventTest, SAMPLE_APP_NOOP_INF_EID, NULL);
+    UT_SetHandlerFunction(UT_KEY(SAMPLE_APP_Trace), UT_Handler_SAMPLE_APP_Trace, &EventID);
 
     UtAssert_INT32_EQ(SAMPLE_APP_NoopCmd(&TestMsg), CFE_SUCCESS);
 
     /*
-     * Confirm that the event was generated
+     * Confirm that the event was traced rather than sent
      */
-    UtAssert_UINT32_EQ(EventTest.MatchCount, 1);
+    UtAssert_STUB_COUNT(SAMPLE_APP_Trace, 1);
+    UtAssert_UINT32_EQ(EventID, SAMPLE_APP_NOOP_INF_EID);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
 }
 
 void Test_SAMPLE_APP_ResetCountersCmd(void)
@@ -109,18 +299,29 @@ void Test_SAMPLE_APP_ResetCountersCmd(void)
      * void SAMPLE_APP_ResetCounters( const SAMPLE_APP_ResetCounters_t *Msg )
      */
     SAMPLE_APP_ResetCountersCmd_t TestMsg;
-    UT_CheckEvent_t               EventTest;
+    uint16                        EventID = 0;
 
     memset(&TestMsg, 0, sizeof(TestMsg));
 
-    UT_CHECKEVENT_SETUP(&EventTest, SAMPLE_APP_RESET_INF_EID, "SAMPLE: RESET command");
+    SAMPLE_APP_Data.Pipe[0].HighWatermark = 5;
+    SAMPLE_APP_Data.Trace.LostCount       = 3;
+    SAMPLE_APP_Data.TlmCopyCount          = 3;
+    SAMPLE_APP_Data.HkSuppressedCount     = 4;
+
+    UT_SetHandlerFunction(UT_KEY(SAMPLE_APP_Trace), UT_Handler_SAMPLE_APP_Trace, &EventID);
 
     UtAssert_INT32_EQ(SAMPLE_APP_ResetCountersCmd(&TestMsg), CFE_SUCCESS);
+    UtAssert_ZERO(SAMPLE_APP_Data.Pipe[0].HighWatermark);
+    UtAssert_ZERO(SAMPLE_APP_Data.Trace.LostCount);
+    UtAssert_ZERO(SAMPLE_APP_Data.TlmCopyCount);
+    UtAssert_ZERO(SAMPLE_APP_Data.HkSuppressedCount);
 
     /*
-     * Confirm that the event was generated
+     * Confirm that the event was traced rather than sent
      */
-    UtAssert_UINT32_EQ(EventTest.MatchCount, 1);
+    UtAssert_STUB_COUNT(SAMPLE_APP_Trace, 1);
+    UtAssert_UINT32_EQ(EventID, SAMPLE_APP_RESET_INF_EID);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
 }
 
 void Test_SAMPLE_APP_ProcessCmd(void)
@@ -129,82 +330,118 @@ void Test_SAMPLE_APP_ProcessCmd(void)
      * Test Case For:
      * void  SAMPLE_APP_ProcessCmd( const SAMPLE_APP_ProcessCmd_t *Msg )
      */
-    SAMPLE_APP_ProcessCmd_t   TestMsg;
-    SAMPLE_APP_ExampleTable_t TestTblData;
-    void *                    TblPtr = &TestTblData;
+    SAMPLE_APP_ProcessCmd_t TestMsg;
+    UT_CheckEvent_t         EventTest;
 
-    memset(&TestTblData, 0, sizeof(TestTblData));
     memset(&TestMsg, 0, sizeof(TestMsg));
+    SAMPLE_APP_Data.CmdCounter = 0;
+    SAMPLE_APP_Data.ErrCounter = 0;
 
-    /* Provide some table data for the SAMPLE_APP_Process() function to use */
-    TestTblData.Int1 = 40;
-    TestTblData.Int2 = 50;
-    UT_SetDataBuffer(UT_KEY(CFE_TBL_GetAddress), &TblPtr, sizeof(TblPtr), false);
+    /* nominal case hands the command to a worker */
     UtAssert_INT32_EQ(SAMPLE_APP_ProcessCmd(&TestMsg), CFE_SUCCESS);
+    UtAssert_STUB_COUNT(SAMPLE_APP_WorkerSubmit, 1);
+    UtAssert_UINT32_EQ(SAMPLE_APP_Data.CmdCounter, 1);
 
     /*
-     * This only needs to account for the call to CFE_ES_WriteToSysLog() directly
-     * invoked by the unit under test.   Note that in this build environment, the
-     * SAMPLE_APP_GetCrc() function is a stub.
+     * Confirm that no processing is done on the main task
      */
-    UtAssert_STUB_COUNT(CFE_ES_WriteToSysLog, 1);
+    UtAssert_STUB_COUNT(CFE_ES_WriteToSysLog, 0);
+    UtAssert_STUB_COUNT(CFE_TBL_GetAddress, 0);
 
+    /* all worker queues full, the command is rejected */
+    UT_CHECKEVENT_SETUP(&EventTest, SAMPLE_APP_WORKER_FULL_ERR_EID, NULL);
+    UT_SetDeferredRetcode(UT_KEY(SAMPLE_APP_WorkerSubmit), 1, SAMPLE_APP_WORKER_QUEUE_FULL_ERR_CODE);
+    UtAssert_INT32_EQ(SAMPLE_APP_ProcessCmd(&TestMsg), SAMPLE_APP_WORKER_QUEUE_FULL_ERR_CODE);
+    UtAssert_UINT32_EQ(EventTest.MatchCount, 1);
+    UtAssert_UINT32_EQ(SAMPLE_APP_Data.CmdCounter, 1);
+    UtAssert_UINT32_EQ(SAMPLE_APP_Data.ErrCounter, 1);
+}
+
+void Test_SAMPLE_APP_DisplayParamCmd(void)
+{
     /*
-     * Confirm that the CFE_TBL_GetAddress() call was done
+     * Test Case For:
+     * void  SAMPLE_APP_DisplayParamCmd( const SAMPLE_APP_DisplayParamCmd_t *Msg )
      */
-    UtAssert_STUB_COUNT(CFE_TBL_GetAddress, 1);
+    SAMPLE_APP_DisplayParamCmd_t TestMsg;
+    uint16                       EventID = 0;
+
+    memset(&TestMsg, 0, sizeof(TestMsg));
 
+    UT_SetHandlerFunction(UT_KEY(SAMPLE_APP_Trace), UT_Handler_SAMPLE_APP_Trace, &EventID);
+    TestMsg.Payload.ValU32 = 10;
+    TestMsg.Payload.ValI16 = -4;
+    snprintf(TestMsg.Payload.ValStr, sizeof(TestMsg.Payload.ValStr), "Hello");
+
+    UtAssert_INT32_EQ(SAMPLE_APP_DisplayParamCmd(&TestMsg), CFE_SUCCESS);
     /*
-     * Confirm that the SAMPLE_LIB_Function() call was done
-     * NOTE: This stub is provided by the sample_lib library
+     * Confirm that the event was traced rather than sent
      */
-    UtAssert_STUB_COUNT(SAMPLE_LIB_Function, 1);
+    UtAssert_STUB_COUNT(SAMPLE_APP_Trace, 1);
+    UtAssert_UINT32_EQ(EventID, SAMPLE_APP_VALUE_INF_EID);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+}
 
+void Test_SAMPLE_APP_ResetStatsCmd(void)
+{
     /*
-     * Configure the CFE_TBL_GetAddress function to return an error.
-     * Exercise the error return path.
-     * Error at this point should add only one additional call to
-     * CFE_ES_WriteToSysLog() through the CFE_TBL_GetAddress() error path.
+     * Test Case For:
+     * void  SAMPLE_APP_ResetStatsCmd( const SAMPLE_APP_ResetStatsCmd_t *Msg )
      */
-    UT_SetDefaultReturnValue(UT_KEY(CFE_TBL_GetAddress), CFE_TBL_ERR_UNREGISTERED);
-    UtAssert_INT32_EQ(SAMPLE_APP_ProcessCmd(&TestMsg), CFE_TBL_ERR_UNREGISTERED);
-    UtAssert_STUB_COUNT(CFE_ES_WriteToSysLog, 2);
+    SAMPLE_APP_ResetStatsCmd_t TestMsg;
+    UT_CheckEvent_t            EventTest;
+
+    memset(&TestMsg, 0, sizeof(TestMsg));
+
+    UT_CHECKEVENT_SETUP(&EventTest, SAMPLE_APP_RESET_STATS_INF_EID, "SAMPLE: RESET STATS command");
+
+    UtAssert_INT32_EQ(SAMPLE_APP_ResetStatsCmd(&TestMsg), CFE_SUCCESS);
+    UtAssert_STUB_COUNT(SAMPLE_APP_ResetDispatchStats, 1);
+    UtAssert_STUB_COUNT(SAMPLE_APP_ResetAdmitStats, 1);
+    UtAssert_STUB_COUNT(SAMPLE_APP_QuantileReset, 1);
 
     /*
-     * Configure CFE_TBL_ReleaseAddress() to return an error, exercising the
-     * error return path.
-     * Confirm two additional calls to CFE_ES_WriteToSysLog() - one
-     * reporting the table values, and one through the CFE_TBL_ReleaseAddress()
-     * error path.
+     * Confirm that the event was generated
      */
-    UT_SetDataBuffer(UT_KEY(CFE_TBL_GetAddress), &TblPtr, sizeof(TblPtr), false);
-    UT_SetDefaultReturnValue(UT_KEY(CFE_TBL_GetAddress), CFE_SUCCESS);
-    UT_SetDefaultReturnValue(UT_KEY(CFE_TBL_ReleaseAddress), CFE_TBL_ERR_NO_ACCESS);
-    UtAssert_INT32_EQ(SAMPLE_APP_ProcessCmd(&TestMsg), CFE_TBL_ERR_NO_ACCESS);
-    UtAssert_STUB_COUNT(CFE_ES_WriteToSysLog, 4);
+    UtAssert_UINT32_EQ(EventTest.MatchCount, 1);
 }
 
-void Test_SAMPLE_APP_DisplayParamCmd(void)
+void Test_SAMPLE_APP_LookupRecordCmd(void)
 {
     /*
      * Test Case For:
-     * void  SAMPLE_APP_DisplayParamCmd( const SAMPLE_APP_DisplayParamCmd_t *Msg )
+     * void  SAMPLE_APP_LookupRecordCmd( const SAMPLE_APP_LookupRecordCmd_t *Msg )
      */
-    SAMPLE_APP_DisplayParamCmd_t TestMsg;
+    SAMPLE_APP_LookupRecordCmd_t TestMsg;
+    SAMPLE_APP_TableCopy_t       TestCopy;
+    SAMPLE_APP_ExampleRecord_t   TestRecord = {.Key = 7, .Value = 700};
     UT_CheckEvent_t              EventTest;
 
     memset(&TestMsg, 0, sizeof(TestMsg));
+    memset(&TestCopy, 0, sizeof(TestCopy));
+    TestMsg.Payload.Key = 7;
 
-    UT_CHECKEVENT_SETUP(&EventTest, SAMPLE_APP_VALUE_INF_EID, "SAMPLE_APP: ValU32=%lu, ValI16=%d, ValStr=%s");
-    TestMsg.Payload.ValU32 = 10;
-    TestMsg.Payload.ValI16 = -4;
-    snprintf(TestMsg.Payload.ValStr, sizeof(TestMsg.Payload.ValStr), "Hello");
-
-    UtAssert_INT32_EQ(SAMPLE_APP_DisplayParamCmd(&TestMsg), CFE_SUCCESS);
-    /*
-     * Confirm that the event was generated
-     */
+    /* nothing published yet, so no record to find */
+    UT_CHECKEVENT_SETUP(&EventTest, SAMPLE_APP_LOOKUP_ERR_EID, "Sample App: No example table record with key %u");
+    UtAssert_INT32_EQ(SAMPLE_APP_LookupRecordCmd(&TestMsg), SAMPLE_APP_RECORD_NOT_FOUND_ERR_CODE);
+    UtAssert_STUB_COUNT(SAMPLE_APP_FindRecord, 0);
+    UtAssert_UINT32_EQ(EventTest.MatchCount, 1);
+    UtAssert_UINT32_EQ(SAMPLE_APP_Data.ErrCounter, 1);
+
+    /* a key the published copy does not hold */
+    UT_SetHandlerFunction(UT_KEY(SAMPLE_APP_TableCopyBegin), UT_Handler_ReturnPointer, &TestCopy);
+    UtAssert_INT32_EQ(SAMPLE_APP_LookupRecordCmd(&TestMsg), SAMPLE_APP_RECORD_NOT_FOUND_ERR_CODE);
+    UtAssert_STUB_COUNT(SAMPLE_APP_FindRecord, 1);
+    UtAssert_UINT32_EQ(EventTest.MatchCount, 2);
+    UtAssert_UINT32_EQ(SAMPLE_APP_Data.ErrCounter, 2);
+
+    /* a key found through the index is reported */
+    UT_CHECKEVENT_SETUP(&EventTest, SAMPLE_APP_LOOKUP_INF_EID, "SAMPLE: Example table record key %u, value %lu");
+    UT_SetHandlerFunction(UT_KEY(SAMPLE_APP_FindRecord), UT_Handler_ReturnPointer, &TestRecord);
+    UtAssert_INT32_EQ(SAMPLE_APP_LookupRecordCmd(&TestMsg), CFE_SUCCESS);
+    UtAssert_STUB_COUNT(SAMPLE_APP_FindRecord, 2);
     UtAssert_UINT32_EQ(EventTest.MatchCount, 1);
+    UtAssert_UINT32_EQ(SAMPLE_APP_Data.CmdCounter, 1);
 }
 
 /*
@@ -213,8 +450,14 @@ void Test_SAMPLE_APP_DisplayParamCmd(void)
 void UtTest_Setup(void)
 {
     ADD_TEST(SAMPLE_APP_ReportHousekeeping);
+    ADD_TEST(SAMPLE_APP_ReportHousekeepingChangeOnly);
+    ADD_TEST(SAMPLE_APP_PerformHousekeeping);
+    ADD_TEST(SAMPLE_APP_SendStatsTlm);
+    ADD_TEST(SAMPLE_APP_SendAdmitTlm);
     ADD_TEST(SAMPLE_APP_NoopCmd);
     ADD_TEST(SAMPLE_APP_ResetCountersCmd);
     ADD_TEST(SAMPLE_APP_ProcessCmd);
     ADD_TEST(SAMPLE_APP_DisplayParamCmd);
+    ADD_TEST(SAMPLE_APP_ResetStatsCmd);
+    ADD_TEST(SAMPLE_APP_LookupRecordCmd);
 }
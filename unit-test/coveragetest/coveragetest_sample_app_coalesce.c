@@ -0,0 +1,222 @@
+/************************************************************************
+ * NASA Docket No. GSC-18,719-1, and identified as “core Flight System: Bootes”
+ *
+ * Copyright (c) 2020 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/*
+** File: coveragetest_sample_app.c
+**
+** Purpose:
+** Coverage Unit Test cases for the Sample Application
+**
+** Notes:
+** This implements various test cases to exercise all code
+** paths through all functions defined in the Sample application.
+**
+** It is primarily focused at providing examples of the various
+** stub configurations, hook functions, and wrapper calls that
+** are often needed when coercing certain code paths through
+** complex functions.
+*/
+
+
+/*
+ * Includes
+ */
+#include "sample_app_coveragetest_common.h"
+
+/*
+**********************************************************************************
+**          TEST CASE FUNCTIONS
+**********************************************************************************
+*/
+
+void Test_SAMPLE_APP_CoalesceEvent(void)
+{
+    /*
+     * Test Case For:
+     * bool SAMPLE_APP_CoalesceEvent( uint16 EventID, const SAMPLE_APP_MsgContext_t *MsgCtx )
+     */
+    SAMPLE_APP_MsgContext_t MsgCtx;
+    CFE_TIME_SysTime_t      Elapsed;
+    UT_CheckEvent_t         EventTest;
+    uint16                  i;
+
+    memset(&MsgCtx, 0, sizeof(MsgCtx));
+    memset(SAMPLE_APP_Data.Coalesce, 0, sizeof(SAMPLE_APP_Data.Coalesce));
+    UT_CHECKEVENT_SETUP(&EventTest, SAMPLE_APP_REPEAT_ERR_EID, NULL);
+
+    MsgCtx.MsgId   = CFE_SB_ValueToMsgId(SAMPLE_APP_CMD_MID);
+    MsgCtx.FcnCode = 100;
+
+    /* the first occurrence is sent, repeats within the window are counted */
+    UtAssert_BOOL_TRUE(SAMPLE_APP_CoalesceEvent(SAMPLE_APP_CC_ERR_EID, &MsgCtx));
+    UtAssert_BOOL_FALSE(SAMPLE_APP_CoalesceEvent(SAMPLE_APP_CC_ERR_EID, &MsgCtx));
+    UtAssert_BOOL_FALSE(SAMPLE_APP_CoalesceEvent(SAMPLE_APP_CC_ERR_EID, &MsgCtx));
+
+    /* a different event for the same message is tracked separately */
+    UtAssert_BOOL_TRUE(SAMPLE_APP_CoalesceEvent(SAMPLE_APP_CMD_LEN_ERR_EID, &MsgCtx));
+    UtAssert_UINT32_EQ(EventTest.MatchCount, 0);
+
+    /* after the window the repeats are summarized and the event sent again */
+    UT_SetDeferredRetcode(UT_KEY(CFE_TIME_Sub2MicroSecs), 1, SAMPLE_APP_COALESCE_WINDOW * 1000);
+    UtAssert_BOOL_TRUE(SAMPLE_APP_CoalesceEvent(SAMPLE_APP_CC_ERR_EID, &MsgCtx));
+    UtAssert_UINT32_EQ(EventTest.MatchCount, 1);
+
+    /* a window with no repeats closes without a summary */
+    UT_SetDeferredRetcode(UT_KEY(CFE_TIME_Sub2MicroSecs), 1, SAMPLE_APP_COALESCE_WINDOW * 1000);
+    UtAssert_BOOL_TRUE(SAMPLE_APP_CoalesceEvent(SAMPLE_APP_CC_ERR_EID, &MsgCtx));
+    UtAssert_UINT32_EQ(EventTest.MatchCount, 1);
+
+    /* a receive time before the window start is within the window, however far back */
+    UT_SetDeferredRetcode(UT_KEY(CFE_TIME_Compare), 1, CFE_TIME_A_LT_B);
+    UT_SetDeferredRetcode(UT_KEY(CFE_TIME_Sub2MicroSecs), 1, SAMPLE_APP_COALESCE_WINDOW * 1000);
+    UtAssert_BOOL_FALSE(SAMPLE_APP_CoalesceEvent(SAMPLE_APP_CC_ERR_EID, &MsgCtx));
+    UtAssert_STUB_COUNT(CFE_TIME_Subtract, 4);
+
+    /* and a long elapsed time does not wrap back into the window */
+    Elapsed.Seconds    = (0xFFFFFFFFUL / 1000) + 1;
+    Elapsed.Subseconds = 0;
+    UT_SetHandlerFunction(UT_KEY(CFE_TIME_Subtract), UT_Handler_CFE_TIME_Subtract, &Elapsed);
+    UtAssert_BOOL_TRUE(SAMPLE_APP_CoalesceEvent(SAMPLE_APP_CC_ERR_EID, &MsgCtx));
+    UtAssert_UINT32_EQ(EventTest.MatchCount, 2);
+    Elapsed.Seconds = 0;
+
+    /* with every slot in use, new errors are sent untracked and known ones still found */
+    for (i = 0; i < SAMPLE_APP_COALESCE_SLOTS - 2; ++i)
+    {
+        MsgCtx.FcnCode = i;
+        UtAssert_BOOL_TRUE(SAMPLE_APP_CoalesceEvent(SAMPLE_APP_CC_ERR_EID, &MsgCtx));
+    }
+    MsgCtx.FcnCode = SAMPLE_APP_COALESCE_SLOTS;
+    UtAssert_BOOL_TRUE(SAMPLE_APP_CoalesceEvent(SAMPLE_APP_CC_ERR_EID, &MsgCtx));
+    UtAssert_BOOL_TRUE(SAMPLE_APP_CoalesceEvent(SAMPLE_APP_CC_ERR_EID, &MsgCtx));
+    for (i = 0; i < SAMPLE_APP_COALESCE_SLOTS - 2; ++i)
+    {
+        MsgCtx.FcnCode = i;
+        UtAssert_BOOL_FALSE(SAMPLE_APP_CoalesceEvent(SAMPLE_APP_CC_ERR_EID, &MsgCtx));
+    }
+}
+
+void Test_SAMPLE_APP_CoalesceFlush(void)
+{
+    /*
+     * Test Case For:
+     * void SAMPLE_APP_CoalesceFlush( void )
+     */
+    SAMPLE_APP_MsgContext_t MsgCtx;
+    UT_CheckEvent_t         EventTest;
+    uint32                  Used;
+    uint32                  i;
+
+    memset(&MsgCtx, 0, sizeof(MsgCtx));
+    memset(SAMPLE_APP_Data.Coalesce, 0, sizeof(SAMPLE_APP_Data.Coalesce));
+    UT_CHECKEVENT_SETUP(&EventTest, SAMPLE_APP_REPEAT_ERR_EID, NULL);
+
+    /* entries still in their window are kept, and found again after the rebuild */
+    MsgCtx.MsgId = CFE_SB_ValueToMsgId(SAMPLE_APP_CMD_MID);
+    for (i = 0; i < 3; ++i)
+    {
+        MsgCtx.FcnCode = i;
+        SAMPLE_APP_CoalesceEvent(SAMPLE_APP_CC_ERR_EID, &MsgCtx);
+        SAMPLE_APP_CoalesceEvent(SAMPLE_APP_CC_ERR_EID, &MsgCtx);
+    }
+    SAMPLE_APP_CoalesceFlush();
+    UtAssert_UINT32_EQ(EventTest.MatchCount, 0);
+    for (i = 0; i < 3; ++i)
+    {
+        MsgCtx.FcnCode = i;
+        UtAssert_BOOL_FALSE(SAMPLE_APP_CoalesceEvent(SAMPLE_APP_CC_ERR_EID, &MsgCtx));
+    }
+
+    /* an entry whose window has closed is summarized and freed */
+    UT_SetDeferredRetcode(UT_KEY(CFE_TIME_Sub2MicroSecs), 1, SAMPLE_APP_COALESCE_WINDOW * 1000);
+    SAMPLE_APP_CoalesceFlush();
+    UtAssert_UINT32_EQ(EventTest.MatchCount, 1);
+
+    Used = 0;
+    for (i = 0; i < SAMPLE_APP_COALESCE_SLOTS; ++i)
+    {
+        if (SAMPLE_APP_Data.Coalesce[i].EventID != SAMPLE_APP_RESERVED_EID)
+        {
+            ++Used;
+        }
+    }
+    UtAssert_UINT32_EQ(Used, 2);
+
+    /* all closed, the table is emptied */
+    UT_SetDefaultReturnValue(UT_KEY(CFE_TIME_Sub2MicroSecs), SAMPLE_APP_COALESCE_WINDOW * 1000);
+    SAMPLE_APP_CoalesceFlush();
+    UtAssert_UINT32_EQ(EventTest.MatchCount, 3);
+    for (i = 0; i < SAMPLE_APP_COALESCE_SLOTS; ++i)
+    {
+        UtAssert_UINT32_EQ(SAMPLE_APP_Data.Coalesce[i].EventID, SAMPLE_APP_RESERVED_EID);
+    }
+}
+
+void Test_SAMPLE_APP_CoalesceOpen(void)
+{
+    /*
+     * Test Case For:
+     * bool SAMPLE_APP_CoalesceOpen( uint16 EventID, const SAMPLE_APP_MsgContext_t *MsgCtx )
+     */
+    SAMPLE_APP_MsgContext_t MsgCtx;
+    UT_CheckEvent_t         EventTest;
+    uint16                  i;
+
+    memset(&MsgCtx, 0, sizeof(MsgCtx));
+    memset(SAMPLE_APP_Data.Coalesce, 0, sizeof(SAMPLE_APP_Data.Coalesce));
+    UT_CHECKEVENT_SETUP(&EventTest, SAMPLE_APP_REPEAT_ERR_EID, NULL);
+
+    MsgCtx.MsgId   = CFE_SB_ValueToMsgId(SAMPLE_APP_CMD_MID);
+    MsgCtx.FcnCode = 100;
+
+    /* nothing sent yet */
+    UtAssert_BOOL_FALSE(SAMPLE_APP_CoalesceOpen(SAMPLE_APP_CC_ERR_EID, &MsgCtx));
+
+    /* open once sent, and asking does not count a repeat */
+    UtAssert_BOOL_TRUE(SAMPLE_APP_CoalesceEvent(SAMPLE_APP_CC_ERR_EID, &MsgCtx));
+    UtAssert_BOOL_TRUE(SAMPLE_APP_CoalesceOpen(SAMPLE_APP_CC_ERR_EID, &MsgCtx));
+    UtAssert_BOOL_TRUE(SAMPLE_APP_CoalesceOpen(SAMPLE_APP_CC_ERR_EID, &MsgCtx));
+    UtAssert_BOOL_FALSE(SAMPLE_APP_CoalesceOpen(SAMPLE_APP_CMD_LEN_ERR_EID, &MsgCtx));
+
+    /* closed once the window has passed, even before a flush, which then has no repeats to summarize */
+    UT_SetDeferredRetcode(UT_KEY(CFE_TIME_Sub2MicroSecs), 1, SAMPLE_APP_COALESCE_WINDOW * 1000);
+    UtAssert_BOOL_FALSE(SAMPLE_APP_CoalesceOpen(SAMPLE_APP_CC_ERR_EID, &MsgCtx));
+    UT_SetDeferredRetcode(UT_KEY(CFE_TIME_Sub2MicroSecs), 1, SAMPLE_APP_COALESCE_WINDOW * 1000);
+    SAMPLE_APP_CoalesceFlush();
+    UtAssert_UINT32_EQ(EventTest.MatchCount, 0);
+
+    /* with every slot in use, a known key is still found and an untracked one is never open */
+    for (i = 0; i < SAMPLE_APP_COALESCE_SLOTS; ++i)
+    {
+        MsgCtx.FcnCode = i;
+        SAMPLE_APP_CoalesceEvent(SAMPLE_APP_CC_ERR_EID, &MsgCtx);
+    }
+    UtAssert_BOOL_TRUE(SAMPLE_APP_CoalesceOpen(SAMPLE_APP_CC_ERR_EID, &MsgCtx));
+    MsgCtx.FcnCode = SAMPLE_APP_COALESCE_SLOTS;
+    UtAssert_BOOL_FALSE(SAMPLE_APP_CoalesceOpen(SAMPLE_APP_CC_ERR_EID, &MsgCtx));
+}
+
+/*
+ * Register the test cases to execute with the unit test tool
+ */
+void UtTest_Setup(void)
+{
+    ADD_TEST(SAMPLE_APP_CoalesceEvent);
+    ADD_TEST(SAMPLE_APP_CoalesceFlush);
+    ADD_TEST(SAMPLE_APP_CoalesceOpen);
+}
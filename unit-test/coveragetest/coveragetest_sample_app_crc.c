@@ -0,0 +1,108 @@
+/************************************************************************
+ * NASA Docket No. GSC-18,719-1, and identified as “core Flight System: Bootes”
+ *
+ * Copyright (c) 2020 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/*
+** File: coveragetest_sample_app.c
+**
+** Purpose:
+** Coverage Unit Test cases for the Sample Application
+**
+** Notes:
+** This implements various test cases to exercise all code
+** paths through all functions defined in the Sample application.
+**
+** It is primarily focused at providing examples of the various
+** stub configurations, hook functions, and wrapper calls that
+** are often needed when coercing certain code paths through
+** complex functions.
+*/
+
+
+/*
+ * Includes
+ */
+#include "sample_app_coveragetest_common.h"
+
+/*
+ * Standard check input, and its CRC-32C
+ */
+static const char UT_CRC_CHECK_STRING[] = "123456789";
+
+#define UT_CRC32C_CHECK 0xE3069283
+
+/*
+**********************************************************************************
+**          TEST CASE FUNCTIONS
+**********************************************************************************
+*/
+
+void Test_SAMPLE_APP_Crc32cSoftware(void)
+{
+    /*
+     * Test Case For:
+     * uint32 SAMPLE_APP_Crc32cSoftware( uint32 Crc, const void *Data, size_t Len )
+     */
+    SAMPLE_APP_CrcInit();
+
+    UtAssert_UINT32_EQ(SAMPLE_APP_Crc32cSoftware(0, UT_CRC_CHECK_STRING, 9), UT_CRC32C_CHECK);
+    UtAssert_UINT32_EQ(
+        SAMPLE_APP_Crc32cSoftware(SAMPLE_APP_Crc32cSoftware(0, UT_CRC_CHECK_STRING, 5), &UT_CRC_CHECK_STRING[5], 4),
+        UT_CRC32C_CHECK);
+}
+
+void Test_SAMPLE_APP_Crc32c(void)
+{
+    /*
+     * Test Case For:
+     * uint32 SAMPLE_APP_Crc32c( uint32 Crc, const void *Data, size_t Len )
+     */
+    uint8  Buffer[256];
+    uint32 Mismatches = 0;
+    uint32 Offset;
+    uint32 Len;
+
+    SAMPLE_APP_CrcInit();
+
+    UtAssert_UINT32_EQ(SAMPLE_APP_Crc32c(0, UT_CRC_CHECK_STRING, 9), UT_CRC32C_CHECK);
+
+    /* whichever implementation is built in must match the table driven one at any alignment */
+    for (Len = 0; Len < sizeof(Buffer); ++Len)
+    {
+        Buffer[Len] = (uint8)((Len * 167) + 13);
+    }
+    for (Offset = 0; Offset < 8; ++Offset)
+    {
+        for (Len = 0; Len <= sizeof(Buffer) - Offset; Len += 7)
+        {
+            if (SAMPLE_APP_Crc32c(0, &Buffer[Offset], Len) != SAMPLE_APP_Crc32cSoftware(0, &Buffer[Offset], Len))
+            {
+                ++Mismatches;
+            }
+        }
+    }
+    UtAssert_ZERO(Mismatches);
+}
+
+/*
+ * Register the test cases to execute with the unit test tool
+ */
+void UtTest_Setup(void)
+{
+    ADD_TEST(SAMPLE_APP_Crc32cSoftware);
+    ADD_TEST(SAMPLE_APP_Crc32c);
+}
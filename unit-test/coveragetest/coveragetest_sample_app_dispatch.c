@@ -54,42 +54,83 @@ void Test_SAMPLE_APP_TaskPipe(void)
     /* a buffer large enough for any command message */
     union
     {
-        CFE_SB_Buffer_t      SBBuf;
-        SAMPLE_APP_NoopCmd_t Noop;
+        CFE_SB_Buffer_t            SBBuf;
+        SAMPLE_APP_NoopCmd_t       Noop;
+        SAMPLE_APP_SensorDataCmd_t SensorData;
     } TestMsg;
-    CFE_SB_MsgId_t    TestMsgId;
-    CFE_MSG_FcnCode_t FcnCode;
-    size_t            MsgSize;
-    UT_CheckEvent_t   EventTest;
+    SAMPLE_APP_MsgContext_t MsgCtx;
+    UT_CheckEvent_t         EventTest;
 
     memset(&TestMsg, 0, sizeof(TestMsg));
+    memset(&MsgCtx, 0, sizeof(MsgCtx));
     UT_CHECKEVENT_SETUP(&EventTest, SAMPLE_APP_MID_ERR_EID, "SAMPLE: invalid command packet,MID = 0x%x");
+    UT_SetDefaultReturnValue(UT_KEY(SAMPLE_APP_CoalesceEvent), true);
+    UT_SetDefaultReturnValue(UT_KEY(SAMPLE_APP_RateLimitCheck), true);
+    UT_SetDefaultReturnValue(UT_KEY(SAMPLE_APP_AdmitCommand), true);
 
     /*
-     * The CFE_MSG_GetMsgId() stub uses a data buffer to hold the
-     * message ID values to return.
+     * The header fields come from the decoded message context,
+     * so no CFE_MSG accessors should be called here.
      */
-    TestMsgId = CFE_SB_ValueToMsgId(SAMPLE_APP_CMD_MID);
-    FcnCode   = SAMPLE_APP_NOOP_CC;
-    MsgSize   = sizeof(TestMsg.Noop);
-    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgId), &TestMsgId, sizeof(TestMsgId), false);
-    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetFcnCode), &FcnCode, sizeof(FcnCode), false);
-    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetSize), &MsgSize, sizeof(MsgSize), false);
-    SAMPLE_APP_TaskPipe(&TestMsg.SBBuf);
-
-    TestMsgId = CFE_SB_ValueToMsgId(SAMPLE_APP_SEND_HK_MID);
-    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgId), &TestMsgId, sizeof(TestMsgId), false);
-    SAMPLE_APP_TaskPipe(&TestMsg.SBBuf);
+    MsgCtx.MsgId   = CFE_SB_ValueToMsgId(SAMPLE_APP_CMD_MID);
+    MsgCtx.FcnCode = SAMPLE_APP_NOOP_CC;
+    MsgCtx.MsgSize = sizeof(TestMsg.Noop);
+    SAMPLE_APP_TaskPipe(&TestMsg.SBBuf, &MsgCtx);
+    UtAssert_STUB_COUNT(SAMPLE_APP_ProcessGroundCommand, 1);
+
+    MsgCtx.MsgId = CFE_SB_ValueToMsgId(SAMPLE_APP_SEND_HK_MID);
+    SAMPLE_APP_TaskPipe(&TestMsg.SBBuf, &MsgCtx);
+    UtAssert_STUB_COUNT(SAMPLE_APP_TlmScheduleCmd, 1);
+
+    /* sensor data of the right length goes to the filter, and is rejected otherwise */
+    MsgCtx.MsgId   = CFE_SB_ValueToMsgId(SAMPLE_APP_SENSOR_DATA_MID);
+    MsgCtx.MsgSize = sizeof(TestMsg.SensorData);
+    SAMPLE_APP_TaskPipe(&TestMsg.SBBuf, &MsgCtx);
+    MsgCtx.MsgSize = sizeof(TestMsg.Noop);
+    SAMPLE_APP_TaskPipe(&TestMsg.SBBuf, &MsgCtx);
+    UtAssert_STUB_COUNT(SAMPLE_APP_SensorDataCmd, 1);
 
     /* invalid message id */
-    TestMsgId = CFE_SB_INVALID_MSG_ID;
-    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgId), &TestMsgId, sizeof(TestMsgId), false);
-    SAMPLE_APP_TaskPipe(&TestMsg.SBBuf);
+    MsgCtx.MsgId = CFE_SB_INVALID_MSG_ID;
+    SAMPLE_APP_TaskPipe(&TestMsg.SBBuf, &MsgCtx);
 
     /*
      * Confirm that the event was generated only _once_
      */
     UtAssert_UINT32_EQ(EventTest.MatchCount, 1);
+
+    /* a command held back by admission control is not dispatched */
+    UT_SetDeferredRetcode(UT_KEY(SAMPLE_APP_AdmitCommand), 1, false);
+    MsgCtx.MsgId = CFE_SB_ValueToMsgId(SAMPLE_APP_CMD_MID);
+    SAMPLE_APP_TaskPipe(&TestMsg.SBBuf, &MsgCtx);
+    UtAssert_STUB_COUNT(SAMPLE_APP_ProcessGroundCommand, 1);
+    UtAssert_STUB_COUNT(SAMPLE_APP_AdmitCommand, 6);
+
+    /* a message over its rate limit is dropped before admission control */
+    UT_SetDeferredRetcode(UT_KEY(SAMPLE_APP_RateLimitCheck), 1, false);
+    SAMPLE_APP_TaskPipe(&TestMsg.SBBuf, &MsgCtx);
+    UtAssert_STUB_COUNT(SAMPLE_APP_ProcessGroundCommand, 1);
+    UtAssert_STUB_COUNT(SAMPLE_APP_AdmitCommand, 6);
+    UtAssert_STUB_COUNT(SAMPLE_APP_RateLimitCheck, 7);
+
+    /* a repeat of a recent error is counted by the coalescing layer, not sent */
+    UT_SetDeferredRetcode(UT_KEY(SAMPLE_APP_CoalesceEvent), 1, false);
+    MsgCtx.MsgId = CFE_SB_INVALID_MSG_ID;
+    SAMPLE_APP_TaskPipe(&TestMsg.SBBuf, &MsgCtx);
+    UtAssert_UINT32_EQ(EventTest.MatchCount, 1);
+    UtAssert_STUB_COUNT(SAMPLE_APP_CoalesceEvent, 3);
+
+    /* limit checked telemetry is consumed before rate limits and dispatch */
+    UT_SetDeferredRetcode(UT_KEY(SAMPLE_APP_LimitCheckPacket), 1, true);
+    MsgCtx.MsgId = CFE_SB_ValueToMsgId(SAMPLE_APP_HK_TLM_MID);
+    SAMPLE_APP_TaskPipe(&TestMsg.SBBuf, &MsgCtx);
+    UtAssert_UINT32_EQ(EventTest.MatchCount, 1);
+    UtAssert_STUB_COUNT(SAMPLE_APP_LimitCheckPacket, 9);
+    UtAssert_STUB_COUNT(SAMPLE_APP_RateLimitCheck, 8);
+
+    UtAssert_STUB_COUNT(CFE_MSG_GetMsgId, 0);
+    UtAssert_STUB_COUNT(CFE_MSG_GetFcnCode, 0);
+    UtAssert_STUB_COUNT(CFE_MSG_GetSize, 0);
 }
 
 void Test_SAMPLE_APP_ProcessGroundCommand(void)
@@ -98,9 +139,7 @@ void Test_SAMPLE_APP_ProcessGroundCommand(void)
      * Test Case For:
      * void SAMPLE_APP_ProcessGroundCommand
      */
-    CFE_MSG_FcnCode_t FcnCode;
-    size_t            Size;
-    CFE_SB_MsgId_t    MsgId = CFE_SB_ValueToMsgId(1);
+    SAMPLE_APP_MsgContext_t MsgCtx;
 
     /* a buffer large enough for any command message */
     union
@@ -110,124 +149,130 @@ void Test_SAMPLE_APP_ProcessGroundCommand(void)
         SAMPLE_APP_ResetCountersCmd_t Reset;
         SAMPLE_APP_ProcessCmd_t       Process;
         SAMPLE_APP_DisplayParamCmd_t  DisplayParam;
+        SAMPLE_APP_ResetStatsCmd_t    ResetStats;
+        SAMPLE_APP_LookupRecordCmd_t  LookupRecord;
     } TestMsg;
     UT_CheckEvent_t EventTest;
 
     memset(&TestMsg, 0, sizeof(TestMsg));
+    memset(&MsgCtx, 0, sizeof(MsgCtx));
+    MsgCtx.MsgId = CFE_SB_ValueToMsgId(1);
+    UT_SetDefaultReturnValue(UT_KEY(SAMPLE_APP_CoalesceEvent), true);
 
     UT_CHECKEVENT_SETUP(&EventTest, SAMPLE_APP_CMD_LEN_ERR_EID,
                         "Invalid Msg length: ID = 0x%X,  CC = %u, Len = %u, Expected = %u");
 
     /*
      * call with each of the supported command codes
-     * The CFE_MSG_GetFcnCode stub allows the code to be
+     * The message context allows the code to be
      * set to whatever is needed.  There is no return
      * value here and the actual implementation of these
      * commands have separate test cases, so this just
-     * needs to exercise the "switch" statement.
+     * needs to exercise the dispatch table.
      */
 
     /* test dispatch of NOOP */
-    FcnCode = SAMPLE_APP_NOOP_CC;
-    Size    = sizeof(TestMsg.Noop);
-    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetFcnCode), &FcnCode, sizeof(FcnCode), false);
-    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetSize), &Size, sizeof(Size), false);
-
-    SAMPLE_APP_ProcessGroundCommand(&TestMsg.SBBuf);
-
+    MsgCtx.FcnCode = SAMPLE_APP_NOOP_CC;
+    MsgCtx.MsgSize = sizeof(TestMsg.Noop);
+    SAMPLE_APP_ProcessGroundCommand(&TestMsg.SBBuf, &MsgCtx);
     UtAssert_STUB_COUNT(SAMPLE_APP_NoopCmd, 1);
 
-    FcnCode = SAMPLE_APP_NOOP_CC;
-    Size    = sizeof(TestMsg.Noop) - 1;
-    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetFcnCode), &FcnCode, sizeof(FcnCode), false);
-    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetSize), &Size, sizeof(Size), false);
-    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetFcnCode), &FcnCode, sizeof(FcnCode), false);
-    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgId), &MsgId, sizeof(MsgId), false);
-
-    SAMPLE_APP_ProcessGroundCommand(&TestMsg.SBBuf);
-
+    MsgCtx.MsgSize = sizeof(TestMsg.Noop) - 1;
+    SAMPLE_APP_ProcessGroundCommand(&TestMsg.SBBuf, &MsgCtx);
     UtAssert_STUB_COUNT(SAMPLE_APP_NoopCmd, 1);
     UtAssert_UINT32_EQ(EventTest.MatchCount, 1);
 
     /* test dispatch of RESET */
-    FcnCode = SAMPLE_APP_RESET_COUNTERS_CC;
-    Size    = sizeof(TestMsg.Reset);
-    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetFcnCode), &FcnCode, sizeof(FcnCode), false);
-    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetSize), &Size, sizeof(Size), false);
-
-    SAMPLE_APP_ProcessGroundCommand(&TestMsg.SBBuf);
-
+    MsgCtx.FcnCode = SAMPLE_APP_RESET_COUNTERS_CC;
+    MsgCtx.MsgSize = sizeof(TestMsg.Reset);
+    SAMPLE_APP_ProcessGroundCommand(&TestMsg.SBBuf, &MsgCtx);
     UtAssert_STUB_COUNT(SAMPLE_APP_ResetCountersCmd, 1);
 
-    FcnCode = SAMPLE_APP_RESET_COUNTERS_CC;
-    Size    = sizeof(TestMsg.Reset) - 1;
-    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetFcnCode), &FcnCode, sizeof(FcnCode), false);
-    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetSize), &Size, sizeof(Size), false);
-    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetFcnCode), &FcnCode, sizeof(FcnCode), false);
-    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgId), &MsgId, sizeof(MsgId), false);
-
-    SAMPLE_APP_ProcessGroundCommand(&TestMsg.SBBuf);
-
+    MsgCtx.MsgSize = sizeof(TestMsg.Reset) - 1;
+    SAMPLE_APP_ProcessGroundCommand(&TestMsg.SBBuf, &MsgCtx);
     UtAssert_STUB_COUNT(SAMPLE_APP_ResetCountersCmd, 1);
     UtAssert_UINT32_EQ(EventTest.MatchCount, 2);
 
     /* test dispatch of PROCESS */
-    /* note this will end up calling SAMPLE_APP_Process(), and as such it needs to
-     * avoid dereferencing a table which does not exist. */
-    FcnCode = SAMPLE_APP_PROCESS_CC;
-    Size    = sizeof(TestMsg.Process);
-    UT_SetDefaultReturnValue(UT_KEY(CFE_TBL_GetAddress), CFE_TBL_ERR_UNREGISTERED);
-    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetFcnCode), &FcnCode, sizeof(FcnCode), false);
-    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetSize), &Size, sizeof(Size), false);
-
-    SAMPLE_APP_ProcessGroundCommand(&TestMsg.SBBuf);
-
+    MsgCtx.FcnCode = SAMPLE_APP_PROCESS_CC;
+    MsgCtx.MsgSize = sizeof(TestMsg.Process);
+    SAMPLE_APP_ProcessGroundCommand(&TestMsg.SBBuf, &MsgCtx);
     UtAssert_STUB_COUNT(SAMPLE_APP_ProcessCmd, 1);
 
-    FcnCode = SAMPLE_APP_PROCESS_CC;
-    Size    = sizeof(TestMsg.Process) - 1;
-    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetFcnCode), &FcnCode, sizeof(FcnCode), false);
-    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetSize), &Size, sizeof(Size), false);
-    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetFcnCode), &FcnCode, sizeof(FcnCode), false);
-    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgId), &MsgId, sizeof(MsgId), false);
-
-    SAMPLE_APP_ProcessGroundCommand(&TestMsg.SBBuf);
-
+    MsgCtx.MsgSize = sizeof(TestMsg.Process) - 1;
+    SAMPLE_APP_ProcessGroundCommand(&TestMsg.SBBuf, &MsgCtx);
     UtAssert_STUB_COUNT(SAMPLE_APP_ProcessCmd, 1);
     UtAssert_UINT32_EQ(EventTest.MatchCount, 3);
 
     /* test dispatch of DISPLAY_PARAM */
-    FcnCode = SAMPLE_APP_DISPLAY_PARAM_CC;
-    Size    = sizeof(TestMsg.DisplayParam);
-    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetFcnCode), &FcnCode, sizeof(FcnCode), false);
-    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetSize), &Size, sizeof(Size), false);
-
-    SAMPLE_APP_ProcessGroundCommand(&TestMsg.SBBuf);
-
+    MsgCtx.FcnCode = SAMPLE_APP_DISPLAY_PARAM_CC;
+    MsgCtx.MsgSize = sizeof(TestMsg.DisplayParam);
+    SAMPLE_APP_ProcessGroundCommand(&TestMsg.SBBuf, &MsgCtx);
     UtAssert_STUB_COUNT(SAMPLE_APP_DisplayParamCmd, 1);
 
-    FcnCode = SAMPLE_APP_DISPLAY_PARAM_CC;
-    Size    = sizeof(TestMsg.DisplayParam) - 1;
-    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetFcnCode), &FcnCode, sizeof(FcnCode), false);
-    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetSize), &Size, sizeof(Size), false);
-    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetFcnCode), &FcnCode, sizeof(FcnCode), false);
-    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgId), &MsgId, sizeof(MsgId), false);
-
-    SAMPLE_APP_ProcessGroundCommand(&TestMsg.SBBuf);
-
+    MsgCtx.MsgSize = sizeof(TestMsg.DisplayParam) - 1;
+    SAMPLE_APP_ProcessGroundCommand(&TestMsg.SBBuf, &MsgCtx);
     UtAssert_STUB_COUNT(SAMPLE_APP_DisplayParamCmd, 1);
     UtAssert_UINT32_EQ(EventTest.MatchCount, 4);
 
+    /* test dispatch of RESET_STATS */
+    MsgCtx.FcnCode = SAMPLE_APP_RESET_STATS_CC;
+    MsgCtx.MsgSize = sizeof(TestMsg.ResetStats);
+    SAMPLE_APP_ProcessGroundCommand(&TestMsg.SBBuf, &MsgCtx);
+    UtAssert_STUB_COUNT(SAMPLE_APP_ResetStatsCmd, 1);
+
+    MsgCtx.MsgSize = sizeof(TestMsg.ResetStats) - 1;
+    SAMPLE_APP_ProcessGroundCommand(&TestMsg.SBBuf, &MsgCtx);
+    UtAssert_STUB_COUNT(SAMPLE_APP_ResetStatsCmd, 1);
+    UtAssert_UINT32_EQ(EventTest.MatchCount, 5);
+
+    /* test dispatch of LOOKUP_RECORD */
+    MsgCtx.FcnCode = SAMPLE_APP_LOOKUP_RECORD_CC;
+    MsgCtx.MsgSize = sizeof(TestMsg.LookupRecord);
+    SAMPLE_APP_ProcessGroundCommand(&TestMsg.SBBuf, &MsgCtx);
+    UtAssert_STUB_COUNT(SAMPLE_APP_LookupRecordCmd, 1);
+
+    MsgCtx.MsgSize = sizeof(TestMsg.LookupRecord) - 1;
+    SAMPLE_APP_ProcessGroundCommand(&TestMsg.SBBuf, &MsgCtx);
+    UtAssert_STUB_COUNT(SAMPLE_APP_LookupRecordCmd, 1);
+    UtAssert_UINT32_EQ(EventTest.MatchCount, 6);
+
+    /* test an unused CC inside the table */
+    MsgCtx.FcnCode = SAMPLE_APP_LOOKUP_RECORD_CC + 1;
+    UT_CHECKEVENT_SETUP(&EventTest, SAMPLE_APP_CC_ERR_EID, "Invalid ground command code: CC = %d");
+    SAMPLE_APP_ProcessGroundCommand(&TestMsg.SBBuf, &MsgCtx);
+    UtAssert_UINT32_EQ(EventTest.MatchCount, 1);
+
+    /* test the first CC past the end of the table */
+    MsgCtx.FcnCode = SAMPLE_APP_ADMIT_MAX_CC;
+    SAMPLE_APP_ProcessGroundCommand(&TestMsg.SBBuf, &MsgCtx);
+    UtAssert_UINT32_EQ(EventTest.MatchCount, 2);
+
     /* test an invalid CC */
-    FcnCode = 1000;
-    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetFcnCode), &FcnCode, sizeof(FcnCode), false);
+    MsgCtx.FcnCode = 1000;
     UT_CHECKEVENT_SETUP(&EventTest, SAMPLE_APP_CC_ERR_EID, "Invalid ground command code: CC = %d");
-    SAMPLE_APP_ProcessGroundCommand(&TestMsg.SBBuf);
+    SAMPLE_APP_ProcessGroundCommand(&TestMsg.SBBuf, &MsgCtx);
 
     /*
      * Confirm that the event was generated only _once_
      */
     UtAssert_UINT32_EQ(EventTest.MatchCount, 1);
+
+    /* none of the rejected codes reached a handler */
+    UtAssert_STUB_COUNT(SAMPLE_APP_NoopCmd, 1);
+    UtAssert_STUB_COUNT(SAMPLE_APP_ResetStatsCmd, 1);
+
+    /* a repeat within the coalescing window is not sent */
+    UT_SetDeferredRetcode(UT_KEY(SAMPLE_APP_CoalesceEvent), 1, false);
+    SAMPLE_APP_ProcessGroundCommand(&TestMsg.SBBuf, &MsgCtx);
+    UtAssert_UINT32_EQ(EventTest.MatchCount, 1);
+
+    /*
+     * Confirm the header was never decoded again
+     */
+    UtAssert_STUB_COUNT(CFE_MSG_GetMsgId, 0);
+    UtAssert_STUB_COUNT(CFE_MSG_GetFcnCode, 0);
+    UtAssert_STUB_COUNT(CFE_MSG_GetSize, 0);
 }
 
 void Test_SAMPLE_APP_VerifyCmdLength(void)
@@ -236,19 +281,22 @@ void Test_SAMPLE_APP_VerifyCmdLength(void)
      * Test Case For:
      * bool SAMPLE_APP_VerifyCmdLength
      */
-    UT_CheckEvent_t   EventTest;
-    size_t            size    = 1;
-    CFE_MSG_FcnCode_t fcncode = 2;
-    CFE_SB_MsgId_t    msgid   = CFE_SB_ValueToMsgId(3);
+    UT_CheckEvent_t         EventTest;
+    SAMPLE_APP_MsgContext_t MsgCtx;
+
+    memset(&MsgCtx, 0, sizeof(MsgCtx));
+    MsgCtx.MsgSize = 1;
+    MsgCtx.FcnCode = 2;
+    MsgCtx.MsgId   = CFE_SB_ValueToMsgId(3);
+    UT_SetDefaultReturnValue(UT_KEY(SAMPLE_APP_CoalesceEvent), true);
 
     /*
      * test a match case
      */
-    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetSize), &size, sizeof(size), false);
     UT_CHECKEVENT_SETUP(&EventTest, SAMPLE_APP_CMD_LEN_ERR_EID,
                         "Invalid Msg length: ID = 0x%X,  CC = %u, Len = %u, Expected = %u");
 
-    SAMPLE_APP_VerifyCmdLength(NULL, size);
+    UtAssert_BOOL_TRUE(SAMPLE_APP_VerifyCmdLength(&MsgCtx, MsgCtx.MsgSize));
 
     /*
      * Confirm that the event was NOT generated
@@ -258,15 +306,22 @@ void Test_SAMPLE_APP_VerifyCmdLength(void)
     /*
      * test a mismatch case
      */
-    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetSize), &size, sizeof(size), false);
-    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgId), &msgid, sizeof(msgid), false);
-    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetFcnCode), &fcncode, sizeof(fcncode), false);
-    SAMPLE_APP_VerifyCmdLength(NULL, size + 1);
+    UtAssert_BOOL_FALSE(SAMPLE_APP_VerifyCmdLength(&MsgCtx, MsgCtx.MsgSize + 1));
 
     /*
      * Confirm that the event WAS generated
      */
     UtAssert_UINT32_EQ(EventTest.MatchCount, 1);
+
+    /*
+     * a repeat within the coalescing window is still rejected and counted,
+     * but the event is not sent again
+     */
+    UT_SetDeferredRetcode(UT_KEY(SAMPLE_APP_CoalesceEvent), 1, false);
+    SAMPLE_APP_Data.ErrCounter = 0;
+    UtAssert_BOOL_FALSE(SAMPLE_APP_VerifyCmdLength(&MsgCtx, MsgCtx.MsgSize + 1));
+    UtAssert_UINT32_EQ(EventTest.MatchCount, 1);
+    UtAssert_UINT32_EQ(SAMPLE_APP_Data.ErrCounter, 1);
 }
 
 /*
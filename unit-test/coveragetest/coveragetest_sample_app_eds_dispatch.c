@@ -18,27 +18,54 @@
 
 /*
 ** Purpose:
-** Coverage Unit Test cases for the SAMPLE Application
+** Coverage Unit Test cases for the SAMPLE Application EDS dispatcher
 **
 ** Notes:
 ** This implements various test cases to exercise all code
-** paths through all functions defined in the SAMPLE application.
-**
-** It is primarily focused at providing examples of the various
-** stub configurations, hook functions, and wrapper calls that
-** are often needed when coercing certain code paths through
-** complex functions.
+** paths through all functions defined in the SAMPLE application
+** when it is built with the EDS generated command dispatcher.
 */
 
 /*
  * Includes
  */
-
 #include "sample_app_coveragetest_common.h"
 #include "sample_app.h"
 #include "sample_app_dispatch.h"
 #include "sample_app_cmds.h"
 
+#include "sample_app_eds_dispatcher.h"
+#include "utgenstub.h"
+
+/*
+ * The generated dispatcher is not part of the unit under test, so
+ * provide a stub for it here
+ */
+CFE_Status_t EdsDispatch_SAMPLE_APP_Application_Telecommand(
+    const CFE_SB_Buffer_t *Buffer, const EdsDispatchTable_SAMPLE_APP_Application_CFE_SB_Telecommand_t *DispatchTable)
+{
+    UT_GenStub_SetupReturnBuffer(EdsDispatch_SAMPLE_APP_Application_Telecommand, CFE_Status_t);
+
+    UT_GenStub_AddParam(EdsDispatch_SAMPLE_APP_Application_Telecommand, const CFE_SB_Buffer_t *, Buffer);
+    UT_GenStub_AddParam(EdsDispatch_SAMPLE_APP_Application_Telecommand,
+                        const EdsDispatchTable_SAMPLE_APP_Application_CFE_SB_Telecommand_t *, DispatchTable);
+
+    UT_GenStub_Execute(EdsDispatch_SAMPLE_APP_Application_Telecommand, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(EdsDispatch_SAMPLE_APP_Application_Telecommand, CFE_Status_t);
+}
+
+/*
+ * Handler to capture the dispatch table the generated dispatcher was given
+ */
+static void UT_Handler_EdsDispatch(void *UserObj, UT_EntryKey_t FuncKey, const UT_StubContext_t *Context)
+{
+    const EdsDispatchTable_SAMPLE_APP_Application_CFE_SB_Telecommand_t **DispatchTable = UserObj;
+
+    *DispatchTable = UT_Hook_GetArgValueByName(Context, "DispatchTable",
+                                               const EdsDispatchTable_SAMPLE_APP_Application_CFE_SB_Telecommand_t *);
+}
+
 /*
 **********************************************************************************
 **          TEST CASE FUNCTIONS
@@ -49,8 +76,138 @@ void Test_SAMPLE_APP_TaskPipe(void)
 {
     /*
      * Test Case For:
-     * void SAMPLE_APP_TaskPipe
+     * void SAMPLE_APP_TaskPipe( const CFE_SB_Buffer_t *SBBufPtr, const SAMPLE_APP_MsgContext_t *MsgCtx )
      */
+    /* a buffer large enough for any command message */
+    union
+    {
+        CFE_SB_Buffer_t            SBBuf;
+        SAMPLE_APP_NoopCmd_t       Noop;
+        SAMPLE_APP_SensorDataCmd_t SensorData;
+    } TestMsg;
+    SAMPLE_APP_MsgContext_t MsgCtx;
+
+    memset(&TestMsg, 0, sizeof(TestMsg));
+    memset(&MsgCtx, 0, sizeof(MsgCtx));
+    UT_SetDefaultReturnValue(UT_KEY(SAMPLE_APP_RateLimitCheck), true);
+    UT_SetDefaultReturnValue(UT_KEY(SAMPLE_APP_AdmitCommand), true);
+
+    /* an admitted command goes to the generated dispatcher, header fields come from the context */
+    MsgCtx.MsgId   = CFE_SB_ValueToMsgId(SAMPLE_APP_CMD_MID);
+    MsgCtx.FcnCode = SAMPLE_APP_NOOP_CC;
+    MsgCtx.MsgSize = sizeof(TestMsg.Noop);
+    SAMPLE_APP_TaskPipe(&TestMsg.SBBuf, &MsgCtx);
+    UtAssert_STUB_COUNT(EdsDispatch_SAMPLE_APP_Application_Telecommand, 1);
+    UtAssert_STUB_COUNT(CFE_MSG_GetMsgId, 0);
+    UtAssert_STUB_COUNT(CFE_MSG_GetFcnCode, 0);
+    UtAssert_STUB_COUNT(CFE_MSG_GetSize, 0);
+
+    /* sensor data takes the same path */
+    MsgCtx.MsgId   = CFE_SB_ValueToMsgId(SAMPLE_APP_SENSOR_DATA_MID);
+    MsgCtx.MsgSize = sizeof(TestMsg.SensorData);
+    SAMPLE_APP_TaskPipe(&TestMsg.SBBuf, &MsgCtx);
+    UtAssert_STUB_COUNT(EdsDispatch_SAMPLE_APP_Application_Telecommand, 2);
+
+    /* a command held back by admission control is not dispatched */
+    UT_SetDeferredRetcode(UT_KEY(SAMPLE_APP_AdmitCommand), 1, false);
+    MsgCtx.MsgId = CFE_SB_ValueToMsgId(SAMPLE_APP_CMD_MID);
+    SAMPLE_APP_TaskPipe(&TestMsg.SBBuf, &MsgCtx);
+    UtAssert_STUB_COUNT(EdsDispatch_SAMPLE_APP_Application_Telecommand, 2);
+    UtAssert_STUB_COUNT(SAMPLE_APP_AdmitCommand, 3);
+
+    /* a message over its rate limit is dropped before admission control */
+    UT_SetDeferredRetcode(UT_KEY(SAMPLE_APP_RateLimitCheck), 1, false);
+    SAMPLE_APP_TaskPipe(&TestMsg.SBBuf, &MsgCtx);
+    UtAssert_STUB_COUNT(EdsDispatch_SAMPLE_APP_Application_Telecommand, 2);
+    UtAssert_STUB_COUNT(SAMPLE_APP_AdmitCommand, 3);
+    UtAssert_STUB_COUNT(SAMPLE_APP_RateLimitCheck, 4);
+
+    /* limit checked telemetry is consumed before rate limits and dispatch */
+    UT_SetDeferredRetcode(UT_KEY(SAMPLE_APP_LimitCheckPacket), 1, true);
+    MsgCtx.MsgId = CFE_SB_ValueToMsgId(SAMPLE_APP_HK_TLM_MID);
+    SAMPLE_APP_TaskPipe(&TestMsg.SBBuf, &MsgCtx);
+    UtAssert_STUB_COUNT(SAMPLE_APP_LimitCheckPacket, 5);
+    UtAssert_STUB_COUNT(SAMPLE_APP_RateLimitCheck, 4);
+    UtAssert_STUB_COUNT(EdsDispatch_SAMPLE_APP_Application_Telecommand, 2);
+}
+
+void Test_SAMPLE_APP_ProcessGroundCommand(void)
+{
+    /*
+     * Test Case For:
+     * void SAMPLE_APP_ProcessGroundCommand( const CFE_SB_Buffer_t *SBBufPtr, const SAMPLE_APP_MsgContext_t *MsgCtx )
+     */
+    union
+    {
+        CFE_SB_Buffer_t      SBBuf;
+        SAMPLE_APP_NoopCmd_t Noop;
+    } TestMsg;
+    const EdsDispatchTable_SAMPLE_APP_Application_CFE_SB_Telecommand_t *DispatchTable = NULL;
+    SAMPLE_APP_MsgContext_t                                             MsgCtx;
+    UT_CheckEvent_t                                                     EventTest;
+
+    memset(&TestMsg, 0, sizeof(TestMsg));
+    memset(&MsgCtx, 0, sizeof(MsgCtx));
+    memset(&SAMPLE_APP_Data, 0, sizeof(SAMPLE_APP_Data));
+    UT_SetDefaultReturnValue(UT_KEY(SAMPLE_APP_CoalesceEvent), true);
+    UT_SetHandlerFunction(UT_KEY(EdsDispatch_SAMPLE_APP_Application_Telecommand), UT_Handler_EdsDispatch,
+                          &DispatchTable);
+
+    /* every command, the sensor data and the housekeeping wakeup route to their handlers */
+    MsgCtx.MsgId   = CFE_SB_ValueToMsgId(SAMPLE_APP_CMD_MID);
+    MsgCtx.FcnCode = SAMPLE_APP_NOOP_CC;
+    MsgCtx.MsgSize = sizeof(TestMsg.Noop);
+    SAMPLE_APP_ProcessGroundCommand(&TestMsg.SBBuf, &MsgCtx);
+    UtAssert_NOT_NULL(DispatchTable);
+    UtAssert_True(DispatchTable->CMD.NoopCmd_indication == SAMPLE_APP_NoopCmd, "NOOP dispatches to NoopCmd");
+    UtAssert_True(DispatchTable->CMD.ResetCountersCmd_indication == SAMPLE_APP_ResetCountersCmd,
+                  "RESET_COUNTERS dispatches to ResetCountersCmd");
+    UtAssert_True(DispatchTable->CMD.ProcessCmd_indication == SAMPLE_APP_ProcessCmd,
+                  "PROCESS dispatches to ProcessCmd");
+    UtAssert_True(DispatchTable->CMD.DisplayParamCmd_indication == SAMPLE_APP_DisplayParamCmd,
+                  "DISPLAY_PARAM dispatches to DisplayParamCmd");
+    UtAssert_True(DispatchTable->CMD.ResetStatsCmd_indication == SAMPLE_APP_ResetStatsCmd,
+                  "RESET_STATS dispatches to ResetStatsCmd");
+    UtAssert_True(DispatchTable->CMD.LookupRecordCmd_indication == SAMPLE_APP_LookupRecordCmd,
+                  "LOOKUP_RECORD dispatches to LookupRecordCmd");
+    UtAssert_True(DispatchTable->SENSOR_DATA.indication == SAMPLE_APP_SensorDataCmd,
+                  "SENSOR_DATA dispatches to SensorDataCmd");
+    UtAssert_True(DispatchTable->SEND_HK.indication == SAMPLE_APP_TlmScheduleCmd,
+                  "SEND_HK dispatches to TlmScheduleCmd");
+    UtAssert_ZERO(SAMPLE_APP_Data.ErrCounter);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+
+    /* an unknown message id */
+    UT_CHECKEVENT_SETUP(&EventTest, SAMPLE_APP_MID_ERR_EID, "SAMPLE: invalid command packet,MID = 0x%x");
+    UT_SetDeferredRetcode(UT_KEY(EdsDispatch_SAMPLE_APP_Application_Telecommand), 1, CFE_STATUS_UNKNOWN_MSG_ID);
+    SAMPLE_APP_ProcessGroundCommand(&TestMsg.SBBuf, &MsgCtx);
+    UtAssert_UINT32_EQ(EventTest.MatchCount, 1);
+    UtAssert_UINT32_EQ(SAMPLE_APP_Data.ErrCounter, 1);
+
+    /* a message of the wrong length */
+    UT_CHECKEVENT_SETUP(&EventTest, SAMPLE_APP_CMD_LEN_ERR_EID, "Invalid Msg length: ID = 0x%X,  CC = %u, Len = %u");
+    UT_SetDeferredRetcode(UT_KEY(EdsDispatch_SAMPLE_APP_Application_Telecommand), 1, CFE_STATUS_WRONG_MSG_LENGTH);
+    SAMPLE_APP_ProcessGroundCommand(&TestMsg.SBBuf, &MsgCtx);
+    UtAssert_UINT32_EQ(EventTest.MatchCount, 1);
+    UtAssert_UINT32_EQ(SAMPLE_APP_Data.ErrCounter, 2);
+
+    /* any other failure is an unknown command code */
+    UT_CHECKEVENT_SETUP(&EventTest, SAMPLE_APP_CC_ERR_EID, "SAMPLE: Invalid ground command code: CC = %d");
+    UT_SetDeferredRetcode(UT_KEY(EdsDispatch_SAMPLE_APP_Application_Telecommand), 1, CFE_STATUS_BAD_COMMAND_CODE);
+    SAMPLE_APP_ProcessGroundCommand(&TestMsg.SBBuf, &MsgCtx);
+    UtAssert_UINT32_EQ(EventTest.MatchCount, 1);
+    UtAssert_UINT32_EQ(SAMPLE_APP_Data.ErrCounter, 3);
+
+    /* repeats within the coalescing window are counted but not sent */
+    UT_SetDefaultReturnValue(UT_KEY(SAMPLE_APP_CoalesceEvent), false);
+    UT_SetDeferredRetcode(UT_KEY(EdsDispatch_SAMPLE_APP_Application_Telecommand), 1, CFE_STATUS_UNKNOWN_MSG_ID);
+    SAMPLE_APP_ProcessGroundCommand(&TestMsg.SBBuf, &MsgCtx);
+    UT_SetDeferredRetcode(UT_KEY(EdsDispatch_SAMPLE_APP_Application_Telecommand), 1, CFE_STATUS_WRONG_MSG_LENGTH);
+    SAMPLE_APP_ProcessGroundCommand(&TestMsg.SBBuf, &MsgCtx);
+    UT_SetDeferredRetcode(UT_KEY(EdsDispatch_SAMPLE_APP_Application_Telecommand), 1, CFE_STATUS_BAD_COMMAND_CODE);
+    SAMPLE_APP_ProcessGroundCommand(&TestMsg.SBBuf, &MsgCtx);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 3);
+    UtAssert_UINT32_EQ(SAMPLE_APP_Data.ErrCounter, 6);
 }
 
 /*
@@ -59,4 +216,5 @@ void Test_SAMPLE_APP_TaskPipe(void)
 void UtTest_Setup(void)
 {
     ADD_TEST(SAMPLE_APP_TaskPipe);
+    ADD_TEST(SAMPLE_APP_ProcessGroundCommand);
 }
@@ -0,0 +1,167 @@
+/************************************************************************
+ * NASA Docket No. GSC-18,719-1, and identified as “core Flight System: Bootes”
+ *
+ * Copyright (c) 2020 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/*
+** File: coveragetest_sample_app.c
+**
+** Purpose:
+** Coverage Unit Test cases for the Sample Application
+**
+** Notes:
+** This implements various test cases to exercise all code
+** paths through all functions defined in the Sample application.
+**
+** It is primarily focused at providing examples of the various
+** stub configurations, hook functions, and wrapper calls that
+** are often needed when coercing certain code paths through
+** complex functions.
+*/
+
+
+/*
+ * Includes
+ */
+#include "sample_app_coveragetest_common.h"
+
+/*
+ * Number of randomized filters compared between the two kernels
+ */
+#define UT_FIR_RANDOM_FILTERS 200
+
+/*
+**********************************************************************************
+**          TEST CASE FUNCTIONS
+**********************************************************************************
+*/
+
+void Test_SAMPLE_APP_FirFilterS16Scalar(void)
+{
+    /*
+     * Test Case For:
+     * void SAMPLE_APP_FirFilterS16Scalar( const int16 *In, int16 *Out, uint32 Count, const int16 *Taps,
+     *                                     uint32 NumTaps )
+     */
+    int16 In[5]   = {100, -200, 300, -32768, 32767};
+    int16 Taps[2] = {16384, 16384};
+    int16 Out[4];
+
+    /* two tap average, rounded */
+    SAMPLE_APP_FirFilterS16Scalar(In, Out, 4, Taps, 2);
+    UtAssert_INT32_EQ(Out[0], -50);
+    UtAssert_INT32_EQ(Out[1], 50);
+    UtAssert_INT32_EQ(Out[2], -16234);
+    UtAssert_INT32_EQ(Out[3], 0);
+
+    /* a full scale negative input through a negated unity tap saturates */
+    Taps[0] = -32768;
+    SAMPLE_APP_FirFilterS16Scalar(&In[3], Out, 1, Taps, 1);
+    UtAssert_INT32_EQ(Out[0], 32767);
+
+    /* while the largest positive tap stays in range */
+    Taps[0] = 32767;
+    SAMPLE_APP_FirFilterS16Scalar(&In[3], Out, 1, Taps, 1);
+    UtAssert_INT32_EQ(Out[0], -32767);
+}
+
+void Test_SAMPLE_APP_FirFilterS16(void)
+{
+    /*
+     * Test Case For:
+     * void SAMPLE_APP_FirFilterS16( const int16 *In, int16 *Out, uint32 Count, const int16 *Taps, uint32 NumTaps )
+     */
+    int16  In[SAMPLE_APP_FIR_MAX_TAPS - 1 + SAMPLE_APP_SENSOR_BLOCK_SAMPLES];
+    int16  Taps[SAMPLE_APP_FIR_MAX_TAPS];
+    int16  Out[SAMPLE_APP_SENSOR_BLOCK_SAMPLES];
+    int16  Ref[SAMPLE_APP_SENSOR_BLOCK_SAMPLES];
+    uint32 Seed = 1;
+    uint32 Count;
+    uint32 NumTaps;
+    uint32 Gain;
+    uint32 Mismatches = 0;
+    uint32 i;
+    uint32 n;
+
+    /* a single unity tap passes samples through */
+    for (i = 0; i < SAMPLE_APP_SENSOR_BLOCK_SAMPLES; ++i)
+    {
+        In[i] = (int16)(i * 100);
+    }
+    Taps[0] = 32767;
+    SAMPLE_APP_FirFilterS16(In, Out, SAMPLE_APP_SENSOR_BLOCK_SAMPLES, Taps, 1);
+    UtAssert_INT32_EQ(Out[5], 500);
+    UtAssert_INT32_EQ(Out[SAMPLE_APP_SENSOR_BLOCK_SAMPLES - 1], In[SAMPLE_APP_SENSOR_BLOCK_SAMPLES - 1]);
+
+    /*
+     * Randomized filters of every length up to the maximum, with random
+     * taps of just under unity gain and full scale input, must give the same
+     * answer as the scalar reference
+     */
+    for (n = 0; n < UT_FIR_RANDOM_FILTERS; ++n)
+    {
+        NumTaps = UT_Random(&Seed) % (SAMPLE_APP_FIR_MAX_TAPS + 1);
+        Count   = UT_Random(&Seed) % (SAMPLE_APP_SENSOR_BLOCK_SAMPLES + 1);
+        Gain    = SAMPLE_APP_FIR_UNITY_GAIN - 1;
+
+        for (i = 0; i < NumTaps; ++i)
+        {
+            Taps[i] = (int16)(UT_Random(&Seed) % (Gain + 1));
+            Gain -= Taps[i];
+            if (UT_Random(&Seed) & 1)
+            {
+                Taps[i] = -Taps[i];
+            }
+        }
+
+        for (i = 0; i < (sizeof(In) / sizeof(In[0])); ++i)
+        {
+            In[i] = (int16)UT_Random(&Seed);
+        }
+
+        SAMPLE_APP_FirFilterS16(In, Out, Count, Taps, NumTaps);
+        SAMPLE_APP_FirFilterS16Scalar(In, Ref, Count, Taps, NumTaps);
+
+        if (memcmp(Out, Ref, Count * sizeof(Out[0])) != 0)
+        {
+            ++Mismatches;
+        }
+    }
+
+    UtAssert_ZERO(Mismatches);
+}
+
+void Test_SAMPLE_APP_FirGain(void)
+{
+    /*
+     * Test Case For:
+     * uint32 SAMPLE_APP_FirGain( const int16 *Taps, uint32 NumTaps )
+     */
+    int16 Taps[3] = {-32768, 16384, 100};
+
+    UtAssert_UINT32_EQ(SAMPLE_APP_FirGain(Taps, 0), 0);
+    UtAssert_UINT32_EQ(SAMPLE_APP_FirGain(Taps, 3), 49252);
+}
+
+/*
+ * Register the test cases to execute with the unit test tool
+ */
+void UtTest_Setup(void)
+{
+    ADD_TEST(SAMPLE_APP_FirFilterS16Scalar);
+    ADD_TEST(SAMPLE_APP_FirFilterS16);
+    ADD_TEST(SAMPLE_APP_FirGain);
+}
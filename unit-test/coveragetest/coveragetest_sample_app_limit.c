@@ -0,0 +1,499 @@
+/************************************************************************
+ * NASA Docket No. GSC-18,719-1, and identified as “core Flight System: Bootes”
+ *
+ * Copyright (c) 2020 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/*
+** File: coveragetest_sample_app.c
+**
+** Purpose:
+** Coverage Unit Test cases for the Sample Application
+**
+** Notes:
+** This implements various test cases to exercise all code
+** paths through all functions defined in the Sample application.
+**
+** It is primarily focused at providing examples of the various
+** stub configurations, hook functions, and wrapper calls that
+** are often needed when coercing certain code paths through
+** complex functions.
+*/
+
+
+/*
+ * Includes
+ */
+#include "sample_app_coveragetest_common.h"
+
+/*
+ * Number of randomized batches compared between the two kernels
+ */
+#define UT_LIMIT_RANDOM_BATCHES 200
+
+/*
+ * Value near zero, so values and limits often compare equal
+ */
+static int32 UT_LimitRandomValue(uint32 *Seed)
+{
+    switch (UT_Random(Seed) % 16)
+    {
+        case 0:
+            return INT32_MIN;
+
+        case 1:
+            return INT32_MAX;
+
+        default:
+            return (int32)(UT_Random(Seed) % 41) - 20;
+    }
+}
+
+/*
+ * Set up a compiled limit table from TestTblData, as after a table update
+ */
+static void UT_LimitLoad(SAMPLE_APP_LimitTable_t *TestTblData)
+{
+    void *TblPtr = TestTblData;
+
+    UT_SetDataBuffer(UT_KEY(CFE_TBL_GetAddress), &TblPtr, sizeof(TblPtr), false);
+    UT_SetDeferredRetcode(UT_KEY(CFE_TBL_GetAddress), 1, CFE_TBL_INFO_UPDATED);
+    SAMPLE_APP_UpdateLimits();
+}
+
+/*
+**********************************************************************************
+**          TEST CASE FUNCTIONS
+**********************************************************************************
+*/
+
+void Test_SAMPLE_APP_LimitValidationFunc(void)
+{
+    /*
+     * Test Case For:
+     * CFE_Status_t SAMPLE_APP_LimitValidationFunc( void *TblData )
+     */
+    SAMPLE_APP_LimitTable_t TestTblData;
+
+    memset(&TestTblData, 0, sizeof(TestTblData));
+
+    /* an empty table checks nothing and is valid */
+    UtAssert_INT32_EQ(SAMPLE_APP_LimitValidationFunc(&TestTblData), CFE_SUCCESS);
+
+    TestTblData.Entry[0].MsgId      = SAMPLE_APP_HK_TLM_MID;
+    TestTblData.Entry[0].Offset     = sizeof(CFE_MSG_TelemetryHeader_t);
+    TestTblData.Entry[0].Type       = SAMPLE_APP_LIMIT_TYPE_INT16;
+    TestTblData.Entry[0].RedLow     = -100;
+    TestTblData.Entry[0].YellowLow  = -50;
+    TestTblData.Entry[0].YellowHigh = 50;
+    TestTblData.Entry[0].RedHigh    = 100;
+    TestTblData.Entry[1]            = TestTblData.Entry[0];
+    TestTblData.Entry[1].Type       = SAMPLE_APP_LIMIT_TYPE_INT32;
+    UtAssert_INT32_EQ(SAMPLE_APP_LimitValidationFunc(&TestTblData), CFE_SUCCESS);
+
+    /* equal limits are allowed */
+    TestTblData.Entry[1].YellowLow = TestTblData.Entry[1].RedLow;
+    UtAssert_INT32_EQ(SAMPLE_APP_LimitValidationFunc(&TestTblData), CFE_SUCCESS);
+
+    /* an unknown type */
+    TestTblData.Entry[1].Type = 0;
+    UtAssert_INT32_EQ(SAMPLE_APP_LimitValidationFunc(&TestTblData), SAMPLE_APP_TABLE_OUT_OF_RANGE_ERR_CODE);
+
+    /* a MID the app already receives */
+    TestTblData.Entry[1].Type  = SAMPLE_APP_LIMIT_TYPE_UINT8;
+    TestTblData.Entry[1].MsgId = SAMPLE_APP_SENSOR_DATA_MID;
+    UtAssert_INT32_EQ(SAMPLE_APP_LimitValidationFunc(&TestTblData), SAMPLE_APP_TABLE_OUT_OF_RANGE_ERR_CODE);
+
+    /* a point within the telemetry header */
+    TestTblData.Entry[1].MsgId  = SAMPLE_APP_STATS_TLM_MID;
+    TestTblData.Entry[1].Offset = sizeof(CFE_MSG_TelemetryHeader_t) - 1;
+    UtAssert_INT32_EQ(SAMPLE_APP_LimitValidationFunc(&TestTblData), SAMPLE_APP_TABLE_OUT_OF_RANGE_ERR_CODE);
+
+    /* or past the largest message */
+    TestTblData.Entry[1].Offset = CFE_MISSION_SB_MAX_SB_MSG_SIZE;
+    UtAssert_INT32_EQ(SAMPLE_APP_LimitValidationFunc(&TestTblData), SAMPLE_APP_TABLE_OUT_OF_RANGE_ERR_CODE);
+
+    /* limits out of order, at each place */
+    TestTblData.Entry[1].Offset    = sizeof(CFE_MSG_TelemetryHeader_t);
+    TestTblData.Entry[1].YellowLow = TestTblData.Entry[1].RedLow - 1;
+    UtAssert_INT32_EQ(SAMPLE_APP_LimitValidationFunc(&TestTblData), SAMPLE_APP_TABLE_OUT_OF_RANGE_ERR_CODE);
+
+    TestTblData.Entry[1].YellowLow = TestTblData.Entry[1].YellowHigh + 1;
+    UtAssert_INT32_EQ(SAMPLE_APP_LimitValidationFunc(&TestTblData), SAMPLE_APP_TABLE_OUT_OF_RANGE_ERR_CODE);
+
+    TestTblData.Entry[1].YellowLow  = -50;
+    TestTblData.Entry[1].YellowHigh = TestTblData.Entry[1].RedHigh + 1;
+    UtAssert_INT32_EQ(SAMPLE_APP_LimitValidationFunc(&TestTblData), SAMPLE_APP_TABLE_OUT_OF_RANGE_ERR_CODE);
+}
+
+void Test_SAMPLE_APP_UpdateLimits(void)
+{
+    /*
+     * Test Case For:
+     * void SAMPLE_APP_UpdateLimits( void )
+     */
+    SAMPLE_APP_LimitTable_t TestTblData;
+    void *                  TblPtr = &TestTblData;
+    SAMPLE_APP_LimitSet_t * Set    = &SAMPLE_APP_Data.Limit;
+    UT_CheckEvent_t         EventTest;
+
+    memset(&TestTblData, 0, sizeof(TestTblData));
+    memset(&SAMPLE_APP_Data, 0, sizeof(SAMPLE_APP_Data));
+
+    /* points out of order, and with a gap in the table */
+    TestTblData.Entry[0].MsgId   = SAMPLE_APP_STATS_TLM_MID;
+    TestTblData.Entry[0].Offset  = 20;
+    TestTblData.Entry[0].Type    = SAMPLE_APP_LIMIT_TYPE_INT16;
+    TestTblData.Entry[0].RedHigh = 1;
+    TestTblData.Entry[1]         = TestTblData.Entry[0];
+    TestTblData.Entry[1].MsgId   = SAMPLE_APP_HK_TLM_MID;
+    TestTblData.Entry[1].Type    = SAMPLE_APP_LIMIT_TYPE_UINT8;
+    TestTblData.Entry[1].RedHigh = 2;
+    TestTblData.Entry[3]         = TestTblData.Entry[0];
+    TestTblData.Entry[3].Type    = SAMPLE_APP_LIMIT_TYPE_UINT8;
+    TestTblData.Entry[3].Offset  = 40;
+    TestTblData.Entry[3].RedHigh = 3;
+    TestTblData.Entry[4]         = TestTblData.Entry[0];
+    TestTblData.Entry[4].Offset  = 12;
+    TestTblData.Entry[4].RedHigh = 4;
+
+    /* unchanged table, nothing is compiled */
+    UT_SetDataBuffer(UT_KEY(CFE_TBL_GetAddress), &TblPtr, sizeof(TblPtr), false);
+    SAMPLE_APP_UpdateLimits();
+    UtAssert_ZERO(Set->NumGroups);
+    UtAssert_STUB_COUNT(CFE_TBL_ReleaseAddress, 1);
+
+    /* a table that cannot be read is not released */
+    UT_SetDeferredRetcode(UT_KEY(CFE_TBL_GetAddress), 1, CFE_TBL_ERR_NEVER_LOADED);
+    SAMPLE_APP_UpdateLimits();
+    UtAssert_STUB_COUNT(CFE_TBL_ReleaseAddress, 1);
+
+    /* updated table, grouped by MID then type, in table order within a group */
+    UT_LimitLoad(&TestTblData);
+    UtAssert_STUB_COUNT(CFE_TBL_ReleaseAddress, 2);
+    UtAssert_UINT32_EQ(Set->NumGroups, 3);
+    UtAssert_UINT32_EQ(Set->Group[0].MsgId, SAMPLE_APP_HK_TLM_MID);
+    UtAssert_UINT32_EQ(Set->Group[0].Count, 1);
+    UtAssert_UINT32_EQ(Set->Group[0].MinSize, 21);
+    UtAssert_UINT32_EQ(Set->Group[1].MsgId, SAMPLE_APP_STATS_TLM_MID);
+    UtAssert_UINT32_EQ(Set->Group[1].Type, SAMPLE_APP_LIMIT_TYPE_UINT8);
+    UtAssert_UINT32_EQ(Set->Group[1].First, 1);
+    UtAssert_UINT32_EQ(Set->Group[1].MinSize, 41);
+    UtAssert_UINT32_EQ(Set->Group[2].Type, SAMPLE_APP_LIMIT_TYPE_INT16);
+    UtAssert_UINT32_EQ(Set->Group[2].First, 2);
+    UtAssert_UINT32_EQ(Set->Group[2].Count, 2);
+    UtAssert_UINT32_EQ(Set->Group[2].MinSize, 22);
+    UtAssert_UINT32_EQ(Set->EntryIdx[0], 1);
+    UtAssert_UINT32_EQ(Set->EntryIdx[1], 3);
+    UtAssert_UINT32_EQ(Set->EntryIdx[2], 0);
+    UtAssert_UINT32_EQ(Set->EntryIdx[3], 4);
+    UtAssert_UINT32_EQ(Set->Offset[3], 12);
+    UtAssert_INT32_EQ(Set->RedHigh[3], 4);
+
+    /* each MID is subscribed once, on the lowest priority pipe */
+    UtAssert_STUB_COUNT(CFE_SB_SubscribeEx, 2);
+    UtAssert_STUB_COUNT(CFE_SB_Unsubscribe, 0);
+
+    /* a second update drops the old subscriptions and states first */
+    Set->State[1] = SAMPLE_APP_LIMIT_YELLOW_HIGH;
+    UT_CHECKEVENT_SETUP(&EventTest, SAMPLE_APP_SUB_CMD_ERR_EID,
+                        "Sample App: Error Subscribing to limit checked MID 0x%lX, RC = 0x%08lX");
+    UT_SetDeferredRetcode(UT_KEY(CFE_SB_SubscribeEx), 1, CFE_SB_BAD_ARGUMENT);
+    UT_LimitLoad(&TestTblData);
+    UtAssert_STUB_COUNT(CFE_SB_Unsubscribe, 2);
+    UtAssert_STUB_COUNT(CFE_SB_SubscribeEx, 4);
+    UtAssert_UINT32_EQ(EventTest.MatchCount, 1);
+    UtAssert_ZERO(Set->State[1]);
+    UtAssert_UINT32_EQ(Set->NumGroups, 3);
+}
+
+void Test_SAMPLE_APP_LimitEvalScalar(void)
+{
+    /*
+     * Test Case For:
+     * void SAMPLE_APP_LimitEvalScalar( const SAMPLE_APP_LimitSet_t *Set, uint32 First, uint32 Count,
+     *                                  const int32 *Value, uint8 *State )
+     */
+    SAMPLE_APP_LimitSet_t Set;
+    int32                 Value[7] = {-101, -100, -51, 0, 51, 100, 101};
+    uint8                 State[7];
+    uint32                i;
+
+    memset(&Set, 0, sizeof(Set));
+    for (i = 0; i < 8; ++i)
+    {
+        Set.RedLow[i]     = -100;
+        Set.YellowLow[i]  = -50;
+        Set.YellowHigh[i] = 50;
+        Set.RedHigh[i]    = 100;
+    }
+
+    /* a value on a limit is within it */
+    SAMPLE_APP_LimitEvalScalar(&Set, 1, 7, Value, State);
+    UtAssert_UINT32_EQ(State[0], SAMPLE_APP_LIMIT_RED_LOW | SAMPLE_APP_LIMIT_YELLOW_LOW);
+    UtAssert_UINT32_EQ(State[1], SAMPLE_APP_LIMIT_YELLOW_LOW);
+    UtAssert_UINT32_EQ(State[2], SAMPLE_APP_LIMIT_YELLOW_LOW);
+    UtAssert_ZERO(State[3]);
+    UtAssert_UINT32_EQ(State[4], SAMPLE_APP_LIMIT_YELLOW_HIGH);
+    UtAssert_UINT32_EQ(State[5], SAMPLE_APP_LIMIT_YELLOW_HIGH);
+    UtAssert_UINT32_EQ(State[6], SAMPLE_APP_LIMIT_RED_HIGH | SAMPLE_APP_LIMIT_YELLOW_HIGH);
+}
+
+void Test_SAMPLE_APP_LimitEval(void)
+{
+    /*
+     * Test Case For:
+     * void SAMPLE_APP_LimitEval( const SAMPLE_APP_LimitSet_t *Set, uint32 First, uint32 Count,
+     *                            const int32 *Value, uint8 *State )
+     */
+    SAMPLE_APP_LimitSet_t Set;
+    int32                 Value[SAMPLE_APP_LIMIT_MAX_ENTRIES];
+    int32                 Limit[4];
+    int32                 Swap;
+    uint8                 State[SAMPLE_APP_LIMIT_MAX_ENTRIES];
+    uint8                 Ref[SAMPLE_APP_LIMIT_MAX_ENTRIES];
+    uint32                Seed       = 1;
+    uint32                Mismatches = 0;
+    uint32                First;
+    uint32                Count;
+    uint32                i;
+    uint32                j;
+    uint32                k;
+    uint32                n;
+
+    /*
+     * Randomized batches of every length at every starting column, with
+     * values and limits close enough to often be equal, must give the same
+     * answer as the scalar reference
+     */
+    for (n = 0; n < UT_LIMIT_RANDOM_BATCHES; ++n)
+    {
+        for (i = 0; i < SAMPLE_APP_LIMIT_MAX_ENTRIES; ++i)
+        {
+            /* four random limits, put in order */
+            for (j = 0; j < 4; ++j)
+            {
+                Limit[j] = UT_LimitRandomValue(&Seed);
+            }
+            for (j = 0; j < 3; ++j)
+            {
+                for (k = 0; k < 3 - j; ++k)
+                {
+                    if (Limit[k] > Limit[k + 1])
+                    {
+                        Swap         = Limit[k];
+                        Limit[k]     = Limit[k + 1];
+                        Limit[k + 1] = Swap;
+                    }
+                }
+            }
+
+            Set.RedLow[i]     = Limit[0];
+            Set.YellowLow[i]  = Limit[1];
+            Set.YellowHigh[i] = Limit[2];
+            Set.RedHigh[i]    = Limit[3];
+            Value[i]          = UT_LimitRandomValue(&Seed);
+        }
+
+        First = UT_Random(&Seed) % (SAMPLE_APP_LIMIT_MAX_ENTRIES + 1);
+        Count = UT_Random(&Seed) % (SAMPLE_APP_LIMIT_MAX_ENTRIES - First + 1);
+
+        SAMPLE_APP_LimitEval(&Set, First, Count, Value, State);
+        SAMPLE_APP_LimitEvalScalar(&Set, First, Count, Value, Ref);
+
+        if (memcmp(State, Ref, Count) != 0)
+        {
+            ++Mismatches;
+        }
+    }
+
+    UtAssert_ZERO(Mismatches);
+}
+
+void Test_SAMPLE_APP_LimitCheckPacket(void)
+{
+    /*
+     * Test Case For:
+     * bool SAMPLE_APP_LimitCheckPacket( const CFE_SB_Buffer_t *SBBufPtr, const SAMPLE_APP_MsgContext_t *MsgCtx )
+     */
+    SAMPLE_APP_LimitTable_t TestTblData;
+    SAMPLE_APP_MsgContext_t MsgCtx;
+    SAMPLE_APP_LimitSet_t * Set = &SAMPLE_APP_Data.Limit;
+    UT_CheckEvent_t         EventTest;
+    UT_CheckEvent_t         LenEventTest;
+    int16                   S16;
+    union
+    {
+        CFE_SB_Buffer_t SBBuf;
+        uint8           Byte[64];
+    } TestMsg;
+
+    memset(&TestTblData, 0, sizeof(TestTblData));
+    memset(&SAMPLE_APP_Data, 0, sizeof(SAMPLE_APP_Data));
+    memset(&MsgCtx, 0, sizeof(MsgCtx));
+    memset(&TestMsg, 0, sizeof(TestMsg));
+    UT_SetDefaultReturnValue(UT_KEY(SAMPLE_APP_CoalesceEvent), true);
+    UT_CHECKEVENT_SETUP(&EventTest, SAMPLE_APP_LIMIT_ERR_EID,
+                        "Sample App: Limit point %u, MID 0x%lX offset %u, now %s, value = %ld");
+    UT_CHECKEVENT_SETUP(&LenEventTest, SAMPLE_APP_LIMIT_LEN_ERR_EID,
+                        "Sample App: Limit checked packet too short, MID = 0x%lX, Len = %lu");
+
+    /* an int16 point in column 1, and a uint8 point that sorts before it in column 0 */
+    TestTblData.Entry[0].MsgId      = SAMPLE_APP_HK_TLM_MID;
+    TestTblData.Entry[0].Offset     = 16;
+    TestTblData.Entry[0].Type       = SAMPLE_APP_LIMIT_TYPE_INT16;
+    TestTblData.Entry[0].RedLow     = -100;
+    TestTblData.Entry[0].YellowLow  = -50;
+    TestTblData.Entry[0].YellowHigh = 50;
+    TestTblData.Entry[0].RedHigh    = 100;
+    TestTblData.Entry[1].MsgId      = SAMPLE_APP_HK_TLM_MID;
+    TestTblData.Entry[1].Offset     = 20;
+    TestTblData.Entry[1].Type       = SAMPLE_APP_LIMIT_TYPE_UINT8;
+    TestTblData.Entry[1].YellowHigh = 5;
+    TestTblData.Entry[1].RedHigh    = 20;
+    UT_LimitLoad(&TestTblData);
+
+    /* other messages are left for dispatch */
+    MsgCtx.MsgId   = CFE_SB_ValueToMsgId(SAMPLE_APP_CMD_MID);
+    MsgCtx.MsgSize = sizeof(TestMsg);
+    UtAssert_BOOL_FALSE(SAMPLE_APP_LimitCheckPacket(&TestMsg.SBBuf, &MsgCtx));
+
+    /* points staying within limits send nothing */
+    MsgCtx.MsgId = CFE_SB_ValueToMsgId(SAMPLE_APP_HK_TLM_MID);
+    UtAssert_BOOL_TRUE(SAMPLE_APP_LimitCheckPacket(&TestMsg.SBBuf, &MsgCtx));
+    UtAssert_ZERO(EventTest.MatchCount);
+
+    /* a transition is reported once, as long as the point stays there */
+    S16 = 60;
+    memcpy(&TestMsg.Byte[16], &S16, sizeof(S16));
+    UtAssert_BOOL_TRUE(SAMPLE_APP_LimitCheckPacket(&TestMsg.SBBuf, &MsgCtx));
+    UtAssert_BOOL_TRUE(SAMPLE_APP_LimitCheckPacket(&TestMsg.SBBuf, &MsgCtx));
+    UtAssert_UINT32_EQ(EventTest.MatchCount, 1);
+    UtAssert_UINT32_EQ(Set->State[1], SAMPLE_APP_LIMIT_YELLOW_HIGH);
+
+    /* each point changing state is reported */
+    S16              = -200;
+    TestMsg.Byte[20] = 21;
+    memcpy(&TestMsg.Byte[16], &S16, sizeof(S16));
+    UtAssert_BOOL_TRUE(SAMPLE_APP_LimitCheckPacket(&TestMsg.SBBuf, &MsgCtx));
+    UtAssert_UINT32_EQ(EventTest.MatchCount, 3);
+    UtAssert_UINT32_EQ(Set->State[0], SAMPLE_APP_LIMIT_RED_HIGH | SAMPLE_APP_LIMIT_YELLOW_HIGH);
+    UtAssert_UINT32_EQ(Set->State[1], SAMPLE_APP_LIMIT_RED_LOW | SAMPLE_APP_LIMIT_YELLOW_LOW);
+
+    /* a transition within the coalescing window is recorded but not sent */
+    UT_SetDeferredRetcode(UT_KEY(SAMPLE_APP_CoalesceEvent), 1, false);
+    S16 = 0;
+    memcpy(&TestMsg.Byte[16], &S16, sizeof(S16));
+    UtAssert_BOOL_TRUE(SAMPLE_APP_LimitCheckPacket(&TestMsg.SBBuf, &MsgCtx));
+    UtAssert_UINT32_EQ(EventTest.MatchCount, 3);
+    UtAssert_ZERO(Set->State[1]);
+    UtAssert_UINT32_EQ(Set->Reported[1], SAMPLE_APP_LIMIT_RED_LOW | SAMPLE_APP_LIMIT_YELLOW_LOW);
+
+    /* a packet too short for the uint8 point still has its int16 point checked */
+    TestMsg.Byte[20] = 0;
+    S16              = -60;
+    memcpy(&TestMsg.Byte[16], &S16, sizeof(S16));
+    MsgCtx.MsgSize = 18;
+    UtAssert_BOOL_TRUE(SAMPLE_APP_LimitCheckPacket(&TestMsg.SBBuf, &MsgCtx));
+    UtAssert_UINT32_EQ(LenEventTest.MatchCount, 1);
+    UtAssert_UINT32_EQ(EventTest.MatchCount, 4);
+    UtAssert_UINT32_EQ(Set->State[0], SAMPLE_APP_LIMIT_RED_HIGH | SAMPLE_APP_LIMIT_YELLOW_HIGH);
+    UtAssert_UINT32_EQ(Set->State[1], SAMPLE_APP_LIMIT_YELLOW_LOW);
+
+    /* every transition sent or not, and the short packet, went through coalescing */
+    UtAssert_STUB_COUNT(SAMPLE_APP_CoalesceEvent, 6);
+}
+
+void Test_SAMPLE_APP_LimitFlush(void)
+{
+    /*
+     * Test Case For:
+     * void SAMPLE_APP_LimitFlush( void )
+     */
+    SAMPLE_APP_LimitTable_t TestTblData;
+    SAMPLE_APP_MsgContext_t MsgCtx;
+    SAMPLE_APP_LimitSet_t * Set = &SAMPLE_APP_Data.Limit;
+    UT_CheckEvent_t         EventTest;
+    int16                   S16;
+    union
+    {
+        CFE_SB_Buffer_t SBBuf;
+        uint8           Byte[64];
+    } TestMsg;
+
+    memset(&TestTblData, 0, sizeof(TestTblData));
+    memset(&SAMPLE_APP_Data, 0, sizeof(SAMPLE_APP_Data));
+    memset(&MsgCtx, 0, sizeof(MsgCtx));
+    memset(&TestMsg, 0, sizeof(TestMsg));
+    UT_CHECKEVENT_SETUP(&EventTest, SAMPLE_APP_LIMIT_ERR_EID,
+                        "Sample App: Limit point %u, MID 0x%lX offset %u, now %s, value = %ld");
+
+    TestTblData.Entry[0].MsgId      = SAMPLE_APP_HK_TLM_MID;
+    TestTblData.Entry[0].Offset     = 16;
+    TestTblData.Entry[0].Type       = SAMPLE_APP_LIMIT_TYPE_INT16;
+    TestTblData.Entry[0].RedLow     = -100;
+    TestTblData.Entry[0].YellowLow  = -50;
+    TestTblData.Entry[0].YellowHigh = 50;
+    TestTblData.Entry[0].RedHigh    = 100;
+    UT_LimitLoad(&TestTblData);
+
+    MsgCtx.MsgId   = CFE_SB_ValueToMsgId(SAMPLE_APP_HK_TLM_MID);
+    MsgCtx.MsgSize = sizeof(TestMsg);
+
+    /* points the ground is up to date on send nothing */
+    SAMPLE_APP_LimitFlush();
+    UtAssert_ZERO(EventTest.MatchCount);
+    UtAssert_STUB_COUNT(SAMPLE_APP_CoalesceOpen, 0);
+
+    /* red is sent, then the return to nominal within the same window is coalesced */
+    UT_SetDeferredRetcode(UT_KEY(SAMPLE_APP_CoalesceEvent), 1, true);
+    S16 = 200;
+    memcpy(&TestMsg.Byte[16], &S16, sizeof(S16));
+    SAMPLE_APP_LimitCheckPacket(&TestMsg.SBBuf, &MsgCtx);
+    S16 = 10;
+    memcpy(&TestMsg.Byte[16], &S16, sizeof(S16));
+    SAMPLE_APP_LimitCheckPacket(&TestMsg.SBBuf, &MsgCtx);
+    UtAssert_UINT32_EQ(EventTest.MatchCount, 1);
+    UtAssert_UINT32_EQ(Set->Reported[0], SAMPLE_APP_LIMIT_RED_HIGH | SAMPLE_APP_LIMIT_YELLOW_HIGH);
+
+    /* nothing more while the window is open */
+    UT_SetDeferredRetcode(UT_KEY(SAMPLE_APP_CoalesceOpen), 1, true);
+    SAMPLE_APP_LimitFlush();
+    UtAssert_UINT32_EQ(EventTest.MatchCount, 1);
+
+    /* once it closes, the point is reported within limits with the value that put it there */
+    UT_SetDeferredRetcode(UT_KEY(SAMPLE_APP_CoalesceEvent), 1, true);
+    SAMPLE_APP_LimitFlush();
+    UtAssert_UINT32_EQ(EventTest.MatchCount, 2);
+    UtAssert_ZERO(Set->Reported[0]);
+    UtAssert_INT32_EQ(Set->Value[0], 10);
+
+    /* and only once */
+    SAMPLE_APP_LimitFlush();
+    UtAssert_UINT32_EQ(EventTest.MatchCount, 2);
+}
+
+/*
+ * Register the test cases to execute with the unit test tool
+ */
+void UtTest_Setup(void)
+{
+    ADD_TEST(SAMPLE_APP_LimitValidationFunc);
+    ADD_TEST(SAMPLE_APP_UpdateLimits);
+    ADD_TEST(SAMPLE_APP_LimitEvalScalar);
+    ADD_TEST(SAMPLE_APP_LimitEval);
+    ADD_TEST(SAMPLE_APP_LimitCheckPacket);
+    ADD_TEST(SAMPLE_APP_LimitFlush);
+}
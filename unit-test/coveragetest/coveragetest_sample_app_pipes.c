@@ -0,0 +1,224 @@
+/************************************************************************
+ * NASA Docket No. GSC-18,719-1, and identified as “core Flight System: Bootes”
+ *
+ * Copyright (c) 2020 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/*
+** File: coveragetest_sample_app.c
+**
+** Purpose:
+** Coverage Unit Test cases for the Sample Application
+**
+** Notes:
+** This implements various test cases to exercise all code
+** paths through all functions defined in the Sample application.
+**
+** It is primarily focused at providing examples of the various
+** stub configurations, hook functions, and wrapper calls that
+** are often needed when coercing certain code paths through
+** complex functions.
+*/
+
+
+/*
+ * Includes
+ */
+#include "sample_app_coveragetest_common.h"
+
+/*
+**********************************************************************************
+**          TEST CASE FUNCTIONS
+**********************************************************************************
+*/
+
+void Test_SAMPLE_APP_PipesInit(void)
+{
+    /*
+     * Test Case For:
+     * CFE_Status_t SAMPLE_APP_PipesInit( void )
+     */
+    UT_CheckEvent_t EventTest;
+
+    /*
+     * nominal case creates every pipe, the default table has one message ID
+     * per pipe plus the sensor data on the command pipe
+     */
+    UtAssert_INT32_EQ(SAMPLE_APP_PipesInit(), CFE_SUCCESS);
+    UtAssert_STUB_COUNT(CFE_SB_CreatePipe, SAMPLE_APP_NUM_PIPES);
+    UtAssert_STUB_COUNT(CFE_SB_SubscribeEx, SAMPLE_APP_NUM_PIPES + 1);
+    UtAssert_BOOL_TRUE(SAMPLE_APP_Data.PipeServiceStrict == SAMPLE_APP_PIPE_SERVICE_STRICT);
+
+    /* a pipe creation failure stops before subscribing */
+    UT_CHECKEVENT_SETUP(&EventTest, SAMPLE_APP_CR_PIPE_ERR_EID, NULL);
+    UT_SetDeferredRetcode(UT_KEY(CFE_SB_CreatePipe), 1, CFE_SB_BAD_ARGUMENT);
+    UtAssert_INT32_EQ(SAMPLE_APP_PipesInit(), CFE_SB_BAD_ARGUMENT);
+    UtAssert_STUB_COUNT(CFE_SB_SubscribeEx, SAMPLE_APP_NUM_PIPES + 1);
+    UtAssert_UINT32_EQ(EventTest.MatchCount, 1);
+
+    /* as does a subscription failure, with the housekeeping request's own event */
+    UT_CHECKEVENT_SETUP(&EventTest, SAMPLE_APP_SUB_HK_ERR_EID, NULL);
+    UT_SetDeferredRetcode(UT_KEY(CFE_SB_SubscribeEx), 1, CFE_SB_BAD_ARGUMENT);
+    UtAssert_INT32_EQ(SAMPLE_APP_PipesInit(), CFE_SB_BAD_ARGUMENT);
+    UtAssert_STUB_COUNT(CFE_SB_CreatePipe, SAMPLE_APP_NUM_PIPES + 2);
+    UtAssert_UINT32_EQ(EventTest.MatchCount, 1);
+
+    /* and the command's on the command pipe */
+    UT_CHECKEVENT_SETUP(&EventTest, SAMPLE_APP_SUB_CMD_ERR_EID, NULL);
+    UT_SetDeferredRetcode(UT_KEY(CFE_SB_SubscribeEx), 2, CFE_SB_BAD_ARGUMENT);
+    UtAssert_INT32_EQ(SAMPLE_APP_PipesInit(), CFE_SB_BAD_ARGUMENT);
+    UtAssert_STUB_COUNT(CFE_SB_CreatePipe, SAMPLE_APP_NUM_PIPES + 4);
+    UtAssert_UINT32_EQ(EventTest.MatchCount, 1);
+}
+
+void Test_SAMPLE_APP_ServicePipes(void)
+{
+    /*
+     * Test Case For:
+     * CFE_Status_t SAMPLE_APP_ServicePipes( CFE_SB_Buffer_t *SBBufPtr )
+     */
+    CFE_SB_Buffer_t TestBuf;
+
+    memset(&TestBuf, 0, sizeof(TestBuf));
+    memset(&SAMPLE_APP_Data, 0, sizeof(SAMPLE_APP_Data));
+
+    /* Timeout wakeup with every pipe empty polls each pipe once */
+    UT_SetDefaultReturnValue(UT_KEY(CFE_SB_ReceiveBuffer), CFE_SB_NO_MESSAGE);
+    UtAssert_INT32_EQ(SAMPLE_APP_ServicePipes(NULL), CFE_SUCCESS);
+    UtAssert_STUB_COUNT(CFE_SB_ReceiveBuffer, SAMPLE_APP_NUM_PIPES);
+    UtAssert_STUB_COUNT(SAMPLE_APP_TaskPipe, 0);
+    UtAssert_ZERO(SAMPLE_APP_Data.LastWakeupMsgCount);
+    UtAssert_STUB_COUNT(SAMPLE_APP_AdmitBacklogCleared, 1);
+
+    /* The wakeup buffer is processed in the turn of the pipe it came from */
+    UtAssert_INT32_EQ(SAMPLE_APP_ServicePipes(&TestBuf), CFE_SUCCESS);
+    UtAssert_STUB_COUNT(SAMPLE_APP_DecodeMsgHeader, 1);
+    UtAssert_STUB_COUNT(SAMPLE_APP_TaskPipe, 1);
+    UtAssert_STUB_COUNT(SAMPLE_APP_RecordDispatchLatency, 1);
+    UtAssert_UINT32_EQ(SAMPLE_APP_Data.LastWakeupMsgCount, 1);
+    UtAssert_UINT32_EQ(SAMPLE_APP_Data.PeakWakeupMsgCount, 1);
+    UtAssert_UINT32_EQ(SAMPLE_APP_Data.DrainLimitHitCount, 0);
+    UtAssert_ZERO(SAMPLE_APP_Data.Pipe[1].HighWatermark);
+    UtAssert_UINT32_EQ(SAMPLE_APP_Data.Pipe[SAMPLE_APP_PIPE_WAKE].HighWatermark, 1);
+    UtAssert_ZERO(SAMPLE_APP_Data.Pipe[SAMPLE_APP_PIPE_WAKE].Queued);
+
+    /*
+     * Every pipe always has more, so weighted rounds share the drain limit.
+     * With the default weights of 1 and 4 two rounds take 2 messages from
+     * the first pipe and 6 from the second, counting the wakeup buffer.
+     */
+    SAMPLE_APP_Data.Backlog = 0;
+    UT_SetDefaultReturnValue(UT_KEY(CFE_SB_ReceiveBuffer), CFE_SUCCESS);
+    UtAssert_INT32_EQ(SAMPLE_APP_ServicePipes(&TestBuf), CFE_SUCCESS);
+    UtAssert_STUB_COUNT(SAMPLE_APP_TaskPipe, 1 + SAMPLE_APP_PIPE_DRAIN_LIMIT);
+    UtAssert_UINT32_EQ(SAMPLE_APP_Data.LastWakeupMsgCount, SAMPLE_APP_PIPE_DRAIN_LIMIT);
+    UtAssert_UINT32_EQ(SAMPLE_APP_Data.PeakWakeupMsgCount, SAMPLE_APP_PIPE_DRAIN_LIMIT);
+    UtAssert_UINT32_EQ(SAMPLE_APP_Data.DrainLimitHitCount, 1);
+    UtAssert_UINT32_EQ(SAMPLE_APP_Data.Pipe[0].HighWatermark, 2);
+    UtAssert_UINT32_EQ(SAMPLE_APP_Data.Pipe[1].HighWatermark, 6);
+
+    /* Pipes not found empty, so the backlog is carried to the next wakeup */
+    UtAssert_STUB_COUNT(SAMPLE_APP_AdmitBacklogCleared, 2);
+    UtAssert_UINT32_EQ(SAMPLE_APP_Data.Backlog, SAMPLE_APP_PIPE_DRAIN_LIMIT);
+
+    /*
+     * As is the depth bound, which is not limited by the drain limit but
+     * is by each pipe's own depth, however few it really held
+     */
+    UtAssert_INT32_EQ(SAMPLE_APP_ServicePipes(NULL), CFE_SUCCESS);
+    UtAssert_UINT32_EQ(SAMPLE_APP_Data.Pipe[0].HighWatermark, SAMPLE_APP_HK_PIPE_DEPTH);
+    UtAssert_UINT32_EQ(SAMPLE_APP_Data.Pipe[1].HighWatermark, 12);
+
+    /* Read error while polling is passed back, the wakeup buffer is still processed and peaks are retained */
+    UT_SetDefaultReturnValue(UT_KEY(CFE_SB_ReceiveBuffer), CFE_SB_PIPE_RD_ERR);
+    UtAssert_INT32_EQ(SAMPLE_APP_ServicePipes(&TestBuf), CFE_SB_PIPE_RD_ERR);
+    UtAssert_UINT32_EQ(SAMPLE_APP_Data.LastWakeupMsgCount, 1);
+    UtAssert_UINT32_EQ(SAMPLE_APP_Data.PeakWakeupMsgCount, SAMPLE_APP_PIPE_DRAIN_LIMIT);
+    UtAssert_UINT32_EQ(SAMPLE_APP_Data.Pipe[0].HighWatermark, SAMPLE_APP_HK_PIPE_DEPTH);
+    UtAssert_UINT32_EQ(SAMPLE_APP_Data.Pipe[1].HighWatermark, 12);
+    UtAssert_STUB_COUNT(SAMPLE_APP_AdmitBacklogCleared, 2);
+}
+
+void Test_SAMPLE_APP_ServicePipes_Strict(void)
+{
+    /*
+     * Test Case For:
+     * CFE_Status_t SAMPLE_APP_ServicePipes( CFE_SB_Buffer_t *SBBufPtr )
+     * in strict priority mode
+     */
+    CFE_SB_Buffer_t TestBuf;
+
+    memset(&TestBuf, 0, sizeof(TestBuf));
+    memset(&SAMPLE_APP_Data, 0, sizeof(SAMPLE_APP_Data));
+    SAMPLE_APP_Data.PipeServiceStrict = true;
+
+    /*
+     * The first pipe is empty and the second has a message, after which
+     * service goes back to the first pipe, which now has one too.
+     */
+    UT_SetDefaultReturnValue(UT_KEY(CFE_SB_ReceiveBuffer), CFE_SB_NO_MESSAGE);
+    UT_SetDeferredRetcode(UT_KEY(CFE_SB_ReceiveBuffer), 1, CFE_SB_NO_MESSAGE);
+    UT_SetDeferredRetcode(UT_KEY(CFE_SB_ReceiveBuffer), 1, CFE_SUCCESS);
+    UT_SetDeferredRetcode(UT_KEY(CFE_SB_ReceiveBuffer), 1, CFE_SUCCESS);
+    UtAssert_INT32_EQ(SAMPLE_APP_ServicePipes(NULL), CFE_SUCCESS);
+    UtAssert_STUB_COUNT(CFE_SB_ReceiveBuffer, 5);
+    UtAssert_STUB_COUNT(SAMPLE_APP_TaskPipe, 2);
+    UtAssert_UINT32_EQ(SAMPLE_APP_Data.Pipe[0].HighWatermark, 1);
+    UtAssert_UINT32_EQ(SAMPLE_APP_Data.Pipe[1].HighWatermark, 1);
+
+    /*
+     * A busy first pipe takes the whole drain limit, starting with the
+     * wakeup buffer that came from it
+     */
+    UT_SetDefaultReturnValue(UT_KEY(CFE_SB_ReceiveBuffer), CFE_SUCCESS);
+    UtAssert_INT32_EQ(SAMPLE_APP_ServicePipes(&TestBuf), CFE_SUCCESS);
+    UtAssert_STUB_COUNT(SAMPLE_APP_TaskPipe, 2 + SAMPLE_APP_PIPE_DRAIN_LIMIT);
+    UtAssert_STUB_COUNT(CFE_SB_ReceiveBuffer, 5 + SAMPLE_APP_PIPE_DRAIN_LIMIT - 1);
+    UtAssert_UINT32_EQ(SAMPLE_APP_Data.LastWakeupMsgCount, SAMPLE_APP_PIPE_DRAIN_LIMIT);
+    UtAssert_UINT32_EQ(SAMPLE_APP_Data.Pipe[0].HighWatermark, SAMPLE_APP_HK_PIPE_DEPTH);
+    UtAssert_UINT32_EQ(SAMPLE_APP_Data.Pipe[1].HighWatermark, 1);
+}
+
+void Test_SAMPLE_APP_UpdatePipeStats(void)
+{
+    /*
+     * Test Case For:
+     * void SAMPLE_APP_UpdatePipeStats( SAMPLE_APP_HkTlm_Payload_t *Payload )
+     */
+    uint32 i;
+
+    for (i = 0; i < SAMPLE_APP_NUM_PIPES; ++i)
+    {
+        SAMPLE_APP_Data.Pipe[i].HighWatermark = 10 + i;
+    }
+
+    SAMPLE_APP_UpdatePipeStats(&SAMPLE_APP_Data.HkTlm.Payload);
+
+    for (i = 0; i < SAMPLE_APP_NUM_PIPES; ++i)
+    {
+        UtAssert_UINT32_EQ(SAMPLE_APP_Data.HkTlm.Payload.PipeHighWatermark[i], 10 + i);
+    }
+}
+
+/*
+ * Register the test cases to execute with the unit test tool
+ */
+void UtTest_Setup(void)
+{
+    ADD_TEST(SAMPLE_APP_PipesInit);
+    ADD_TEST(SAMPLE_APP_ServicePipes);
+    ADD_TEST(SAMPLE_APP_ServicePipes_Strict);
+    ADD_TEST(SAMPLE_APP_UpdatePipeStats);
+}
@@ -0,0 +1,198 @@
+/************************************************************************
+ * NASA Docket No. GSC-18,719-1, and identified as “core Flight System: Bootes”
+ *
+ * Copyright (c) 2020 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/*
+** File: coveragetest_sample_app.c
+**
+** Purpose:
+** Coverage Unit Test cases for the Sample Application
+**
+** Notes:
+** This implements various test cases to exercise all code
+** paths through all functions defined in the Sample application.
+**
+** It is primarily focused at providing examples of the various
+** stub configurations, hook functions, and wrapper calls that
+** are often needed when coercing certain code paths through
+** complex functions.
+*/
+
+
+/*
+ * Includes
+ */
+#include "sample_app_coveragetest_common.h"
+
+#include <stdlib.h>
+
+/*
+ * Samples in each stream compared against an exact sort
+ */
+#define UT_QUANTILE_SAMPLES 20000
+
+/*
+ * Largest allowed difference between the quantile asked for and the
+ * fraction of the samples below the estimate
+ */
+#define UT_QUANTILE_RANK_TOLERANCE 0.005
+
+static int UT_QuantileCompare(const void *a, const void *b)
+{
+    return *(const int16 *)a - *(const int16 *)b;
+}
+
+/*
+ * Feed a stream to channel 1 and check every estimate against the exact
+ * quantiles of the sorted stream
+ */
+static void UT_QuantileCheckStream(const char *Name, int16 *Sample)
+{
+    SAMPLE_APP_QuantileEstimate_t *Estimate = SAMPLE_APP_Data.QuantileTlm.Payload.Quantile[1];
+    double                         Rank;
+    uint32                         Below;
+    uint32                         i;
+    uint16                         q;
+
+    SAMPLE_APP_QuantileReset();
+
+    for (i = 0; i < UT_QUANTILE_SAMPLES; i += SAMPLE_APP_SENSOR_BLOCK_SAMPLES)
+    {
+        SAMPLE_APP_QuantileAdd(1, &Sample[i], UT_QUANTILE_SAMPLES - i < SAMPLE_APP_SENSOR_BLOCK_SAMPLES
+                                                  ? UT_QUANTILE_SAMPLES - i
+                                                  : SAMPLE_APP_SENSOR_BLOCK_SAMPLES);
+    }
+
+    SAMPLE_APP_SendQuantileTlm(NULL);
+    UtAssert_UINT32_EQ(SAMPLE_APP_Data.QuantileTlm.Payload.Count[1], UT_QUANTILE_SAMPLES);
+
+    qsort(Sample, UT_QUANTILE_SAMPLES, sizeof(Sample[0]), UT_QuantileCompare);
+
+    for (q = 0; q < SAMPLE_APP_SENSOR_QUANTILES; ++q)
+    {
+        Below = 0;
+        while (Below < UT_QUANTILE_SAMPLES && Sample[Below] < Estimate[q].Value)
+        {
+            ++Below;
+        }
+
+        Rank = (double)Below / UT_QUANTILE_SAMPLES - Estimate[q].Permille / 1000.0;
+        UtAssert_True(Rank <= UT_QUANTILE_RANK_TOLERANCE && Rank >= -UT_QUANTILE_RANK_TOLERANCE,
+                      "%s p%u estimate %.1f is %.4f off in rank", Name, (unsigned int)Estimate[q].Permille,
+                      (double)Estimate[q].Value, Rank);
+    }
+}
+
+/*
+**********************************************************************************
+**          TEST CASE FUNCTIONS
+**********************************************************************************
+*/
+
+void Test_SAMPLE_APP_QuantileAdd(void)
+{
+    /*
+     * Test Case For:
+     * void SAMPLE_APP_QuantileAdd( uint16 Channel, const int16 *Sample, uint32 NumSamples )
+     */
+    static int16 Sample[UT_QUANTILE_SAMPLES];
+    uint32       Seed = 1;
+    uint32       i;
+
+    memset(&SAMPLE_APP_Data, 0, sizeof(SAMPLE_APP_Data));
+    UT_SetHandlerFunction(UT_KEY(SAMPLE_APP_TlmBegin), UT_Handler_SAMPLE_APP_TlmBegin, NULL);
+
+    /* random samples with a peaked distribution */
+    for (i = 0; i < UT_QUANTILE_SAMPLES; ++i)
+    {
+        Sample[i] = (int16)((int32)(UT_Random(&Seed) & 0x3FFF) + (UT_Random(&Seed) & 0x3FFF) - 0x4000);
+    }
+    UT_QuantileCheckStream("Random", Sample);
+
+    /* and a steady ramp, which moves the markers the most */
+    for (i = 0; i < UT_QUANTILE_SAMPLES; ++i)
+    {
+        Sample[i] = (int16)(UT_QUANTILE_SAMPLES / 2 - (int32)i);
+    }
+    UT_QuantileCheckStream("Ramp", Sample);
+
+    /* other channels are untouched */
+    UtAssert_ZERO(SAMPLE_APP_Data.SensorQuantiles[0].Count);
+
+    /* the estimates hold rather than let the count wrap */
+    SAMPLE_APP_Data.SensorQuantiles[2].Count = UINT32_MAX - 1;
+    SAMPLE_APP_QuantileAdd(2, Sample, 3);
+    UtAssert_UINT32_EQ(SAMPLE_APP_Data.SensorQuantiles[2].Count, UINT32_MAX);
+}
+
+void Test_SAMPLE_APP_QuantileReset(void)
+{
+    /*
+     * Test Case For:
+     * void SAMPLE_APP_QuantileReset( void )
+     */
+    int16 Sample[2] = {1, 2};
+
+    memset(&SAMPLE_APP_Data, 0, sizeof(SAMPLE_APP_Data));
+
+    SAMPLE_APP_QuantileAdd(0, Sample, 2);
+    SAMPLE_APP_QuantileAdd(3, Sample, 2);
+    SAMPLE_APP_QuantileReset();
+    UtAssert_ZERO(SAMPLE_APP_Data.SensorQuantiles[0].Count);
+    UtAssert_ZERO(SAMPLE_APP_Data.SensorQuantiles[3].Count);
+}
+
+void Test_SAMPLE_APP_SendQuantileTlm(void)
+{
+    /*
+     * Test Case For:
+     * CFE_Status_t SAMPLE_APP_SendQuantileTlm( const SAMPLE_APP_SendHkCmd_t *Msg )
+     */
+    SAMPLE_APP_QuantileEstimate_t *Estimate  = SAMPLE_APP_Data.QuantileTlm.Payload.Quantile[3];
+    int16                          Sample[3] = {30, 10, 20};
+    uint16                         q;
+
+    memset(&SAMPLE_APP_Data, 0, sizeof(SAMPLE_APP_Data));
+    UT_SetHandlerFunction(UT_KEY(SAMPLE_APP_TlmBegin), UT_Handler_SAMPLE_APP_TlmBegin, NULL);
+
+    /* with no samples every estimate is zero */
+    UtAssert_INT32_EQ(SAMPLE_APP_SendQuantileTlm(NULL), CFE_SUCCESS);
+    UtAssert_STUB_COUNT(SAMPLE_APP_TlmSend, 1);
+    UtAssert_ZERO(SAMPLE_APP_Data.QuantileTlm.Payload.Count[3]);
+    UtAssert_True(Estimate[0].Value == 0.0f, "Empty estimate %f == 0", (double)Estimate[0].Value);
+
+    /* with too few samples for the markers each estimate is the nearest ranked sample */
+    SAMPLE_APP_QuantileAdd(3, Sample, 3);
+    UtAssert_INT32_EQ(SAMPLE_APP_SendQuantileTlm(NULL), CFE_SUCCESS);
+    UtAssert_STUB_COUNT(SAMPLE_APP_TlmSend, 2);
+    UtAssert_UINT32_EQ(SAMPLE_APP_Data.QuantileTlm.Payload.Count[3], 3);
+    for (q = 0; q < SAMPLE_APP_SENSOR_QUANTILES; ++q)
+    {
+        UtAssert_True(Estimate[q].Value == 10.0f * (1 + (Estimate[q].Permille * 2 + 500) / 1000),
+                      "p%u estimate %f", (unsigned int)Estimate[q].Permille, (double)Estimate[q].Value);
+    }
+}
+
+/*
+ * Register the test cases to execute with the unit test tool
+ */
+void UtTest_Setup(void)
+{
+    ADD_TEST(SAMPLE_APP_QuantileAdd);
+    ADD_TEST(SAMPLE_APP_QuantileReset);
+    ADD_TEST(SAMPLE_APP_SendQuantileTlm);
+}
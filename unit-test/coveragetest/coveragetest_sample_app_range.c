@@ -0,0 +1,132 @@
+/************************************************************************
+ * NASA Docket No. GSC-18,719-1, and identified as “core Flight System: Bootes”
+ *
+ * Copyright (c) 2020 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/*
+** File: coveragetest_sample_app.c
+**
+** Purpose:
+** Coverage Unit Test cases for the Sample Application
+**
+** Notes:
+** This implements various test cases to exercise all code
+** paths through all functions defined in the Sample application.
+**
+** It is primarily focused at providing examples of the various
+** stub configurations, hook functions, and wrapper calls that
+** are often needed when coercing certain code paths through
+** complex functions.
+*/
+
+
+/*
+ * Includes
+ */
+#include "sample_app_coveragetest_common.h"
+
+/*
+ * Number of randomized images compared between the two kernels
+ */
+#define UT_RANGE_RANDOM_IMAGES 200
+
+/*
+**********************************************************************************
+**          TEST CASE FUNCTIONS
+**********************************************************************************
+*/
+
+void Test_SAMPLE_APP_RangeCheckS16Scalar(void)
+{
+    /*
+     * Test Case For:
+     * uint32 SAMPLE_APP_RangeCheckS16Scalar( const int16 *Values, uint32 Count, int16 Min, int16 Max )
+     */
+    int16 Values[4] = {-10, -5, 5, 10};
+
+    UtAssert_UINT32_EQ(SAMPLE_APP_RangeCheckS16Scalar(Values, 0, 0, 0), 0);
+    UtAssert_UINT32_EQ(SAMPLE_APP_RangeCheckS16Scalar(Values, 4, -10, 10), 4);
+    UtAssert_UINT32_EQ(SAMPLE_APP_RangeCheckS16Scalar(Values, 4, -9, 10), 0);
+    UtAssert_UINT32_EQ(SAMPLE_APP_RangeCheckS16Scalar(Values, 4, -10, 4), 2);
+}
+
+void Test_SAMPLE_APP_RangeCheckS16(void)
+{
+    /*
+     * Test Case For:
+     * uint32 SAMPLE_APP_RangeCheckS16( const int16 *Values, uint32 Count, int16 Min, int16 Max )
+     */
+    int16  Values[100];
+    uint32 Seed = 1;
+    uint32 Count;
+    uint32 Mismatches = 0;
+    int32  Min;
+    int32  Max;
+    uint32 i;
+    uint32 n;
+
+    /* all in range, including values at both limits and on both sides of zero */
+    for (i = 0; i < 100; ++i)
+    {
+        Values[i] = -16 + (int16)(i % 32);
+    }
+    UtAssert_UINT32_EQ(SAMPLE_APP_RangeCheckS16(Values, 100, -16, 15), 100);
+
+    /* failures in a full block, a half block and the tail are each found exactly */
+    UtAssert_UINT32_EQ(SAMPLE_APP_RangeCheckS16(Values, 100, -16, 14), 31);
+    Values[20] = -32768;
+    UtAssert_UINT32_EQ(SAMPLE_APP_RangeCheckS16(Values, 100, -16, 15), 20);
+    Values[20] = 4;
+    Values[98] = 32767;
+    UtAssert_UINT32_EQ(SAMPLE_APP_RangeCheckS16(Values, 100, -16, 15), 98);
+
+    /*
+     * Randomized images of varying length and limits, where most values
+     * are in range, must give the same answer as the scalar reference
+     */
+    for (n = 0; n < UT_RANGE_RANDOM_IMAGES; ++n)
+    {
+        Count = UT_Random(&Seed) % 101;
+        Min   = (int32)(UT_Random(&Seed) % 0x10000) - 0x8000;
+        Max   = Min + (int32)(UT_Random(&Seed) % (uint32)(0x8000 - Min));
+
+        for (i = 0; i < Count; ++i)
+        {
+            Values[i] = (int16)(Min + (int32)(UT_Random(&Seed) % (uint32)(Max - Min + 1)));
+            if ((UT_Random(&Seed) % 64) == 0)
+            {
+                Values[i] = (int16)((int32)(UT_Random(&Seed) % 0x10000) - 0x8000);
+            }
+        }
+
+        if (SAMPLE_APP_RangeCheckS16(Values, Count, Min, Max) !=
+            SAMPLE_APP_RangeCheckS16Scalar(Values, Count, Min, Max))
+        {
+            ++Mismatches;
+        }
+    }
+
+    UtAssert_ZERO(Mismatches);
+}
+
+/*
+ * Register the test cases to execute with the unit test tool
+ */
+void UtTest_Setup(void)
+{
+    ADD_TEST(SAMPLE_APP_RangeCheckS16Scalar);
+    ADD_TEST(SAMPLE_APP_RangeCheckS16);
+}
@@ -0,0 +1,227 @@
+/************************************************************************
+ * NASA Docket No. GSC-18,719-1, and identified as “core Flight System: Bootes”
+ *
+ * Copyright (c) 2020 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/*
+** File: coveragetest_sample_app.c
+**
+** Purpose:
+** Coverage Unit Test cases for the Sample Application
+**
+** Notes:
+** This implements various test cases to exercise all code
+** paths through all functions defined in the Sample application.
+**
+** It is primarily focused at providing examples of the various
+** stub configurations, hook functions, and wrapper calls that
+** are often needed when coercing certain code paths through
+** complex functions.
+*/
+
+
+/*
+ * Includes
+ */
+#include "sample_app_coveragetest_common.h"
+
+/*
+**********************************************************************************
+**          TEST CASE FUNCTIONS
+**********************************************************************************
+*/
+
+void Test_SAMPLE_APP_RateLimitValidationFunc(void)
+{
+    /*
+     * Test Case For:
+     * CFE_Status_t SAMPLE_APP_RateLimitValidationFunc( void *TblData )
+     */
+    SAMPLE_APP_RateLimitTable_t TestTblData;
+
+    memset(&TestTblData, 0, sizeof(TestTblData));
+
+    /* an empty table limits nothing and is valid */
+    UtAssert_INT32_EQ(SAMPLE_APP_RateLimitValidationFunc(&TestTblData), CFE_SUCCESS);
+
+    TestTblData.Entry[0].MsgId       = SAMPLE_APP_CMD_MID;
+    TestTblData.Entry[0].CommandCode = SAMPLE_APP_PROCESS_CC;
+    TestTblData.Entry[0].BurstSize   = 2;
+    TestTblData.Entry[0].RatePerSec  = 1;
+    TestTblData.Entry[1]             = TestTblData.Entry[0];
+    TestTblData.Entry[1].MsgId       = SAMPLE_APP_SEND_HK_MID;
+    UtAssert_INT32_EQ(SAMPLE_APP_RateLimitValidationFunc(&TestTblData), CFE_SUCCESS);
+
+    /* the same MID/CC twice */
+    TestTblData.Entry[1].MsgId = SAMPLE_APP_CMD_MID;
+    UtAssert_INT32_EQ(SAMPLE_APP_RateLimitValidationFunc(&TestTblData), SAMPLE_APP_TABLE_OUT_OF_RANGE_ERR_CODE);
+
+    /* a MID the app does not receive */
+    TestTblData.Entry[1].MsgId = SAMPLE_APP_HK_TLM_MID;
+    UtAssert_INT32_EQ(SAMPLE_APP_RateLimitValidationFunc(&TestTblData), SAMPLE_APP_TABLE_OUT_OF_RANGE_ERR_CODE);
+
+    /* a command code beyond those tracked */
+    TestTblData.Entry[1].MsgId       = SAMPLE_APP_SEND_HK_MID;
+    TestTblData.Entry[1].CommandCode = SAMPLE_APP_ADMIT_MAX_CC;
+    UtAssert_INT32_EQ(SAMPLE_APP_RateLimitValidationFunc(&TestTblData), SAMPLE_APP_TABLE_OUT_OF_RANGE_ERR_CODE);
+
+    /* a bucket that could never pass a message */
+    TestTblData.Entry[1].CommandCode = 0;
+    TestTblData.Entry[1].BurstSize   = 0;
+    UtAssert_INT32_EQ(SAMPLE_APP_RateLimitValidationFunc(&TestTblData), SAMPLE_APP_TABLE_OUT_OF_RANGE_ERR_CODE);
+
+    /* or never refill */
+    TestTblData.Entry[1].BurstSize  = 1;
+    TestTblData.Entry[1].RatePerSec = 0;
+    UtAssert_INT32_EQ(SAMPLE_APP_RateLimitValidationFunc(&TestTblData), SAMPLE_APP_TABLE_OUT_OF_RANGE_ERR_CODE);
+}
+
+void Test_SAMPLE_APP_UpdateRateLimits(void)
+{
+    /*
+     * Test Case For:
+     * void SAMPLE_APP_UpdateRateLimits( void )
+     */
+    SAMPLE_APP_RateLimitTable_t TestTblData;
+    void *                      TblPtr = &TestTblData;
+
+    memset(&TestTblData, 0, sizeof(TestTblData));
+    memset(&SAMPLE_APP_Data, 0, sizeof(SAMPLE_APP_Data));
+
+    TestTblData.Entry[1].MsgId       = SAMPLE_APP_CMD_MID;
+    TestTblData.Entry[1].CommandCode = SAMPLE_APP_PROCESS_CC;
+    TestTblData.Entry[1].BurstSize   = 3;
+    TestTblData.Entry[1].RatePerSec  = 2;
+
+    /* unchanged table, the buckets are left alone */
+    UT_SetDataBuffer(UT_KEY(CFE_TBL_GetAddress), &TblPtr, sizeof(TblPtr), false);
+    SAMPLE_APP_UpdateRateLimits();
+    UtAssert_ZERO(SAMPLE_APP_Data.RateIndex[0][SAMPLE_APP_PROCESS_CC]);
+    UtAssert_STUB_COUNT(CFE_TBL_ReleaseAddress, 1);
+
+    /* updated table, the index and buckets are rebuilt full */
+    SAMPLE_APP_Data.RateIndex[1][0] = 1;
+    UT_SetDataBuffer(UT_KEY(CFE_TBL_GetAddress), &TblPtr, sizeof(TblPtr), false);
+    UT_SetDeferredRetcode(UT_KEY(CFE_TBL_GetAddress), 1, CFE_TBL_INFO_UPDATED);
+    SAMPLE_APP_UpdateRateLimits();
+    UtAssert_UINT32_EQ(SAMPLE_APP_Data.RateIndex[0][SAMPLE_APP_PROCESS_CC], 2);
+    UtAssert_ZERO(SAMPLE_APP_Data.RateIndex[1][0]);
+    UtAssert_UINT32_EQ(SAMPLE_APP_Data.RateBucket[1].Tokens, 3000);
+    UtAssert_UINT32_EQ(SAMPLE_APP_Data.RateBucket[1].MaxTokens, 3000);
+    UtAssert_UINT32_EQ(SAMPLE_APP_Data.RateBucket[1].RatePerSec, 2);
+    UtAssert_STUB_COUNT(CFE_TIME_GetTime, 1);
+    UtAssert_STUB_COUNT(CFE_TBL_ReleaseAddress, 2);
+
+    /* error, nothing is held */
+    UT_SetDeferredRetcode(UT_KEY(CFE_TBL_GetAddress), 1, CFE_TBL_ERR_NEVER_LOADED);
+    SAMPLE_APP_UpdateRateLimits();
+    UtAssert_UINT32_EQ(SAMPLE_APP_Data.RateIndex[0][SAMPLE_APP_PROCESS_CC], 2);
+    UtAssert_STUB_COUNT(CFE_TBL_ReleaseAddress, 2);
+}
+
+void Test_SAMPLE_APP_RateLimitCheck(void)
+{
+    /*
+     * Test Case For:
+     * bool SAMPLE_APP_RateLimitCheck( const SAMPLE_APP_MsgContext_t *MsgCtx )
+     */
+    SAMPLE_APP_MsgContext_t MsgCtx;
+    CFE_TIME_SysTime_t      Elapsed;
+
+    memset(&MsgCtx, 0, sizeof(MsgCtx));
+    memset(&Elapsed, 0, sizeof(Elapsed));
+    memset(&SAMPLE_APP_Data, 0, sizeof(SAMPLE_APP_Data));
+
+    UT_SetHandlerFunction(UT_KEY(CFE_TIME_Subtract), UT_Handler_CFE_TIME_Subtract, &Elapsed);
+
+    SAMPLE_APP_Data.RateIndex[0][SAMPLE_APP_PROCESS_CC] = 3;
+    SAMPLE_APP_Data.RateBucket[2].Tokens                = 2000;
+    SAMPLE_APP_Data.RateBucket[2].MaxTokens             = 2000;
+    SAMPLE_APP_Data.RateBucket[2].RatePerSec            = 1;
+
+    /* other MIDs, codes beyond those tracked and codes with no entry are not limited */
+    MsgCtx.MsgId = CFE_SB_ValueToMsgId(SAMPLE_APP_HK_TLM_MID);
+    UtAssert_BOOL_TRUE(SAMPLE_APP_RateLimitCheck(&MsgCtx));
+    MsgCtx.MsgId   = CFE_SB_ValueToMsgId(SAMPLE_APP_CMD_MID);
+    MsgCtx.FcnCode = SAMPLE_APP_ADMIT_MAX_CC;
+    UtAssert_BOOL_TRUE(SAMPLE_APP_RateLimitCheck(&MsgCtx));
+    MsgCtx.FcnCode = SAMPLE_APP_NOOP_CC;
+    UtAssert_BOOL_TRUE(SAMPLE_APP_RateLimitCheck(&MsgCtx));
+    UtAssert_STUB_COUNT(CFE_TIME_Subtract, 0);
+
+    /* a burst passes, then the next message is rejected and counted */
+    MsgCtx.FcnCode = SAMPLE_APP_PROCESS_CC;
+    UtAssert_BOOL_TRUE(SAMPLE_APP_RateLimitCheck(&MsgCtx));
+    UtAssert_BOOL_TRUE(SAMPLE_APP_RateLimitCheck(&MsgCtx));
+    UtAssert_BOOL_FALSE(SAMPLE_APP_RateLimitCheck(&MsgCtx));
+    UtAssert_UINT32_EQ(SAMPLE_APP_Data.AdmitTlm.Payload.RateLimitCount[2], 1);
+    UtAssert_UINT32_EQ(SAMPLE_APP_Data.RateLimitReportCount, 1);
+
+    /* part of a second refills part of a token, not enough for a message */
+    UT_SetDefaultReturnValue(UT_KEY(CFE_TIME_Sub2MicroSecs), 500000);
+    UtAssert_BOOL_FALSE(SAMPLE_APP_RateLimitCheck(&MsgCtx));
+    UtAssert_UINT32_EQ(SAMPLE_APP_Data.RateBucket[2].Tokens, 500);
+    UtAssert_BOOL_TRUE(SAMPLE_APP_RateLimitCheck(&MsgCtx));
+    UtAssert_ZERO(SAMPLE_APP_Data.RateBucket[2].Tokens);
+    UtAssert_UINT32_EQ(SAMPLE_APP_Data.AdmitTlm.Payload.RateLimitCount[2], 2);
+
+    /* a long idle refills no further than the burst size */
+    Elapsed.Seconds = 100;
+    UtAssert_BOOL_TRUE(SAMPLE_APP_RateLimitCheck(&MsgCtx));
+    UtAssert_UINT32_EQ(SAMPLE_APP_Data.RateBucket[2].Tokens, 1000);
+
+    /* a receive time older than the last refill adds nothing and leaves the refill time alone */
+    SAMPLE_APP_Data.RateBucket[2].LastRefill.Seconds = 50;
+    MsgCtx.RcvTime.Seconds                           = 10;
+    UT_SetDeferredRetcode(UT_KEY(CFE_TIME_Compare), 1, CFE_TIME_A_LT_B);
+    UtAssert_BOOL_FALSE(SAMPLE_APP_RateLimitCheck(&MsgCtx));
+    UtAssert_ZERO(SAMPLE_APP_Data.RateBucket[2].Tokens);
+    UtAssert_UINT32_EQ(SAMPLE_APP_Data.RateBucket[2].LastRefill.Seconds, 50);
+    UtAssert_STUB_COUNT(CFE_TIME_Subtract, 6);
+}
+
+void Test_SAMPLE_APP_ReportRateLimits(void)
+{
+    /*
+     * Test Case For:
+     * void SAMPLE_APP_ReportRateLimits( void )
+     */
+    UT_CheckEvent_t EventTest;
+
+    /* nothing rejected, nothing reported */
+    SAMPLE_APP_Data.RateLimitReportCount = 0;
+    SAMPLE_APP_ReportRateLimits();
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+
+    /* rejects are summarized in one event and the count restarted */
+    UT_CHECKEVENT_SETUP(&EventTest, SAMPLE_APP_RATE_LIMIT_ERR_EID, NULL);
+    SAMPLE_APP_Data.RateLimitReportCount = 3;
+    SAMPLE_APP_ReportRateLimits();
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_UINT32_EQ(EventTest.MatchCount, 1);
+    UtAssert_ZERO(SAMPLE_APP_Data.RateLimitReportCount);
+}
+
+/*
+ * Register the test cases to execute with the unit test tool
+ */
+void UtTest_Setup(void)
+{
+    ADD_TEST(SAMPLE_APP_RateLimitValidationFunc);
+    ADD_TEST(SAMPLE_APP_UpdateRateLimits);
+    ADD_TEST(SAMPLE_APP_RateLimitCheck);
+    ADD_TEST(SAMPLE_APP_ReportRateLimits);
+}
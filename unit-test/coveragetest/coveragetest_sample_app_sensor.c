@@ -0,0 +1,179 @@
+/************************************************************************
+ * NASA Docket No. GSC-18,719-1, and identified as “core Flight System: Bootes”
+ *
+ * Copyright (c) 2020 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/*
+** File: coveragetest_sample_app.c
+**
+** Purpose:
+** Coverage Unit Test cases for the Sample Application
+**
+** Notes:
+** This implements various test cases to exercise all code
+** paths through all functions defined in the Sample application.
+**
+** It is primarily focused at providing examples of the various
+** stub configurations, hook functions, and wrapper calls that
+** are often needed when coercing certain code paths through
+** complex functions.
+*/
+
+
+/*
+ * Includes
+ */
+#include "sample_app_coveragetest_common.h"
+
+/*
+ * Handler to capture the input run the filter kernel was given
+ */
+static void UT_Handler_SAMPLE_APP_FirFilterS16(void *UserObj, UT_EntryKey_t FuncKey, const UT_StubContext_t *Context)
+{
+    const int16 **In = UserObj;
+
+    *In = UT_Hook_GetArgValueByName(Context, "In", const int16 *);
+}
+
+/*
+ * Handler to capture the lookup table the conversion was given
+ */
+static void UT_Handler_SAMPLE_APP_CalConvert(void *UserObj, UT_EntryKey_t FuncKey, const UT_StubContext_t *Context)
+{
+    const SAMPLE_APP_CalSegments_t **Lut = UserObj;
+
+    *Lut = UT_Hook_GetArgValueByName(Context, "Lut", const SAMPLE_APP_CalSegments_t *);
+}
+
+/*
+**********************************************************************************
+**          TEST CASE FUNCTIONS
+**********************************************************************************
+*/
+
+void Test_SAMPLE_APP_SensorDataCmd(void)
+{
+    /*
+     * Test Case For:
+     * CFE_Status_t SAMPLE_APP_SensorDataCmd( const SAMPLE_APP_SensorDataCmd_t *Msg )
+     */
+    SAMPLE_APP_SensorDataCmd_t      TestMsg;
+    SAMPLE_APP_SensorChannel_t *    Chan = &SAMPLE_APP_Data.Sensor[1];
+    const int16 *                   In   = NULL;
+    const SAMPLE_APP_CalSegments_t *Lut  = NULL;
+    UT_CheckEvent_t                 EventTest;
+    uint32                          i;
+
+    memset(&TestMsg, 0, sizeof(TestMsg));
+    memset(&SAMPLE_APP_Data, 0, sizeof(SAMPLE_APP_Data));
+    UT_SetHandlerFunction(UT_KEY(SAMPLE_APP_TlmBegin), UT_Handler_SAMPLE_APP_TlmBegin, NULL);
+    UT_SetHandlerFunction(UT_KEY(SAMPLE_APP_FirFilterS16), UT_Handler_SAMPLE_APP_FirFilterS16, &In);
+    UT_SetHandlerFunction(UT_KEY(SAMPLE_APP_CalConvert), UT_Handler_SAMPLE_APP_CalConvert, &Lut);
+    UT_SetDefaultReturnValue(UT_KEY(SAMPLE_APP_RangeCheckS16), SAMPLE_APP_SENSOR_BLOCK_SAMPLES);
+
+    /* a channel out of range is rejected */
+    UT_CHECKEVENT_SETUP(&EventTest, SAMPLE_APP_SENSOR_ERR_EID, NULL);
+    TestMsg.Payload.Channel = SAMPLE_APP_SENSOR_CHANNELS;
+    UtAssert_INT32_EQ(SAMPLE_APP_SensorDataCmd(&TestMsg), SAMPLE_APP_SENSOR_CHANNEL_ERR_CODE);
+    UtAssert_UINT32_EQ(EventTest.MatchCount, 1);
+    UtAssert_UINT32_EQ(SAMPLE_APP_Data.ErrCounter, 1);
+    UtAssert_STUB_COUNT(SAMPLE_APP_TlmBegin, 0);
+    UtAssert_STUB_COUNT(SAMPLE_APP_RangeCheckS16, 0);
+
+    /* a block with a sample out of range is rejected, naming the first bad sample */
+    TestMsg.Payload.Channel = 1;
+    UT_SetDeferredRetcode(UT_KEY(SAMPLE_APP_RangeCheckS16), 1, 5);
+    UtAssert_INT32_EQ(SAMPLE_APP_SensorDataCmd(&TestMsg), SAMPLE_APP_SENSOR_RANGE_ERR_CODE);
+    UtAssert_UINT32_EQ(EventTest.MatchCount, 2);
+    UtAssert_UINT32_EQ(SAMPLE_APP_Data.ErrCounter, 2);
+    UtAssert_STUB_COUNT(SAMPLE_APP_TlmBegin, 0);
+    UtAssert_ZERO(Chan->In[SAMPLE_APP_FIR_MAX_TAPS - 2]);
+
+    /* with no filter loaded the samples are passed through */
+    TestMsg.Payload.Channel = 1;
+    for (i = 0; i < SAMPLE_APP_SENSOR_BLOCK_SAMPLES; ++i)
+    {
+        TestMsg.Payload.Sample[i] = (int16)(i + 1);
+    }
+    UtAssert_INT32_EQ(SAMPLE_APP_SensorDataCmd(&TestMsg), CFE_SUCCESS);
+    UtAssert_STUB_COUNT(SAMPLE_APP_RangeCheckS16, 2);
+    UtAssert_STUB_COUNT(SAMPLE_APP_FirFilterS16, 0);
+    UtAssert_STUB_COUNT(SAMPLE_APP_TlmSend, 2);
+    UtAssert_STUB_COUNT(SAMPLE_APP_WinStatsAdd, 1);
+    UtAssert_STUB_COUNT(SAMPLE_APP_QuantileAdd, 1);
+    UtAssert_UINT32_EQ(SAMPLE_APP_Data.FilteredTlm.Payload.Channel, 1);
+    UtAssert_MemCmp(SAMPLE_APP_Data.FilteredTlm.Payload.Sample, TestMsg.Payload.Sample,
+                    sizeof(TestMsg.Payload.Sample), "Samples passed through");
+
+    /* the filtered samples are also sent in engineering units by the channel's curve */
+    UtAssert_STUB_COUNT(SAMPLE_APP_CalConvert, 1);
+    UtAssert_ADDRESS_EQ(Lut, &SAMPLE_APP_Data.CalLut.Channel[1]);
+    UtAssert_UINT32_EQ(SAMPLE_APP_Data.EngTlm.Payload.Channel, 1);
+
+    /* and the newest of them are kept as the history of the next block */
+    UtAssert_INT32_EQ(Chan->In[SAMPLE_APP_FIR_MAX_TAPS - 2], SAMPLE_APP_SENSOR_BLOCK_SAMPLES);
+
+    /* with a filter the kernel starts its run just far enough back into the history */
+    SAMPLE_APP_Data.FirNumTaps = 3;
+    UtAssert_INT32_EQ(SAMPLE_APP_SensorDataCmd(&TestMsg), CFE_SUCCESS);
+    UtAssert_STUB_COUNT(SAMPLE_APP_FirFilterS16, 1);
+    UtAssert_STUB_COUNT(SAMPLE_APP_TlmSend, 4);
+    UtAssert_STUB_COUNT(SAMPLE_APP_CalConvert, 2);
+    UtAssert_STUB_COUNT(SAMPLE_APP_WinStatsAdd, 2);
+    UtAssert_STUB_COUNT(SAMPLE_APP_QuantileAdd, 2);
+    UtAssert_ADDRESS_EQ(In, &Chan->In[SAMPLE_APP_FIR_MAX_TAPS - 3]);
+    UtAssert_INT32_EQ(In[0], SAMPLE_APP_SENSOR_BLOCK_SAMPLES - 1);
+    UtAssert_INT32_EQ(In[2], 1);
+
+    /* other channels are untouched */
+    UtAssert_ZERO(SAMPLE_APP_Data.Sensor[0].In[SAMPLE_APP_FIR_MAX_TAPS - 2]);
+}
+
+void Test_SAMPLE_APP_SensorSetFilter(void)
+{
+    /*
+     * Test Case For:
+     * void SAMPLE_APP_SensorSetFilter( const SAMPLE_APP_ExampleTable_t *TblPtr )
+     */
+    SAMPLE_APP_ExampleTable_t TestTblData;
+
+    memset(&TestTblData, 0, sizeof(TestTblData));
+
+    /* taps are taken in reverse order */
+    TestTblData.FirNumTaps  = 3;
+    TestTblData.FirCoeff[0] = 100;
+    TestTblData.FirCoeff[1] = 200;
+    TestTblData.FirCoeff[2] = -300;
+    SAMPLE_APP_SensorSetFilter(&TestTblData);
+    UtAssert_UINT32_EQ(SAMPLE_APP_Data.FirNumTaps, 3);
+    UtAssert_INT32_EQ(SAMPLE_APP_Data.FirTaps[0], -300);
+    UtAssert_INT32_EQ(SAMPLE_APP_Data.FirTaps[1], 200);
+    UtAssert_INT32_EQ(SAMPLE_APP_Data.FirTaps[2], 100);
+
+    /* no taps turns the filter off */
+    TestTblData.FirNumTaps = 0;
+    SAMPLE_APP_SensorSetFilter(&TestTblData);
+    UtAssert_ZERO(SAMPLE_APP_Data.FirNumTaps);
+}
+
+/*
+ * Register the test cases to execute with the unit test tool
+ */
+void UtTest_Setup(void)
+{
+    ADD_TEST(SAMPLE_APP_SensorDataCmd);
+    ADD_TEST(SAMPLE_APP_SensorSetFilter);
+}
@@ -0,0 +1,137 @@
+/************************************************************************
+ * NASA Docket No. GSC-18,719-1, and identified as “core Flight System: Bootes”
+ *
+ * Copyright (c) 2020 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/*
+** File: coveragetest_sample_app.c
+**
+** Purpose:
+** Coverage Unit Test cases for the Sample Application
+**
+** Notes:
+** This implements various test cases to exercise all code
+** paths through all functions defined in the Sample application.
+**
+** It is primarily focused at providing examples of the various
+** stub configurations, hook functions, and wrapper calls that
+** are often needed when coercing certain code paths through
+** complex functions.
+*/
+
+
+/*
+ * Includes
+ */
+#include "sample_app_coveragetest_common.h"
+
+/*
+ * Helper to record one dispatch of the given MID/CC taking the given time
+ */
+static void UT_RecordDispatch(CFE_SB_MsgId_t MsgId, CFE_MSG_FcnCode_t FcnCode, uint32 Latency)
+{
+    SAMPLE_APP_MsgContext_t MsgCtx;
+
+    memset(&MsgCtx, 0, sizeof(MsgCtx));
+    MsgCtx.MsgId   = MsgId;
+    MsgCtx.FcnCode = FcnCode;
+
+    UT_SetDefaultReturnValue(UT_KEY(CFE_TIME_Sub2MicroSecs), Latency);
+
+    SAMPLE_APP_RecordDispatchLatency(&MsgCtx);
+}
+
+/*
+**********************************************************************************
+**          TEST CASE FUNCTIONS
+**********************************************************************************
+*/
+
+void Test_SAMPLE_APP_RecordDispatchLatency(void)
+{
+    /*
+     * Test Case For:
+     * void SAMPLE_APP_RecordDispatchLatency( const SAMPLE_APP_MsgContext_t *MsgCtx )
+     */
+    SAMPLE_APP_StatsTlm_Payload_t *Stats = &SAMPLE_APP_Data.StatsTlm.Payload;
+    CFE_SB_MsgId_t                 CmdMid = CFE_SB_ValueToMsgId(SAMPLE_APP_CMD_MID);
+    CFE_TIME_SysTime_t             Elapsed;
+    uint32                         i;
+
+    memset(Stats, 0, sizeof(*Stats));
+
+    /* first dispatch of a MID/CC takes the first entry, under 2us lands in bin 0 */
+    UT_RecordDispatch(CmdMid, SAMPLE_APP_NOOP_CC, 1);
+    UtAssert_UINT32_EQ(Stats->Entry[0].MsgId, CFE_SB_MsgIdToValue(CmdMid));
+    UtAssert_UINT32_EQ(Stats->Entry[0].CommandCode, SAMPLE_APP_NOOP_CC);
+    UtAssert_UINT32_EQ(Stats->Entry[0].DispatchCount, 1);
+    UtAssert_UINT32_EQ(Stats->Entry[0].LatencyHist[0], 1);
+
+    /* same MID/CC reuses the entry, 100us lands in the [64,128) bin */
+    UT_RecordDispatch(CmdMid, SAMPLE_APP_NOOP_CC, 100);
+    UtAssert_UINT32_EQ(Stats->Entry[0].DispatchCount, 2);
+    UtAssert_UINT32_EQ(Stats->Entry[0].LatencyHist[6], 1);
+    UtAssert_UINT32_EQ(Stats->Entry[0].MaxLatency, 100);
+
+    /* a shorter dispatch does not change the maximum */
+    UT_RecordDispatch(CmdMid, SAMPLE_APP_NOOP_CC, 10);
+    UtAssert_UINT32_EQ(Stats->Entry[0].MaxLatency, 100);
+
+    /* a different CC takes the next entry */
+    UT_RecordDispatch(CmdMid, SAMPLE_APP_PROCESS_CC, 10);
+    UtAssert_UINT32_EQ(Stats->Entry[1].CommandCode, SAMPLE_APP_PROCESS_CC);
+    UtAssert_UINT32_EQ(Stats->Entry[1].DispatchCount, 1);
+
+    /* fill the remaining entries, then one more is untracked */
+    for (i = 2; i <= SAMPLE_APP_STATS_MAX_ENTRIES; i++)
+    {
+        UT_RecordDispatch(CmdMid, 100 + i, 10);
+    }
+    UtAssert_UINT32_EQ(Stats->UntrackedCount, 1);
+
+    /* very long dispatches saturate into the last bin */
+    memset(Stats, 0, sizeof(*Stats));
+    memset(&Elapsed, 0, sizeof(Elapsed));
+    Elapsed.Seconds = 3600;
+    UT_SetHandlerFunction(UT_KEY(CFE_TIME_Subtract), UT_Handler_CFE_TIME_Subtract, &Elapsed);
+    UT_RecordDispatch(CmdMid, SAMPLE_APP_NOOP_CC, 0);
+    UtAssert_UINT32_EQ(Stats->Entry[0].LatencyHist[SAMPLE_APP_LATENCY_HIST_BINS - 1], 1);
+    UtAssert_UINT32_EQ(Stats->Entry[0].MaxLatency, 0xFFFFFFFF);
+}
+
+void Test_SAMPLE_APP_ResetDispatchStats(void)
+{
+    /*
+     * Test Case For:
+     * void SAMPLE_APP_ResetDispatchStats( void )
+     */
+    SAMPLE_APP_Data.StatsTlm.Payload.UntrackedCount         = 5;
+    SAMPLE_APP_Data.StatsTlm.Payload.Entry[0].DispatchCount = 5;
+
+    SAMPLE_APP_ResetDispatchStats();
+
+    UtAssert_ZERO(SAMPLE_APP_Data.StatsTlm.Payload.UntrackedCount);
+    UtAssert_ZERO(SAMPLE_APP_Data.StatsTlm.Payload.Entry[0].DispatchCount);
+}
+
+/*
+ * Register the test cases to execute with the unit test tool
+ */
+void UtTest_Setup(void)
+{
+    ADD_TEST(SAMPLE_APP_RecordDispatchLatency);
+    ADD_TEST(SAMPLE_APP_ResetDispatchStats);
+}
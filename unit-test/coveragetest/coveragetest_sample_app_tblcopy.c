@@ -0,0 +1,199 @@
+/************************************************************************
+ * NASA Docket No. GSC-18,719-1, and identified as “core Flight System: Bootes”
+ *
+ * Copyright (c) 2020 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/*
+** File: coveragetest_sample_app.c
+**
+** Purpose:
+** Coverage Unit Test cases for the Sample Application
+**
+** Notes:
+** This implements various test cases to exercise all code
+** paths through all functions defined in the Sample application.
+**
+** It is primarily focused at providing examples of the various
+** stub configurations, hook functions, and wrapper calls that
+** are often needed when coercing certain code paths through
+** complex functions.
+*/
+
+
+/*
+ * Includes
+ */
+#include "sample_app_coveragetest_common.h"
+
+/*
+**********************************************************************************
+**          TEST CASE FUNCTIONS
+**********************************************************************************
+*/
+
+void Test_SAMPLE_APP_PublishTableCopy(void)
+{
+    /*
+     * Test Case For:
+     * void SAMPLE_APP_PublishTableCopy( const SAMPLE_APP_ExampleTable_t *TblPtr )
+     */
+    SAMPLE_APP_ExampleTable_t TestTblData;
+
+    memset(&TestTblData, 0, sizeof(TestTblData));
+    SAMPLE_APP_Data.TblCopyActive = NULL;
+    SAMPLE_APP_Data.TblCopySeq    = 0;
+
+    /* first load goes to the second copy */
+    TestTblData.Int1 = 1;
+    SAMPLE_APP_PublishTableCopy(&TestTblData);
+    UtAssert_ADDRESS_EQ(SAMPLE_APP_Data.TblCopyActive, &SAMPLE_APP_Data.TblCopy[1]);
+    UtAssert_UINT32_EQ(SAMPLE_APP_Data.TblCopy[1].Tbl.Int1, 1);
+    UtAssert_UINT32_EQ(SAMPLE_APP_Data.TblCopySeq, 2);
+
+    /* next load goes to the other copy, leaving the previous one intact */
+    TestTblData.Int1 = 2;
+    SAMPLE_APP_PublishTableCopy(&TestTblData);
+    UtAssert_ADDRESS_EQ(SAMPLE_APP_Data.TblCopyActive, &SAMPLE_APP_Data.TblCopy[0]);
+    UtAssert_UINT32_EQ(SAMPLE_APP_Data.TblCopy[0].Tbl.Int1, 2);
+    UtAssert_UINT32_EQ(SAMPLE_APP_Data.TblCopy[1].Tbl.Int1, 1);
+    UtAssert_UINT32_EQ(SAMPLE_APP_Data.TblCopySeq, 4);
+
+    /* each load rebuilds the record index, sorted by key then position */
+    TestTblData.NumRecords    = 3;
+    TestTblData.Record[0].Key = 30;
+    TestTblData.Record[1].Key = 10;
+    TestTblData.Record[2].Key = 30;
+    SAMPLE_APP_PublishTableCopy(&TestTblData);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 3);
+    UtAssert_UINT32_EQ(SAMPLE_APP_Data.TblCopy[1].IndexCount, 3);
+    UtAssert_UINT32_EQ(SAMPLE_APP_Data.TblCopy[1].Index[0].RecordIdx, 1);
+    UtAssert_UINT32_EQ(SAMPLE_APP_Data.TblCopy[1].Index[1].RecordIdx, 0);
+    UtAssert_UINT32_EQ(SAMPLE_APP_Data.TblCopy[1].Index[2].RecordIdx, 2);
+
+    /* a record count past the end is limited to the table size */
+    TestTblData.NumRecords = 1 + SAMPLE_APP_TBL_MAX_RECORDS;
+    SAMPLE_APP_PublishTableCopy(&TestTblData);
+    UtAssert_UINT32_EQ(SAMPLE_APP_Data.TblCopy[0].IndexCount, SAMPLE_APP_TBL_MAX_RECORDS);
+}
+
+void Test_SAMPLE_APP_TableCopyBegin(void)
+{
+    /*
+     * Test Case For:
+     * const SAMPLE_APP_ExampleTable_t *SAMPLE_APP_TableCopyBegin( uint32 *Token )
+     */
+    SAMPLE_APP_ExampleTable_t TestTblData;
+    uint32                    Token;
+
+    memset(&TestTblData, 0, sizeof(TestTblData));
+    SAMPLE_APP_Data.TblCopyActive = NULL;
+    SAMPLE_APP_Data.TblCopySeq    = 0;
+
+    /* nothing published yet */
+    UtAssert_NULL(SAMPLE_APP_TableCopyBegin(&Token));
+    UtAssert_ZERO(Token);
+
+    SAMPLE_APP_PublishTableCopy(&TestTblData);
+    UtAssert_ADDRESS_EQ(SAMPLE_APP_TableCopyBegin(&Token), &SAMPLE_APP_Data.TblCopy[1]);
+    UtAssert_UINT32_EQ(Token, 2);
+}
+
+void Test_SAMPLE_APP_TableCopyValid(void)
+{
+    /*
+     * Test Case For:
+     * bool SAMPLE_APP_TableCopyValid( uint32 Token )
+     */
+    SAMPLE_APP_ExampleTable_t TestTblData;
+    uint32                    Token;
+
+    memset(&TestTblData, 0, sizeof(TestTblData));
+    SAMPLE_APP_Data.TblCopyActive = NULL;
+    SAMPLE_APP_Data.TblCopySeq    = 0;
+    SAMPLE_APP_PublishTableCopy(&TestTblData);
+    SAMPLE_APP_TableCopyBegin(&Token);
+
+    /* no new load, and one new load into the other copy, are both fine */
+    UtAssert_BOOL_TRUE(SAMPLE_APP_TableCopyValid(Token));
+    SAMPLE_APP_PublishTableCopy(&TestTblData);
+    UtAssert_BOOL_TRUE(SAMPLE_APP_TableCopyValid(Token));
+
+    /* a second load is writing into the reader's copy */
+    SAMPLE_APP_Data.TblCopySeq++;
+    UtAssert_BOOL_FALSE(SAMPLE_APP_TableCopyValid(Token));
+
+    /* a reader that caught a load in progress is measured from the completed load */
+    SAMPLE_APP_Data.TblCopySeq = 3;
+    UtAssert_BOOL_TRUE(SAMPLE_APP_TableCopyValid(3));
+    SAMPLE_APP_Data.TblCopySeq = 4;
+    UtAssert_BOOL_TRUE(SAMPLE_APP_TableCopyValid(3));
+    SAMPLE_APP_Data.TblCopySeq = 5;
+    UtAssert_BOOL_FALSE(SAMPLE_APP_TableCopyValid(3));
+}
+
+void Test_SAMPLE_APP_FindRecord(void)
+{
+    /*
+     * Test Case For:
+     * const SAMPLE_APP_ExampleRecord_t *SAMPLE_APP_FindRecord( const SAMPLE_APP_TableCopy_t *Copy, uint16 Key )
+     */
+    SAMPLE_APP_ExampleTable_t TestTblData;
+    uint16                    i;
+
+    memset(&TestTblData, 0, sizeof(TestTblData));
+    SAMPLE_APP_Data.TblCopyActive = NULL;
+    SAMPLE_APP_Data.TblCopySeq    = 0;
+
+    /* nothing indexed, nothing found */
+    SAMPLE_APP_PublishTableCopy(&TestTblData);
+    UtAssert_NULL(SAMPLE_APP_FindRecord(SAMPLE_APP_Data.TblCopyActive, 0));
+
+    /* keys 200, 198, ..., 2 with a duplicate of key 100 at the end */
+    TestTblData.NumRecords = 101;
+    for (i = 0; i < 100; ++i)
+    {
+        TestTblData.Record[i].Key   = 200 - (2 * i);
+        TestTblData.Record[i].Value = i;
+    }
+    TestTblData.Record[100].Key   = 100;
+    TestTblData.Record[100].Value = 100;
+    SAMPLE_APP_PublishTableCopy(&TestTblData);
+
+    UtAssert_ADDRESS_EQ(SAMPLE_APP_FindRecord(SAMPLE_APP_Data.TblCopyActive, 200),
+                        &SAMPLE_APP_Data.TblCopyActive->Tbl.Record[0]);
+    UtAssert_ADDRESS_EQ(SAMPLE_APP_FindRecord(SAMPLE_APP_Data.TblCopyActive, 2),
+                        &SAMPLE_APP_Data.TblCopyActive->Tbl.Record[99]);
+
+    /* the first of the duplicates is returned */
+    UtAssert_ADDRESS_EQ(SAMPLE_APP_FindRecord(SAMPLE_APP_Data.TblCopyActive, 100),
+                        &SAMPLE_APP_Data.TblCopyActive->Tbl.Record[50]);
+
+    /* keys between, below and above those present are not found */
+    UtAssert_NULL(SAMPLE_APP_FindRecord(SAMPLE_APP_Data.TblCopyActive, 101));
+    UtAssert_NULL(SAMPLE_APP_FindRecord(SAMPLE_APP_Data.TblCopyActive, 0));
+    UtAssert_NULL(SAMPLE_APP_FindRecord(SAMPLE_APP_Data.TblCopyActive, 201));
+}
+
+/*
+ * Register the test cases to execute with the unit test tool
+ */
+void UtTest_Setup(void)
+{
+    ADD_TEST(SAMPLE_APP_PublishTableCopy);
+    ADD_TEST(SAMPLE_APP_TableCopyBegin);
+    ADD_TEST(SAMPLE_APP_TableCopyValid);
+    ADD_TEST(SAMPLE_APP_FindRecord);
+}
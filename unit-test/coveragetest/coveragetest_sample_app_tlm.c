@@ -0,0 +1,161 @@
+/************************************************************************
+ * NASA Docket No. GSC-18,719-1, and identified as “core Flight System: Bootes”
+ *
+ * Copyright (c) 2020 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/*
+** File: coveragetest_sample_app.c
+**
+** Purpose:
+** Coverage Unit Test cases for the Sample Application
+**
+** Notes:
+** This implements various test cases to exercise all code
+** paths through all functions defined in the Sample application.
+**
+** It is primarily focused at providing examples of the various
+** stub configurations, hook functions, and wrapper calls that
+** are often needed when coercing certain code paths through
+** complex functions.
+*/
+
+
+/*
+ * Includes
+ */
+#include "sample_app_coveragetest_common.h"
+
+/*
+ * Handler to return a specific buffer from CFE_SB_AllocateMessageBuffer
+ */
+static void UT_Handler_CFE_SB_AllocateMessageBuffer(void *UserObj, UT_EntryKey_t FuncKey,
+                                                    const UT_StubContext_t *Context)
+{
+    UT_Stub_SetReturnValue(FuncKey, UserObj);
+}
+
+/*
+**********************************************************************************
+**          TEST CASE FUNCTIONS
+**********************************************************************************
+*/
+
+void Test_SAMPLE_APP_TlmBegin(void)
+{
+    /*
+     * Test Case For:
+     * void *SAMPLE_APP_TlmBegin( SAMPLE_APP_TlmPacket_t *Pkt, CFE_MSG_TelemetryHeader_t *Fallback, size_t Size )
+     */
+    union
+    {
+        CFE_SB_Buffer_t    SBBuf;
+        SAMPLE_APP_HkTlm_t HkTlm;
+    } TestBuf;
+    SAMPLE_APP_TlmPacket_t Pkt;
+    SAMPLE_APP_HkTlm_t *   HkTlm;
+
+    memset(&TestBuf, 0, sizeof(TestBuf));
+    memset(&SAMPLE_APP_Data.HkTlm, 0xA5, sizeof(SAMPLE_APP_Data.HkTlm));
+    SAMPLE_APP_Data.TlmCopyCount = 0;
+
+    /* with an SB buffer the header is copied in and the payload left to the caller */
+    UT_SetHandlerFunction(UT_KEY(CFE_SB_AllocateMessageBuffer), UT_Handler_CFE_SB_AllocateMessageBuffer, &TestBuf);
+    HkTlm = SAMPLE_APP_TlmBegin(&Pkt, &SAMPLE_APP_Data.HkTlm.TelemetryHeader, sizeof(SAMPLE_APP_HkTlm_t));
+    UtAssert_ADDRESS_EQ(HkTlm, &TestBuf);
+    UtAssert_ADDRESS_EQ(Pkt.SBBufPtr, &TestBuf);
+    UtAssert_MemCmp(&TestBuf.HkTlm.TelemetryHeader, &SAMPLE_APP_Data.HkTlm.TelemetryHeader,
+                    sizeof(TestBuf.HkTlm.TelemetryHeader), "Header copied");
+    UtAssert_ZERO(TestBuf.HkTlm.Payload.CommandCounter);
+    UtAssert_ZERO(SAMPLE_APP_Data.TlmCopyCount);
+
+    /* without one the app's copy is used and counted */
+    UT_SetHandlerFunction(UT_KEY(CFE_SB_AllocateMessageBuffer), UT_Handler_CFE_SB_AllocateMessageBuffer, NULL);
+    HkTlm = SAMPLE_APP_TlmBegin(&Pkt, &SAMPLE_APP_Data.HkTlm.TelemetryHeader, sizeof(SAMPLE_APP_HkTlm_t));
+    UtAssert_ADDRESS_EQ(HkTlm, &SAMPLE_APP_Data.HkTlm);
+    UtAssert_NULL(Pkt.SBBufPtr);
+    UtAssert_UINT32_EQ(SAMPLE_APP_Data.TlmCopyCount, 1);
+}
+
+void Test_SAMPLE_APP_TlmSend(void)
+{
+    /*
+     * Test Case For:
+     * void SAMPLE_APP_TlmSend( SAMPLE_APP_TlmPacket_t *Pkt )
+     */
+    CFE_SB_Buffer_t        TestBuf;
+    SAMPLE_APP_TlmPacket_t Pkt;
+
+    memset(&TestBuf, 0, sizeof(TestBuf));
+
+    /* an SB buffer is handed over with no copy */
+    Pkt.SBBufPtr = &TestBuf;
+    Pkt.MsgPtr   = &TestBuf.Msg;
+    SAMPLE_APP_TlmSend(&Pkt);
+    UtAssert_STUB_COUNT(CFE_SB_TimeStampMsg, 1);
+    UtAssert_STUB_COUNT(CFE_SB_TransmitBuffer, 1);
+    UtAssert_STUB_COUNT(CFE_SB_ReleaseMessageBuffer, 0);
+    UtAssert_STUB_COUNT(CFE_SB_TransmitMsg, 0);
+    UtAssert_NULL(Pkt.SBBufPtr);
+
+    /* one that could not be sent is released */
+    Pkt.SBBufPtr = &TestBuf;
+    UT_SetDeferredRetcode(UT_KEY(CFE_SB_TransmitBuffer), 1, CFE_SB_BUF_ALOC_ERR);
+    SAMPLE_APP_TlmSend(&Pkt);
+    UtAssert_STUB_COUNT(CFE_SB_TransmitBuffer, 2);
+    UtAssert_STUB_COUNT(CFE_SB_ReleaseMessageBuffer, 1);
+
+    /* the app's copy is sent by copy */
+    Pkt.SBBufPtr = NULL;
+    Pkt.MsgPtr   = CFE_MSG_PTR(SAMPLE_APP_Data.HkTlm.TelemetryHeader);
+    SAMPLE_APP_TlmSend(&Pkt);
+    UtAssert_STUB_COUNT(CFE_SB_TransmitMsg, 1);
+    UtAssert_STUB_COUNT(CFE_SB_TransmitBuffer, 2);
+    UtAssert_STUB_COUNT(CFE_SB_TimeStampMsg, 3);
+}
+
+void Test_SAMPLE_APP_TlmDiscard(void)
+{
+    /*
+     * Test Case For:
+     * void SAMPLE_APP_TlmDiscard( SAMPLE_APP_TlmPacket_t *Pkt )
+     */
+    CFE_SB_Buffer_t        TestBuf;
+    SAMPLE_APP_TlmPacket_t Pkt;
+
+    /* an SB buffer is released unsent */
+    Pkt.SBBufPtr = &TestBuf;
+    Pkt.MsgPtr   = &TestBuf.Msg;
+    SAMPLE_APP_TlmDiscard(&Pkt);
+    UtAssert_STUB_COUNT(CFE_SB_ReleaseMessageBuffer, 1);
+    UtAssert_NULL(Pkt.SBBufPtr);
+
+    /* the app's copy needs nothing */
+    Pkt.MsgPtr = CFE_MSG_PTR(SAMPLE_APP_Data.HkTlm.TelemetryHeader);
+    SAMPLE_APP_TlmDiscard(&Pkt);
+    UtAssert_STUB_COUNT(CFE_SB_ReleaseMessageBuffer, 1);
+    UtAssert_STUB_COUNT(CFE_SB_TransmitBuffer, 0);
+    UtAssert_STUB_COUNT(CFE_SB_TransmitMsg, 0);
+}
+
+/*
+ * Register the test cases to execute with the unit test tool
+ */
+void UtTest_Setup(void)
+{
+    ADD_TEST(SAMPLE_APP_TlmBegin);
+    ADD_TEST(SAMPLE_APP_TlmSend);
+    ADD_TEST(SAMPLE_APP_TlmDiscard);
+}
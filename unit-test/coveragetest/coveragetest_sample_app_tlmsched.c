@@ -0,0 +1,105 @@
+/************************************************************************
+ * NASA Docket No. GSC-18,719-1, and identified as “core Flight System: Bootes”
+ *
+ * Copyright (c) 2020 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/*
+** File: coveragetest_sample_app.c
+**
+** Purpose:
+** Coverage Unit Test cases for the Sample Application
+**
+** Notes:
+** This implements various test cases to exercise all code
+** paths through all functions defined in the Sample application.
+**
+** It is primarily focused at providing examples of the various
+** stub configurations, hook functions, and wrapper calls that
+** are often needed when coercing certain code paths through
+** complex functions.
+*/
+
+
+/*
+ * Includes
+ */
+#include "sample_app_coveragetest_common.h"
+
+/*
+ * Products sent so far, over all schedule entries
+ */
+static uint32 UT_ProductsSent(void)
+{
+    return UT_GetStubCount(UT_KEY(SAMPLE_APP_SendHkCmd)) + UT_GetStubCount(UT_KEY(SAMPLE_APP_SendStatsTlm)) +
+           UT_GetStubCount(UT_KEY(SAMPLE_APP_SendAdmitTlm)) + UT_GetStubCount(UT_KEY(SAMPLE_APP_SendWinStatsTlm)) +
+           UT_GetStubCount(UT_KEY(SAMPLE_APP_SendQuantileTlm));
+}
+
+/*
+**********************************************************************************
+**          TEST CASE FUNCTIONS
+**********************************************************************************
+*/
+
+void Test_SAMPLE_APP_TlmScheduleCmd(void)
+{
+    /*
+     * Test Case For:
+     * CFE_Status_t SAMPLE_APP_TlmScheduleCmd( const SAMPLE_APP_SendHkCmd_t *Msg )
+     */
+    uint32 Wakeups = SAMPLE_APP_HK_TLM_DIVISOR * SAMPLE_APP_STATS_TLM_DIVISOR * SAMPLE_APP_ADMIT_TLM_DIVISOR *
+                     SAMPLE_APP_WINSTATS_TLM_DIVISOR * SAMPLE_APP_QUANTILE_TLM_DIVISOR;
+    uint32 Sent;
+    uint32 i;
+
+    SAMPLE_APP_Data.TlmWakeupCount = 0;
+
+    /* the first wakeup sends only the products in slot 0 */
+    UtAssert_INT32_EQ(SAMPLE_APP_TlmScheduleCmd(NULL), CFE_SUCCESS);
+    UtAssert_STUB_COUNT(SAMPLE_APP_PerformHousekeeping, 1);
+    UtAssert_STUB_COUNT(SAMPLE_APP_SendHkCmd, SAMPLE_APP_HK_TLM_SLOT == 0);
+    UtAssert_STUB_COUNT(SAMPLE_APP_SendStatsTlm, SAMPLE_APP_STATS_TLM_SLOT == 0);
+    UtAssert_STUB_COUNT(SAMPLE_APP_SendAdmitTlm, SAMPLE_APP_ADMIT_TLM_SLOT == 0);
+    UtAssert_STUB_COUNT(SAMPLE_APP_SendWinStatsTlm, SAMPLE_APP_WINSTATS_TLM_SLOT == 0);
+    UtAssert_STUB_COUNT(SAMPLE_APP_SendQuantileTlm, SAMPLE_APP_QUANTILE_TLM_SLOT == 0);
+    UtAssert_UINT32_EQ(SAMPLE_APP_Data.TlmWakeupCount, 1);
+
+    /* over a full cycle each product goes out once per divisor, and never all on one wakeup */
+    for (i = 1; i < Wakeups; ++i)
+    {
+        Sent = UT_ProductsSent();
+        SAMPLE_APP_TlmScheduleCmd(NULL);
+        Sent = UT_ProductsSent() - Sent;
+
+        UtAssert_True(Sent < 5, "Wakeup %lu sent %lu products", (unsigned long)i, (unsigned long)Sent);
+    }
+
+    /* upkeep runs on every wakeup, however rarely housekeeping itself is sent */
+    UtAssert_STUB_COUNT(SAMPLE_APP_PerformHousekeeping, Wakeups);
+    UtAssert_STUB_COUNT(SAMPLE_APP_SendHkCmd, Wakeups / SAMPLE_APP_HK_TLM_DIVISOR);
+    UtAssert_STUB_COUNT(SAMPLE_APP_SendStatsTlm, Wakeups / SAMPLE_APP_STATS_TLM_DIVISOR);
+    UtAssert_STUB_COUNT(SAMPLE_APP_SendAdmitTlm, Wakeups / SAMPLE_APP_ADMIT_TLM_DIVISOR);
+    UtAssert_STUB_COUNT(SAMPLE_APP_SendWinStatsTlm, Wakeups / SAMPLE_APP_WINSTATS_TLM_DIVISOR);
+    UtAssert_STUB_COUNT(SAMPLE_APP_SendQuantileTlm, Wakeups / SAMPLE_APP_QUANTILE_TLM_DIVISOR);
+}
+
+/*
+ * Register the test cases to execute with the unit test tool
+ */
+void UtTest_Setup(void)
+{
+    ADD_TEST(SAMPLE_APP_TlmScheduleCmd);
+}
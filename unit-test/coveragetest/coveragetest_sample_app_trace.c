@@ -0,0 +1,158 @@
+/************************************************************************
+ * NASA Docket No. GSC-18,719-1, and identified as “core Flight System: Bootes”
+ *
+ * Copyright (c) 2020 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/*
+** File: coveragetest_sample_app.c
+**
+** Purpose:
+** Coverage Unit Test cases for the Sample Application
+**
+** Notes:
+** This implements various test cases to exercise all code
+** paths through all functions defined in the Sample application.
+**
+** It is primarily focused at providing examples of the various
+** stub configurations, hook functions, and wrapper calls that
+** are often needed when coercing certain code paths through
+** complex functions.
+*/
+
+
+/*
+ * Includes
+ */
+#include "sample_app_coveragetest_common.h"
+
+/*
+**********************************************************************************
+**          TEST CASE FUNCTIONS
+**********************************************************************************
+*/
+
+void Test_SAMPLE_APP_Trace(void)
+{
+    /*
+     * Test Case For:
+     * void SAMPLE_APP_Trace( uint16 EventID, const void *Args, size_t ArgSize )
+     */
+    SAMPLE_APP_TraceRec_t *           Rec = SAMPLE_APP_Data.Trace.Rec;
+    SAMPLE_APP_DisplayParam_Payload_t Payload;
+    uint8                             Oversize[sizeof(Rec->Args) + 4];
+
+    memset(&SAMPLE_APP_Data.Trace, 0, sizeof(SAMPLE_APP_Data.Trace));
+    memset(&Payload, 0, sizeof(Payload));
+    memset(Oversize, 0xA5, sizeof(Oversize));
+
+    /* the raw arguments are stored with the event ID and time, and the record marked complete */
+    Payload.ValU32 = 10;
+    Payload.ValI16 = -4;
+    SAMPLE_APP_Trace(SAMPLE_APP_VALUE_INF_EID, &Payload, sizeof(Payload));
+    UtAssert_UINT32_EQ(SAMPLE_APP_Data.Trace.Head, 1);
+    UtAssert_UINT32_EQ(Rec[0].Seq, 1);
+    UtAssert_UINT32_EQ(Rec[0].EventID, SAMPLE_APP_VALUE_INF_EID);
+    UtAssert_UINT32_EQ(Rec[0].Args.DisplayParam.ValU32, 10);
+    UtAssert_INT32_EQ(Rec[0].Args.DisplayParam.ValI16, -4);
+    UtAssert_STUB_COUNT(CFE_TIME_GetTime, 1);
+
+    /* arguments too large for a record are cut short, not overflowed */
+    SAMPLE_APP_Trace(SAMPLE_APP_NOOP_INF_EID, Oversize, sizeof(Oversize));
+    UtAssert_UINT32_EQ(SAMPLE_APP_Data.Trace.Head, 2);
+    UtAssert_UINT32_EQ(Rec[1].Seq, 2);
+    UtAssert_UINT32_EQ(Rec[1].Args.TblValues.Crc, 0xA5A5A5A5);
+
+    /* no formatting is done when recording */
+    UtAssert_STUB_COUNT(CFE_EVS_SendTimedEvent, 0);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+}
+
+void Test_SAMPLE_APP_TraceFlush(void)
+{
+    /*
+     * Test Case For:
+     * void SAMPLE_APP_TraceFlush( void )
+     */
+    SAMPLE_APP_TraceLog_t *     Trace = &SAMPLE_APP_Data.Trace;
+    SAMPLE_APP_TraceTblValues_t Values;
+    uint32                      i;
+
+    memset(Trace, 0, sizeof(*Trace));
+    memset(&Values, 0, sizeof(Values));
+
+    /* nothing recorded, nothing sent */
+    SAMPLE_APP_TraceFlush();
+    UtAssert_STUB_COUNT(CFE_EVS_SendTimedEvent, 0);
+    UtAssert_ZERO(Trace->LostCount);
+
+    /* each record goes to its own sink, unknown IDs are skipped */
+    SAMPLE_APP_Trace(SAMPLE_APP_NOOP_INF_EID, NULL, 0);
+    SAMPLE_APP_Trace(SAMPLE_APP_RESET_INF_EID, NULL, 0);
+    SAMPLE_APP_Trace(SAMPLE_APP_VALUE_INF_EID, &Values, 0);
+    SAMPLE_APP_Trace(SAMPLE_APP_TBL_VALUES_INF_EID, &Values, sizeof(Values));
+    SAMPLE_APP_Trace(SAMPLE_APP_RESERVED_EID, NULL, 0);
+    SAMPLE_APP_TraceFlush();
+    UtAssert_STUB_COUNT(CFE_EVS_SendTimedEvent, 3);
+    UtAssert_STUB_COUNT(CFE_ES_WriteToSysLog, 1);
+    UtAssert_UINT32_EQ(Trace->Tail, 5);
+
+    /* at most the budget is formatted per call */
+    for (i = 0; i <= SAMPLE_APP_TRACE_FLUSH_BUDGET; ++i)
+    {
+        SAMPLE_APP_Trace(SAMPLE_APP_NOOP_INF_EID, NULL, 0);
+    }
+    SAMPLE_APP_TraceFlush();
+    UtAssert_STUB_COUNT(CFE_EVS_SendTimedEvent, 3 + SAMPLE_APP_TRACE_FLUSH_BUDGET);
+    SAMPLE_APP_TraceFlush();
+    UtAssert_STUB_COUNT(CFE_EVS_SendTimedEvent, 4 + SAMPLE_APP_TRACE_FLUSH_BUDGET);
+    UtAssert_UINT32_EQ(Trace->Tail, Trace->Head);
+
+    /* records more than a ring behind are counted as lost */
+    for (i = 0; i < SAMPLE_APP_TRACE_DEPTH + 3; ++i)
+    {
+        SAMPLE_APP_Trace(SAMPLE_APP_NOOP_INF_EID, NULL, 0);
+    }
+    SAMPLE_APP_TraceFlush();
+    UtAssert_UINT32_EQ(Trace->LostCount, 3);
+    UtAssert_UINT32_EQ(Trace->Head - Trace->Tail, SAMPLE_APP_TRACE_DEPTH - SAMPLE_APP_TRACE_FLUSH_BUDGET);
+    Trace->Tail = Trace->Head;
+
+    /* a record still being written is left for the next call */
+    Trace->Rec[Trace->Head & (SAMPLE_APP_TRACE_DEPTH - 1)].Seq = 0;
+    ++Trace->Head;
+    SAMPLE_APP_TraceFlush();
+    UtAssert_UINT32_EQ(Trace->Head - Trace->Tail, 1);
+
+    /* as is one claimed but not yet marked */
+    Trace->Rec[Trace->Tail & (SAMPLE_APP_TRACE_DEPTH - 1)].Seq = Trace->Tail + 1 - SAMPLE_APP_TRACE_DEPTH;
+    SAMPLE_APP_TraceFlush();
+    UtAssert_UINT32_EQ(Trace->Head - Trace->Tail, 1);
+
+    /* one already replaced by a writer that lapped the ring is lost */
+    Trace->Rec[Trace->Tail & (SAMPLE_APP_TRACE_DEPTH - 1)].Seq = Trace->Tail + 1 + SAMPLE_APP_TRACE_DEPTH;
+    SAMPLE_APP_TraceFlush();
+    UtAssert_UINT32_EQ(Trace->Tail, Trace->Head);
+    UtAssert_UINT32_EQ(Trace->LostCount, 4);
+}
+
+/*
+ * Register the test cases to execute with the unit test tool
+ */
+void UtTest_Setup(void)
+{
+    ADD_TEST(SAMPLE_APP_Trace);
+    ADD_TEST(SAMPLE_APP_TraceFlush);
+}
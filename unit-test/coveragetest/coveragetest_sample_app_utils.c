@@ -38,6 +38,28 @@
 #include "sample_lib.h" /* For SAMPLE_LIB_Function */
 #include "sample_app_coveragetest_common.h"
 
+/*
+ * Handler to range check the values the kernel was given, as it would
+ */
+static void UT_Handler_SAMPLE_APP_RangeCheckS16(void *UserObj, UT_EntryKey_t FuncKey, const UT_StubContext_t *Context)
+{
+    const int16 *Values = UT_Hook_GetArgValueByName(Context, "Values", const int16 *);
+    uint32       Count  = UT_Hook_GetArgValueByName(Context, "Count", uint32);
+    int16        Min    = UT_Hook_GetArgValueByName(Context, "Min", int16);
+    int16        Max    = UT_Hook_GetArgValueByName(Context, "Max", int16);
+    uint32       i;
+
+    for (i = 0; i < Count; ++i)
+    {
+        if (Values[i] < Min || Values[i] > Max)
+        {
+            break;
+        }
+    }
+
+    UT_Stub_SetReturnValue(FuncKey, i);
+}
+
 /*
 **********************************************************************************
 **          TEST CASE FUNCTIONS
@@ -51,8 +73,12 @@ void Test_SAMPLE_APP_TblValidationFunc(void)
      * CFE_Status_t SAMPLE_APP_TblValidationFunc( void *TblData )
      */
     SAMPLE_APP_ExampleTable_t TestTblData;
+    UT_CheckEvent_t           EventTest;
 
     memset(&TestTblData, 0, sizeof(TestTblData));
+    UT_SetHandlerFunction(UT_KEY(SAMPLE_APP_RangeCheckS16), UT_Handler_SAMPLE_APP_RangeCheckS16, NULL);
+    UT_CHECKEVENT_SETUP(&EventTest, SAMPLE_APP_TBL_FIR_ERR_EID,
+                        "Sample App: Example Table filter tap %lu is %d, past the %u in use");
 
     /* nominal case (0) should succeed */
     UtAssert_INT32_EQ(SAMPLE_APP_TblValidationFunc(&TestTblData), CFE_SUCCESS);
@@ -60,31 +86,307 @@ void Test_SAMPLE_APP_TblValidationFunc(void)
     /* error case should return SAMPLE_APP_TABLE_OUT_OF_RANGE_ERR_CODE */
     TestTblData.Int1 = 1 + SAMPLE_APP_TBL_ELEMENT_1_MAX;
     UtAssert_INT32_EQ(SAMPLE_APP_TblValidationFunc(&TestTblData), SAMPLE_APP_TABLE_OUT_OF_RANGE_ERR_CODE);
+
+    /* as should claiming more records than the table holds */
+    TestTblData.Int1       = 0;
+    TestTblData.NumRecords = 1 + SAMPLE_APP_TBL_MAX_RECORDS;
+    UtAssert_INT32_EQ(SAMPLE_APP_TblValidationFunc(&TestTblData), SAMPLE_APP_TABLE_OUT_OF_RANGE_ERR_CODE);
+
+    /* or more filter taps than the table holds */
+    TestTblData.NumRecords = 0;
+    TestTblData.FirNumTaps = 1 + SAMPLE_APP_FIR_MAX_TAPS;
+    UtAssert_INT32_EQ(SAMPLE_APP_TblValidationFunc(&TestTblData), SAMPLE_APP_TABLE_OUT_OF_RANGE_ERR_CODE);
+
+    /* or filter taps with more than unity gain */
+    TestTblData.FirNumTaps = SAMPLE_APP_FIR_MAX_TAPS;
+    UT_SetDeferredRetcode(UT_KEY(SAMPLE_APP_FirGain), 1, SAMPLE_APP_FIR_UNITY_GAIN + 1);
+    UtAssert_INT32_EQ(SAMPLE_APP_TblValidationFunc(&TestTblData), SAMPLE_APP_TABLE_OUT_OF_RANGE_ERR_CODE);
+    UT_SetDeferredRetcode(UT_KEY(SAMPLE_APP_FirGain), 1, SAMPLE_APP_FIR_UNITY_GAIN);
+    UtAssert_INT32_EQ(SAMPLE_APP_TblValidationFunc(&TestTblData), CFE_SUCCESS);
+    UtAssert_ZERO(EventTest.MatchCount);
+
+    /* taps past those in use are range checked as one column, and must all be 0 */
+    TestTblData.FirNumTaps  = 4;
+    TestTblData.FirCoeff[3] = 1;
+    UtAssert_INT32_EQ(SAMPLE_APP_TblValidationFunc(&TestTblData), CFE_SUCCESS);
+    UtAssert_STUB_COUNT(SAMPLE_APP_RangeCheckS16, 3);
+
+    TestTblData.FirCoeff[6] = -1;
+    TestTblData.FirCoeff[9] = 1;
+    UtAssert_INT32_EQ(SAMPLE_APP_TblValidationFunc(&TestTblData), SAMPLE_APP_TABLE_OUT_OF_RANGE_ERR_CODE);
+    UtAssert_UINT32_EQ(EventTest.MatchCount, 1);
+}
+
+void Test_SAMPLE_APP_TblCheckRecords(void)
+{
+    /*
+     * Test Case For:
+     * CFE_Status_t SAMPLE_APP_TblCheckRecords( const SAMPLE_APP_ExampleTable_t *TblPtr, uint16 *Cursor )
+     */
+    SAMPLE_APP_ExampleTable_t TestTblData;
+    uint16                    Cursor = 0;
+
+    memset(&TestTblData, 0, sizeof(TestTblData));
+
+    /* an empty table is complete straight away */
+    UtAssert_INT32_EQ(SAMPLE_APP_TblCheckRecords(&TestTblData, &Cursor), CFE_SUCCESS);
+    UtAssert_ZERO(Cursor);
+
+    /* a full table takes several calls, each checking at most the budget */
+    TestTblData.NumRecords = SAMPLE_APP_TBL_MAX_RECORDS;
+    UtAssert_INT32_EQ(SAMPLE_APP_TblCheckRecords(&TestTblData, &Cursor), SAMPLE_APP_TABLE_CHECK_PENDING);
+    UtAssert_UINT32_EQ(Cursor, SAMPLE_APP_TBL_CHECK_BUDGET);
+    while (Cursor < SAMPLE_APP_TBL_MAX_RECORDS - SAMPLE_APP_TBL_CHECK_BUDGET)
+    {
+        UtAssert_INT32_EQ(SAMPLE_APP_TblCheckRecords(&TestTblData, &Cursor), SAMPLE_APP_TABLE_CHECK_PENDING);
+    }
+    UtAssert_INT32_EQ(SAMPLE_APP_TblCheckRecords(&TestTblData, &Cursor), CFE_SUCCESS);
+    UtAssert_UINT32_EQ(Cursor, SAMPLE_APP_TBL_MAX_RECORDS);
+
+    /* a bad record stops the check with the cursor on it */
+    TestTblData.Record[SAMPLE_APP_TBL_CHECK_BUDGET + 1].Value = 1 + SAMPLE_APP_TBL_RECORD_VALUE_MAX;
+    Cursor                                                    = 0;
+    UtAssert_INT32_EQ(SAMPLE_APP_TblCheckRecords(&TestTblData, &Cursor), SAMPLE_APP_TABLE_CHECK_PENDING);
+    UtAssert_INT32_EQ(SAMPLE_APP_TblCheckRecords(&TestTblData, &Cursor), SAMPLE_APP_TABLE_OUT_OF_RANGE_ERR_CODE);
+    UtAssert_UINT32_EQ(Cursor, SAMPLE_APP_TBL_CHECK_BUDGET + 1);
 }
 
 void Test_SAMPLE_APP_GetCrc(void)
 {
     /*
      * Test Case For:
-     * void SAMPLE_APP_GetCrc( const char *TableName )
+     * void SAMPLE_APP_GetCrc( void )
      */
+    SAMPLE_APP_ExampleTable_t TestTblData;
 
     /*
-     * The only branch point here is CFE_TBL_GetInfo()
+     * The only branch point here is whether the table is held
      *
-     * Either way this function just does a write to syslog,
+     * Either way this function does a write to syslog,
      * and it is the same in both cases, just with
-     * a different message.  This could actually verify
-     * the message using a hook function, if desired.
+     * a different message.  The CRC is kept in the
+     * app global data.
      */
-
-    UT_SetDefaultReturnValue(UT_KEY(CFE_TBL_GetInfo), CFE_TBL_ERR_INVALID_NAME);
-    SAMPLE_APP_GetCrc("UT");
+    SAMPLE_APP_Data.ExampleTblCrc = 1;
+    SAMPLE_APP_Data.ExampleTblPtr = NULL;
+    SAMPLE_APP_GetCrc();
     UtAssert_STUB_COUNT(CFE_ES_WriteToSysLog, 1);
+    UtAssert_ZERO(SAMPLE_APP_Data.ExampleTblCrc);
 
-    UT_ClearDefaultReturnValue(UT_KEY(CFE_TBL_GetInfo));
-    SAMPLE_APP_GetCrc("UT");
+    memset(&TestTblData, 0, sizeof(TestTblData));
+    SAMPLE_APP_Data.ExampleTblPtr = &TestTblData;
+    UT_SetDefaultReturnValue(UT_KEY(SAMPLE_APP_Crc32c), 0x1234);
+    SAMPLE_APP_GetCrc();
     UtAssert_STUB_COUNT(CFE_ES_WriteToSysLog, 2);
+    UtAssert_STUB_COUNT(SAMPLE_APP_Crc32c, 1);
+    UtAssert_UINT32_EQ(SAMPLE_APP_Data.ExampleTblCrc, 0x1234);
+}
+
+void Test_SAMPLE_APP_AcquireExampleTable(void)
+{
+    /*
+     * Test Case For:
+     * CFE_Status_t SAMPLE_APP_AcquireExampleTable( void )
+     */
+    SAMPLE_APP_ExampleTable_t TestTblData;
+    void *                    TblPtr = &TestTblData;
+
+    memset(&TestTblData, 0, sizeof(TestTblData));
+    SAMPLE_APP_Data.TblCheckPending = false;
+
+    /* unchanged table, the pointer is cached without refreshing the info */
+    UT_SetDataBuffer(UT_KEY(CFE_TBL_GetAddress), &TblPtr, sizeof(TblPtr), false);
+    UtAssert_INT32_EQ(SAMPLE_APP_AcquireExampleTable(), CFE_SUCCESS);
+    UtAssert_ADDRESS_EQ(SAMPLE_APP_Data.ExampleTblPtr, &TestTblData);
+    UtAssert_STUB_COUNT(SAMPLE_APP_Crc32c, 0);
+    UtAssert_STUB_COUNT(SAMPLE_APP_PublishTableCopy, 0);
+
+    /* updated table, the info is refreshed and the reader copy published once checked */
+    UT_SetDataBuffer(UT_KEY(CFE_TBL_GetAddress), &TblPtr, sizeof(TblPtr), false);
+    UT_SetDeferredRetcode(UT_KEY(CFE_TBL_GetAddress), 1, CFE_TBL_INFO_UPDATED);
+    UtAssert_INT32_EQ(SAMPLE_APP_AcquireExampleTable(), CFE_TBL_INFO_UPDATED);
+    UtAssert_ADDRESS_EQ(SAMPLE_APP_Data.ExampleTblPtr, &TestTblData);
+    UtAssert_STUB_COUNT(SAMPLE_APP_Crc32c, 1);
+    UtAssert_STUB_COUNT(SAMPLE_APP_PublishTableCopy, 1);
+    UtAssert_STUB_COUNT(SAMPLE_APP_SensorSetFilter, 1);
+    UtAssert_STUB_COUNT(CFE_ES_WriteToSysLog, 1);
+    UtAssert_BOOL_FALSE(SAMPLE_APP_Data.TblCheckPending);
+
+    /* a load too large to check in one cycle is published on a later one */
+    TestTblData.NumRecords = SAMPLE_APP_TBL_CHECK_BUDGET + 1;
+    UT_SetDataBuffer(UT_KEY(CFE_TBL_GetAddress), &TblPtr, sizeof(TblPtr), false);
+    UT_SetDeferredRetcode(UT_KEY(CFE_TBL_GetAddress), 1, CFE_TBL_INFO_UPDATED);
+    UtAssert_INT32_EQ(SAMPLE_APP_AcquireExampleTable(), CFE_TBL_INFO_UPDATED);
+    UtAssert_BOOL_TRUE(SAMPLE_APP_Data.TblCheckPending);
+    UtAssert_STUB_COUNT(SAMPLE_APP_PublishTableCopy, 1);
+    UT_SetDataBuffer(UT_KEY(CFE_TBL_GetAddress), &TblPtr, sizeof(TblPtr), false);
+    UtAssert_INT32_EQ(SAMPLE_APP_AcquireExampleTable(), CFE_SUCCESS);
+    UtAssert_BOOL_FALSE(SAMPLE_APP_Data.TblCheckPending);
+    UtAssert_STUB_COUNT(SAMPLE_APP_PublishTableCopy, 2);
+
+    /* a load with a bad record is reported, not published and not held, with nothing to revert to */
+    TestTblData.Record[1].Value   = 1 + SAMPLE_APP_TBL_RECORD_VALUE_MAX;
+    SAMPLE_APP_Data.TblCopyActive = NULL;
+    UT_SetDataBuffer(UT_KEY(CFE_TBL_GetAddress), &TblPtr, sizeof(TblPtr), false);
+    UT_SetDeferredRetcode(UT_KEY(CFE_TBL_GetAddress), 1, CFE_TBL_INFO_UPDATED);
+    UtAssert_INT32_EQ(SAMPLE_APP_AcquireExampleTable(), CFE_TBL_INFO_UPDATED);
+    UtAssert_BOOL_FALSE(SAMPLE_APP_Data.TblCheckPending);
+    UtAssert_BOOL_TRUE(SAMPLE_APP_Data.TblRejected);
+    UtAssert_NULL(SAMPLE_APP_Data.ExampleTblPtr);
+    UtAssert_STUB_COUNT(SAMPLE_APP_PublishTableCopy, 2);
+    UtAssert_STUB_COUNT(SAMPLE_APP_SensorSetFilter, 2);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_STUB_COUNT(CFE_TBL_ReleaseAddress, 1);
+    UtAssert_STUB_COUNT(CFE_TBL_Load, 0);
+
+    /* the rejected load is still the active one, so it is released again rather than held */
+    UT_SetDataBuffer(UT_KEY(CFE_TBL_GetAddress), &TblPtr, sizeof(TblPtr), false);
+    UtAssert_INT32_EQ(SAMPLE_APP_AcquireExampleTable(), CFE_SUCCESS);
+    UtAssert_NULL(SAMPLE_APP_Data.ExampleTblPtr);
+    UtAssert_STUB_COUNT(CFE_TBL_ReleaseAddress, 2);
+
+    /* with a published copy, the last good image is loaded back over the bad one */
+    SAMPLE_APP_Data.TblCopyActive = &SAMPLE_APP_Data.TblCopy[0];
+    UT_SetDataBuffer(UT_KEY(CFE_TBL_GetAddress), &TblPtr, sizeof(TblPtr), false);
+    UT_SetDeferredRetcode(UT_KEY(CFE_TBL_GetAddress), 1, CFE_TBL_INFO_UPDATED);
+    UtAssert_INT32_EQ(SAMPLE_APP_AcquireExampleTable(), CFE_TBL_INFO_UPDATED);
+    UtAssert_NULL(SAMPLE_APP_Data.ExampleTblPtr);
+    UtAssert_STUB_COUNT(CFE_TBL_Load, 1);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 2);
+    UtAssert_STUB_COUNT(CFE_ES_WriteToSysLog, 4);
+
+    /* a failed revert is reported to syslog */
+    UT_SetDataBuffer(UT_KEY(CFE_TBL_GetAddress), &TblPtr, sizeof(TblPtr), false);
+    UT_SetDeferredRetcode(UT_KEY(CFE_TBL_GetAddress), 1, CFE_TBL_INFO_UPDATED);
+    UT_SetDeferredRetcode(UT_KEY(CFE_TBL_Load), 1, CFE_TBL_ERR_NO_ACCESS);
+    UtAssert_INT32_EQ(SAMPLE_APP_AcquireExampleTable(), CFE_TBL_INFO_UPDATED);
+    UtAssert_STUB_COUNT(CFE_TBL_Load, 2);
+    UtAssert_STUB_COUNT(CFE_ES_WriteToSysLog, 6);
+
+    /* the reverted image arrives as a new load and is held again */
+    TestTblData.Record[1].Value = SAMPLE_APP_TBL_RECORD_VALUE_MAX;
+    UT_SetDataBuffer(UT_KEY(CFE_TBL_GetAddress), &TblPtr, sizeof(TblPtr), false);
+    UT_SetDeferredRetcode(UT_KEY(CFE_TBL_GetAddress), 1, CFE_TBL_INFO_UPDATED);
+    UtAssert_INT32_EQ(SAMPLE_APP_AcquireExampleTable(), CFE_TBL_INFO_UPDATED);
+    UtAssert_BOOL_FALSE(SAMPLE_APP_Data.TblRejected);
+    UtAssert_ADDRESS_EQ(SAMPLE_APP_Data.ExampleTblPtr, &TestTblData);
+    UtAssert_STUB_COUNT(SAMPLE_APP_PublishTableCopy, 3);
+
+    /* error, nothing is held */
+    UT_SetDeferredRetcode(UT_KEY(CFE_TBL_GetAddress), 1, CFE_TBL_ERR_NEVER_LOADED);
+    UtAssert_INT32_EQ(SAMPLE_APP_AcquireExampleTable(), CFE_TBL_ERR_NEVER_LOADED);
+    UtAssert_NULL(SAMPLE_APP_Data.ExampleTblPtr);
+    UtAssert_STUB_COUNT(CFE_ES_WriteToSysLog, 8);
+}
+
+void Test_SAMPLE_APP_ReleaseExampleTable(void)
+{
+    /*
+     * Test Case For:
+     * void SAMPLE_APP_ReleaseExampleTable( void )
+     */
+    SAMPLE_APP_ExampleTable_t TestTblData;
+
+    /* nothing held, nothing to release */
+    SAMPLE_APP_Data.ExampleTblPtr = NULL;
+    SAMPLE_APP_ReleaseExampleTable();
+    UtAssert_STUB_COUNT(CFE_TBL_ReleaseAddress, 0);
+
+    /* nominal release */
+    SAMPLE_APP_Data.ExampleTblPtr = &TestTblData;
+    SAMPLE_APP_ReleaseExampleTable();
+    UtAssert_STUB_COUNT(CFE_TBL_ReleaseAddress, 1);
+    UtAssert_NULL(SAMPLE_APP_Data.ExampleTblPtr);
+
+    /* release error is reported to syslog */
+    SAMPLE_APP_Data.ExampleTblPtr = &TestTblData;
+    UT_SetDeferredRetcode(UT_KEY(CFE_TBL_ReleaseAddress), 1, CFE_TBL_ERR_NO_ACCESS);
+    SAMPLE_APP_ReleaseExampleTable();
+    UtAssert_STUB_COUNT(CFE_ES_WriteToSysLog, 1);
+    UtAssert_NULL(SAMPLE_APP_Data.ExampleTblPtr);
+}
+
+void Test_SAMPLE_APP_ScrubExampleTable(void)
+{
+    /*
+     * Test Case For:
+     * bool SAMPLE_APP_ScrubExampleTable( void )
+     */
+    SAMPLE_APP_ExampleTable_t TestTblData;
+    uint32                    Slices;
+
+    memset(&TestTblData, 0, sizeof(TestTblData));
+    SAMPLE_APP_Data.ScrubOffset     = 0;
+    SAMPLE_APP_Data.ScrubCrc        = 0;
+    SAMPLE_APP_Data.ScrubPassCount  = 0;
+    SAMPLE_APP_Data.ScrubErrorCount = 0;
+    SAMPLE_APP_Data.TblCheckPending = false;
+
+    /* nothing held, nothing scrubbed */
+    SAMPLE_APP_Data.ExampleTblPtr = NULL;
+    UtAssert_BOOL_FALSE(SAMPLE_APP_ScrubExampleTable());
+    UtAssert_STUB_COUNT(SAMPLE_APP_Crc32c, 0);
+
+    /* a load still being checked is not scrubbed */
+    SAMPLE_APP_Data.ExampleTblPtr   = &TestTblData;
+    SAMPLE_APP_Data.TblCheckPending = true;
+    UtAssert_BOOL_FALSE(SAMPLE_APP_ScrubExampleTable());
+    UtAssert_STUB_COUNT(SAMPLE_APP_Crc32c, 0);
+    SAMPLE_APP_Data.TblCheckPending = false;
+
+    /* a clean pass takes one slice per call, with the stub CRC matching the load CRC of 0 */
+    Slices = (sizeof(TestTblData) + SAMPLE_APP_SCRUB_BYTES_PER_CYCLE - 1) / SAMPLE_APP_SCRUB_BYTES_PER_CYCLE;
+    SAMPLE_APP_Data.ExampleTblCrc = 0;
+    while (SAMPLE_APP_Data.ScrubPassCount == 0)
+    {
+        UtAssert_BOOL_FALSE(SAMPLE_APP_ScrubExampleTable());
+    }
+    UtAssert_STUB_COUNT(SAMPLE_APP_Crc32c, Slices);
+    UtAssert_ZERO(SAMPLE_APP_Data.ScrubErrorCount);
+    UtAssert_ZERO(SAMPLE_APP_Data.ScrubOffset);
+
+    /* a pass whose CRC differs from the load CRC is reported */
+    SAMPLE_APP_Data.ExampleTblCrc = 0x1234;
+    while (SAMPLE_APP_Data.ScrubOffset + SAMPLE_APP_SCRUB_BYTES_PER_CYCLE < sizeof(TestTblData))
+    {
+        UtAssert_BOOL_FALSE(SAMPLE_APP_ScrubExampleTable());
+    }
+    UtAssert_BOOL_TRUE(SAMPLE_APP_ScrubExampleTable());
+    UtAssert_UINT32_EQ(SAMPLE_APP_Data.ScrubPassCount, 2);
+    UtAssert_UINT32_EQ(SAMPLE_APP_Data.ScrubErrorCount, 1);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+}
+
+void Test_SAMPLE_APP_DecodeMsgHeader(void)
+{
+    /*
+     * Test Case For:
+     * void SAMPLE_APP_DecodeMsgHeader( const CFE_SB_Buffer_t *SBBufPtr, SAMPLE_APP_MsgContext_t *MsgCtx )
+     */
+    CFE_SB_Buffer_t         TestBuf;
+    SAMPLE_APP_MsgContext_t MsgCtx;
+    CFE_SB_MsgId_t          MsgId   = CFE_SB_ValueToMsgId(SAMPLE_APP_CMD_MID);
+    CFE_MSG_FcnCode_t       FcnCode = SAMPLE_APP_PROCESS_CC;
+    CFE_MSG_Size_t          MsgSize = sizeof(SAMPLE_APP_ProcessCmd_t);
+
+    memset(&TestBuf, 0, sizeof(TestBuf));
+    memset(&MsgCtx, 0xFF, sizeof(MsgCtx));
+
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgId), &MsgId, sizeof(MsgId), false);
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetFcnCode), &FcnCode, sizeof(FcnCode), false);
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetSize), &MsgSize, sizeof(MsgSize), false);
+
+    SAMPLE_APP_DecodeMsgHeader(&TestBuf, &MsgCtx);
+
+    UtAssert_UINT32_EQ(CFE_SB_MsgIdToValue(MsgCtx.MsgId), SAMPLE_APP_CMD_MID);
+    UtAssert_UINT32_EQ(MsgCtx.FcnCode, SAMPLE_APP_PROCESS_CC);
+    UtAssert_UINT32_EQ(MsgCtx.MsgSize, sizeof(SAMPLE_APP_ProcessCmd_t));
+
+    /* each header field is decoded exactly once */
+    UtAssert_STUB_COUNT(CFE_MSG_GetMsgId, 1);
+    UtAssert_STUB_COUNT(CFE_MSG_GetFcnCode, 1);
+    UtAssert_STUB_COUNT(CFE_MSG_GetSize, 1);
+    UtAssert_STUB_COUNT(CFE_TIME_GetTime, 1);
 }
 
 /*
@@ -93,5 +395,10 @@ void Test_SAMPLE_APP_GetCrc(void)
 void UtTest_Setup(void)
 {
     ADD_TEST(SAMPLE_APP_TblValidationFunc);
+    ADD_TEST(SAMPLE_APP_TblCheckRecords);
     ADD_TEST(SAMPLE_APP_GetCrc);
+    ADD_TEST(SAMPLE_APP_AcquireExampleTable);
+    ADD_TEST(SAMPLE_APP_ReleaseExampleTable);
+    ADD_TEST(SAMPLE_APP_ScrubExampleTable);
+    ADD_TEST(SAMPLE_APP_DecodeMsgHeader);
 }
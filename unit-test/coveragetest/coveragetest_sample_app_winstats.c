@@ -0,0 +1,208 @@
+/************************************************************************
+ * NASA Docket No. GSC-18,719-1, and identified as “core Flight System: Bootes”
+ *
+ * Copyright (c) 2020 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/*
+** File: coveragetest_sample_app.c
+**
+** Purpose:
+** Coverage Unit Test cases for the Sample Application
+**
+** Notes:
+** This implements various test cases to exercise all code
+** paths through all functions defined in the Sample application.
+**
+** It is primarily focused at providing examples of the various
+** stub configurations, hook functions, and wrapper calls that
+** are often needed when coercing certain code paths through
+** complex functions.
+*/
+
+
+/*
+ * Includes
+ */
+#include "sample_app_coveragetest_common.h"
+
+/*
+ * Samples fed through the randomized comparison, several times around the ring
+ */
+#define UT_WINSTATS_SAMPLES (4 * SAMPLE_APP_SENSOR_RING_DEPTH + 37)
+
+/*
+ * Statistics of the newest samples computed the slow way, from scratch
+ */
+static void UT_WindowRef(const int16 *Sample, uint32 NumSamples, uint16 Length, SAMPLE_APP_WindowStats_t *Ref)
+{
+    int32  Sum   = 0;
+    uint64 SumSq = 0;
+    uint32 i;
+
+    memset(Ref, 0, sizeof(*Ref));
+    Ref->Length = Length;
+    Ref->Count  = NumSamples < Length ? NumSamples : Length;
+
+    if (Ref->Count == 0)
+    {
+        return;
+    }
+
+    Sample += NumSamples - Ref->Count;
+    Ref->Min = Sample[0];
+    Ref->Max = Sample[0];
+
+    for (i = 0; i < Ref->Count; ++i)
+    {
+        Sum += Sample[i];
+        SumSq += (uint32)(Sample[i] * Sample[i]);
+        if (Sample[i] < Ref->Min)
+        {
+            Ref->Min = Sample[i];
+        }
+        if (Sample[i] > Ref->Max)
+        {
+            Ref->Max = Sample[i];
+        }
+    }
+
+    Ref->Mean     = (float)((double)Sum / Ref->Count);
+    Ref->Variance = (float)((double)(Ref->Count * SumSq - (uint64)((int64)Sum * Sum)) /
+                            ((double)Ref->Count * Ref->Count));
+}
+
+/*
+**********************************************************************************
+**          TEST CASE FUNCTIONS
+**********************************************************************************
+*/
+
+void Test_SAMPLE_APP_WinStatsAdd(void)
+{
+    /*
+     * Test Case For:
+     * void SAMPLE_APP_WinStatsAdd( uint16 Channel, const int16 *Sample, uint32 NumSamples )
+     */
+    static int16              Sample[UT_WINSTATS_SAMPLES];
+    SAMPLE_APP_WindowStats_t *Stats = SAMPLE_APP_Data.WinStatsTlm.Payload.Window[2];
+    SAMPLE_APP_WindowStats_t  Ref;
+    uint32                    Seed       = 1;
+    uint32                    Mismatches = 0;
+    uint32                    Added      = 0;
+    uint32                    Count;
+    uint32                    i;
+    uint16                    w;
+
+    memset(&SAMPLE_APP_Data, 0, sizeof(SAMPLE_APP_Data));
+    UT_SetHandlerFunction(UT_KEY(SAMPLE_APP_TlmBegin), UT_Handler_SAMPLE_APP_TlmBegin, NULL);
+
+    /*
+     * Descending and flat runs, which keep the deques at their longest,
+     * then random full scale samples
+     */
+    for (i = 0; i < UT_WINSTATS_SAMPLES; ++i)
+    {
+        if (i < SAMPLE_APP_SENSOR_RING_DEPTH + 10)
+        {
+            Sample[i] = (int16)(1000 - (int32)i * 7);
+        }
+        else if (i < 2 * SAMPLE_APP_SENSOR_RING_DEPTH)
+        {
+            Sample[i] = 42;
+        }
+        else
+        {
+            Sample[i] = (int16)UT_Random(&Seed);
+        }
+    }
+
+    /*
+     * Add them to one channel in blocks of random size, and after each
+     * block every window must match the statistics computed from scratch
+     */
+    while (Added < UT_WINSTATS_SAMPLES)
+    {
+        Count = 1 + UT_Random(&Seed) % (2 * SAMPLE_APP_SENSOR_BLOCK_SAMPLES);
+        if (Count > UT_WINSTATS_SAMPLES - Added)
+        {
+            Count = UT_WINSTATS_SAMPLES - Added;
+        }
+
+        SAMPLE_APP_WinStatsAdd(2, &Sample[Added], Count);
+        Added += Count;
+
+        SAMPLE_APP_SendWinStatsTlm(NULL);
+        for (w = 0; w < SAMPLE_APP_SENSOR_STAT_WINDOWS; ++w)
+        {
+            UT_WindowRef(Sample, Added, Stats[w].Length, &Ref);
+            if (memcmp(&Stats[w], &Ref, sizeof(Ref)) != 0)
+            {
+                ++Mismatches;
+            }
+        }
+    }
+
+    UtAssert_ZERO(Mismatches);
+    UtAssert_UINT32_EQ(Stats[1].Count, Stats[1].Length);
+
+    /* other channels are untouched */
+    UtAssert_ZERO(SAMPLE_APP_Data.SensorHistory[0].Fill);
+}
+
+void Test_SAMPLE_APP_SendWinStatsTlm(void)
+{
+    /*
+     * Test Case For:
+     * CFE_Status_t SAMPLE_APP_SendWinStatsTlm( const SAMPLE_APP_SendHkCmd_t *Msg )
+     */
+    SAMPLE_APP_WindowStats_t *Stats     = SAMPLE_APP_Data.WinStatsTlm.Payload.Window[3];
+    int16                     Sample[4] = {5, -3, 7, 7};
+
+    memset(&SAMPLE_APP_Data, 0, sizeof(SAMPLE_APP_Data));
+    UT_SetHandlerFunction(UT_KEY(SAMPLE_APP_TlmBegin), UT_Handler_SAMPLE_APP_TlmBegin, NULL);
+
+    /* with no samples every window is empty */
+    UtAssert_INT32_EQ(SAMPLE_APP_SendWinStatsTlm(NULL), CFE_SUCCESS);
+    UtAssert_STUB_COUNT(SAMPLE_APP_TlmSend, 1);
+    UtAssert_ZERO(Stats[0].Count);
+    UtAssert_True(Stats[0].Length > 0, "Window length reported");
+    UtAssert_ZERO(Stats[0].Min);
+    UtAssert_ZERO(Stats[0].Max);
+
+    /* a few samples fill every window alike */
+    SAMPLE_APP_WinStatsAdd(3, Sample, 4);
+    UtAssert_INT32_EQ(SAMPLE_APP_SendWinStatsTlm(NULL), CFE_SUCCESS);
+    UtAssert_STUB_COUNT(SAMPLE_APP_TlmSend, 2);
+    UtAssert_UINT32_EQ(Stats[0].Count, 4);
+    UtAssert_INT32_EQ(Stats[0].Min, -3);
+    UtAssert_INT32_EQ(Stats[0].Max, 7);
+    UtAssert_True(Stats[0].Mean == 4.0f, "Mean %f == 4", (double)Stats[0].Mean);
+    UtAssert_True(Stats[0].Variance == 17.0f, "Variance %f == 17", (double)Stats[0].Variance);
+
+    /* the longer window holds the same samples */
+    UtAssert_UINT32_EQ(Stats[1].Count, 4);
+    UtAssert_INT32_EQ(Stats[1].Min, -3);
+    UtAssert_INT32_EQ(Stats[1].Max, 7);
+}
+
+/*
+ * Register the test cases to execute with the unit test tool
+ */
+void UtTest_Setup(void)
+{
+    ADD_TEST(SAMPLE_APP_WinStatsAdd);
+    ADD_TEST(SAMPLE_APP_SendWinStatsTlm);
+}
@@ -0,0 +1,236 @@
+/************************************************************************
+ * NASA Docket No. GSC-18,719-1, and identified as “core Flight System: Bootes”
+ *
+ * Copyright (c) 2020 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/*
+** File: coveragetest_sample_app.c
+**
+** Purpose:
+** Coverage Unit Test cases for the Sample Application
+**
+** Notes:
+** This implements various test cases to exercise all code
+** paths through all functions defined in the Sample application.
+**
+** It is primarily focused at providing examples of the various
+** stub configurations, hook functions, and wrapper calls that
+** are often needed when coercing certain code paths through
+** complex functions.
+*/
+
+
+/*
+ * Includes
+ */
+#include "sample_lib.h" /* For SAMPLE_LIB_Function */
+#include "sample_app_coveragetest_common.h"
+
+/*
+ * Handler to return a specific table copy from SAMPLE_APP_TableCopyBegin
+ */
+static void UT_Handler_SAMPLE_APP_TableCopyBegin(void *UserObj, UT_EntryKey_t FuncKey, const UT_StubContext_t *Context)
+{
+    const SAMPLE_APP_TableCopy_t *Copy = UserObj;
+
+    UT_Stub_SetReturnValue(FuncKey, Copy);
+}
+
+/*
+**********************************************************************************
+**          TEST CASE FUNCTIONS
+**********************************************************************************
+*/
+
+void Test_SAMPLE_APP_WorkerInit(void)
+{
+    /*
+     * Test Case For:
+     * CFE_Status_t SAMPLE_APP_WorkerInit( void )
+     */
+
+    /* nominal case starts every worker */
+    UtAssert_INT32_EQ(SAMPLE_APP_WorkerInit(), CFE_SUCCESS);
+    UtAssert_STUB_COUNT(OS_CountSemCreate, SAMPLE_APP_NUM_WORKERS);
+    UtAssert_STUB_COUNT(CFE_ES_CreateChildTask, SAMPLE_APP_NUM_WORKERS);
+
+    /* a semaphore failure stops the startup with an event */
+    UT_SetDeferredRetcode(UT_KEY(OS_CountSemCreate), 1, OS_ERROR);
+    UtAssert_INT32_EQ(SAMPLE_APP_WorkerInit(), CFE_STATUS_EXTERNAL_RESOURCE_FAIL);
+    UtAssert_STUB_COUNT(CFE_ES_CreateChildTask, SAMPLE_APP_NUM_WORKERS);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+
+    /* as does a task creation failure */
+    UT_SetDeferredRetcode(UT_KEY(CFE_ES_CreateChildTask), 1, CFE_ES_ERR_CHILD_TASK_CREATE);
+    UtAssert_INT32_EQ(SAMPLE_APP_WorkerInit(), CFE_ES_ERR_CHILD_TASK_CREATE);
+    UtAssert_STUB_COUNT(CFE_ES_CreateChildTask, SAMPLE_APP_NUM_WORKERS + 1);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 2);
+}
+
+void Test_SAMPLE_APP_WorkerSubmit(void)
+{
+    /*
+     * Test Case For:
+     * CFE_Status_t SAMPLE_APP_WorkerSubmit( const SAMPLE_APP_ProcessCmd_t *Msg )
+     */
+    SAMPLE_APP_ProcessCmd_t TestMsg;
+    uint32                  i;
+
+    memset(&TestMsg, 0, sizeof(TestMsg));
+    memset(SAMPLE_APP_Data.Worker, 0, sizeof(SAMPLE_APP_Data.Worker));
+
+    /* jobs go to the least loaded worker, waking it each time */
+    for (i = 0; i < SAMPLE_APP_NUM_WORKERS; ++i)
+    {
+        UtAssert_INT32_EQ(SAMPLE_APP_WorkerSubmit(&TestMsg), CFE_SUCCESS);
+        UtAssert_UINT32_EQ(SAMPLE_APP_Data.Worker[i].Ring.Head, 1);
+    }
+    UtAssert_STUB_COUNT(OS_CountSemGive, SAMPLE_APP_NUM_WORKERS);
+
+    /* a worker that has taken its job is preferred */
+    SAMPLE_APP_Data.Worker[SAMPLE_APP_NUM_WORKERS - 1].Ring.Tail = 1;
+    UtAssert_INT32_EQ(SAMPLE_APP_WorkerSubmit(&TestMsg), CFE_SUCCESS);
+    UtAssert_UINT32_EQ(SAMPLE_APP_Data.Worker[SAMPLE_APP_NUM_WORKERS - 1].Ring.Head, 2);
+
+    /* once every ring is full, jobs are refused */
+    for (i = 0; i < SAMPLE_APP_NUM_WORKERS; ++i)
+    {
+        SAMPLE_APP_Data.Worker[i].Ring.Tail = 0;
+        SAMPLE_APP_Data.Worker[i].Ring.Head = SAMPLE_APP_WORKER_RING_DEPTH;
+    }
+    UtAssert_INT32_EQ(SAMPLE_APP_WorkerSubmit(&TestMsg), SAMPLE_APP_WORKER_QUEUE_FULL_ERR_CODE);
+    UtAssert_STUB_COUNT(OS_CountSemGive, SAMPLE_APP_NUM_WORKERS + 1);
+    UtAssert_UINT32_EQ(SAMPLE_APP_Data.Worker[0].PeakQueueDepth, 1);
+}
+
+void Test_SAMPLE_APP_WorkerMain(void)
+{
+    /*
+     * Test Case For:
+     * void SAMPLE_APP_WorkerMain( void )
+     */
+    SAMPLE_APP_ProcessCmd_t TestMsg;
+
+    memset(&TestMsg, 0, sizeof(TestMsg));
+    memset(SAMPLE_APP_Data.Worker, 0, sizeof(SAMPLE_APP_Data.Worker));
+    SAMPLE_APP_Data.WorkerStartCount = 0;
+
+    /* one queued job is run, then the semaphore fails and the task exits */
+    UtAssert_INT32_EQ(SAMPLE_APP_WorkerSubmit(&TestMsg), CFE_SUCCESS);
+    UT_SetDeferredRetcode(UT_KEY(OS_CountSemTake), 2, OS_ERROR);
+    SAMPLE_APP_WorkerMain();
+
+    UtAssert_UINT32_EQ(SAMPLE_APP_Data.WorkerStartCount, 1);
+    UtAssert_UINT32_EQ(SAMPLE_APP_Data.Worker[0].Ring.Tail, 1);
+    UtAssert_UINT32_EQ(SAMPLE_APP_Data.Worker[0].CompletedCount, 1);
+    UtAssert_STUB_COUNT(CFE_ES_ExitChildTask, 1);
+}
+
+void Test_SAMPLE_APP_ProcessJob(void)
+{
+    /*
+     * Test Case For:
+     * CFE_Status_t SAMPLE_APP_ProcessJob( const SAMPLE_APP_ProcessCmd_t *Msg )
+     */
+    SAMPLE_APP_ProcessCmd_t TestMsg;
+    SAMPLE_APP_TableCopy_t  TestCopy;
+
+    memset(&TestMsg, 0, sizeof(TestMsg));
+    memset(&TestCopy, 0, sizeof(TestCopy));
+
+    /* Provide some table data for the SAMPLE_APP_ProcessJob() function to use */
+    TestCopy.Tbl.Int1 = 40;
+    TestCopy.Tbl.Int2 = 50;
+    UT_SetHandlerFunction(UT_KEY(SAMPLE_APP_TableCopyBegin), UT_Handler_SAMPLE_APP_TableCopyBegin, &TestCopy);
+
+    /* the first read is overwritten by a load and retried */
+    UT_SetDefaultReturnValue(UT_KEY(SAMPLE_APP_TableCopyValid), true);
+    UT_SetDeferredRetcode(UT_KEY(SAMPLE_APP_TableCopyValid), 1, false);
+    UtAssert_INT32_EQ(SAMPLE_APP_ProcessJob(&TestMsg), CFE_SUCCESS);
+    UtAssert_STUB_COUNT(SAMPLE_APP_TableCopyBegin, 2);
+
+    /*
+     * The table values are traced for formatting later, not written to syslog here
+     */
+    UtAssert_STUB_COUNT(SAMPLE_APP_Trace, 1);
+    UtAssert_STUB_COUNT(CFE_ES_WriteToSysLog, 0);
+
+    /*
+     * Confirm that the SAMPLE_LIB_Function() call was done
+     * NOTE: This stub is provided by the sample_lib library
+     */
+    UtAssert_STUB_COUNT(SAMPLE_LIB_Function, 1);
+
+    /*
+     * Exercise the path where no table copy has been published.
+     * This should add only one call to CFE_ES_WriteToSysLog().
+     */
+    UT_SetHandlerFunction(UT_KEY(SAMPLE_APP_TableCopyBegin), NULL, NULL);
+    UtAssert_INT32_EQ(SAMPLE_APP_ProcessJob(&TestMsg), CFE_TBL_ERR_NEVER_LOADED);
+    UtAssert_STUB_COUNT(CFE_ES_WriteToSysLog, 1);
+    UtAssert_STUB_COUNT(SAMPLE_APP_Trace, 1);
+    UtAssert_STUB_COUNT(SAMPLE_LIB_Function, 1);
+}
+
+void Test_SAMPLE_APP_UpdateWorkerStats(void)
+{
+    /*
+     * Test Case For:
+     * void SAMPLE_APP_UpdateWorkerStats( SAMPLE_APP_HkTlm_Payload_t *Payload )
+     */
+    SAMPLE_APP_WorkerStats_t *Stats = SAMPLE_APP_Data.HkTlm.Payload.Worker;
+    CFE_TIME_SysTime_t        Interval;
+
+    memset(SAMPLE_APP_Data.Worker, 0, sizeof(SAMPLE_APP_Data.Worker));
+    memset(&Interval, 0, sizeof(Interval));
+
+    SAMPLE_APP_Data.Worker[0].Ring.Head      = 3;
+    SAMPLE_APP_Data.Worker[0].Ring.Tail      = 1;
+    SAMPLE_APP_Data.Worker[0].PeakQueueDepth = 4;
+    SAMPLE_APP_Data.Worker[0].CompletedCount = 7;
+    SAMPLE_APP_Data.Worker[0].BusyTime       = 250000;
+
+    /* a zero length interval reports no utilization */
+    SAMPLE_APP_UpdateWorkerStats(&SAMPLE_APP_Data.HkTlm.Payload);
+    UtAssert_ZERO(Stats[0].Utilization);
+    UtAssert_UINT32_EQ(Stats[0].QueueDepth, 2);
+    UtAssert_UINT32_EQ(Stats[0].PeakQueueDepth, 4);
+    UtAssert_UINT32_EQ(Stats[0].CompletedCount, 7);
+
+    /* a quarter of a one second interval busy is 25.00% */
+    Interval.Seconds = 1;
+    UT_SetHandlerFunction(UT_KEY(CFE_TIME_Subtract), UT_Handler_CFE_TIME_Subtract, &Interval);
+    SAMPLE_APP_Data.Worker[0].LastBusyTime = 0;
+    SAMPLE_APP_UpdateWorkerStats(&SAMPLE_APP_Data.HkTlm.Payload);
+    UtAssert_UINT32_EQ(Stats[0].Utilization, 2500);
+
+    /* busy time is measured since the last update, and limited to 100.00% */
+    SAMPLE_APP_Data.Worker[0].BusyTime += 2000000;
+    SAMPLE_APP_UpdateWorkerStats(&SAMPLE_APP_Data.HkTlm.Payload);
+    UtAssert_UINT32_EQ(Stats[0].Utilization, 10000);
+}
+
+/*
+ * Register the test cases to execute with the unit test tool
+ */
+void UtTest_Setup(void)
+{
+    ADD_TEST(SAMPLE_APP_WorkerInit);
+    ADD_TEST(SAMPLE_APP_WorkerSubmit);
+    ADD_TEST(SAMPLE_APP_WorkerMain);
+    ADD_TEST(SAMPLE_APP_ProcessJob);
+    ADD_TEST(SAMPLE_APP_UpdateWorkerStats);
+}
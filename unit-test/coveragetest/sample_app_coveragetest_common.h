@@ -42,10 +42,55 @@
 #include "sample_app_dispatch.h"
 #include "sample_app_cmds.h"
 #include "sample_app_utils.h"
+#include "sample_app_stats.h"
+#include "sample_app_tblcopy.h"
+#include "sample_app_range.h"
+#include "sample_app_crc.h"
+#include "sample_app_worker.h"
+#include "sample_app_pipes.h"
+#include "sample_app_admit.h"
+#include "sample_app_coalesce.h"
+#include "sample_app_ratelimit.h"
+#include "sample_app_trace.h"
+#include "sample_app_tlm.h"
+#include "sample_app_tlmsched.h"
+#include "sample_app_fir.h"
+#include "sample_app_sensor.h"
+#include "sample_app_winstats.h"
+#include "sample_app_quantile.h"
+#include "sample_app_limit.h"
+#include "sample_app_cal.h"
 #include "sample_app_msgids.h"
 #include "sample_app_msg.h"
 #include "sample_app_tbl.h"
 
+/*
+ * Small fixed-seed generator, so every run of a randomized test checks the same data
+ */
+static inline uint32 UT_Random(uint32 *Seed)
+{
+    *Seed = (*Seed * 1103515245) + 12345;
+    return *Seed >> 16;
+}
+
+/*
+ * Handler to build telemetry in the app's own copy of each packet, as when no SB buffer is available
+ */
+static inline void UT_Handler_SAMPLE_APP_TlmBegin(void *UserObj, UT_EntryKey_t FuncKey, const UT_StubContext_t *Context)
+{
+    UT_Stub_SetReturnValue(FuncKey, UT_Hook_GetArgValueByName(Context, "Fallback", CFE_MSG_TelemetryHeader_t *));
+}
+
+/*
+ * Handler to return a specific elapsed time from CFE_TIME_Subtract
+ */
+static inline void UT_Handler_CFE_TIME_Subtract(void *UserObj, UT_EntryKey_t FuncKey, const UT_StubContext_t *Context)
+{
+    CFE_TIME_SysTime_t *Elapsed = UserObj;
+
+    UT_Stub_SetReturnValue(FuncKey, *Elapsed);
+}
+
 /*
  * Macro to add a test case to the list of tests to execute
  */
@@ -0,0 +1,83 @@
+/************************************************************************
+ * NASA Docket No. GSC-18,719-1, and identified as “core Flight System: Bootes”
+ *
+ * Copyright (c) 2020 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/**
+ * @file
+ *
+ * Auto-Generated stub implementations for functions defined in sample_app_cal header
+ */
+
+#include "sample_app_cal.h"
+#include "utgenstub.h"
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for SAMPLE_APP_CalConvert()
+ * ----------------------------------------------------
+ */
+void SAMPLE_APP_CalConvert(const SAMPLE_APP_CalSegments_t *Lut, const int16 *Raw, float *Eng, uint32 Count)
+{
+    UT_GenStub_AddParam(SAMPLE_APP_CalConvert, const SAMPLE_APP_CalSegments_t *, Lut);
+    UT_GenStub_AddParam(SAMPLE_APP_CalConvert, const int16 *, Raw);
+    UT_GenStub_AddParam(SAMPLE_APP_CalConvert, float *, Eng);
+    UT_GenStub_AddParam(SAMPLE_APP_CalConvert, uint32, Count);
+
+    UT_GenStub_Execute(SAMPLE_APP_CalConvert, Basic, NULL);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for SAMPLE_APP_CalConvertScalar()
+ * ----------------------------------------------------
+ */
+void SAMPLE_APP_CalConvertScalar(const SAMPLE_APP_CalSegments_t *Lut, const int16 *Raw, float *Eng, uint32 Count)
+{
+    UT_GenStub_AddParam(SAMPLE_APP_CalConvertScalar, const SAMPLE_APP_CalSegments_t *, Lut);
+    UT_GenStub_AddParam(SAMPLE_APP_CalConvertScalar, const int16 *, Raw);
+    UT_GenStub_AddParam(SAMPLE_APP_CalConvertScalar, float *, Eng);
+    UT_GenStub_AddParam(SAMPLE_APP_CalConvertScalar, uint32, Count);
+
+    UT_GenStub_Execute(SAMPLE_APP_CalConvertScalar, Basic, NULL);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for SAMPLE_APP_CalValidationFunc()
+ * ----------------------------------------------------
+ */
+CFE_Status_t SAMPLE_APP_CalValidationFunc(void *TblData)
+{
+    UT_GenStub_SetupReturnBuffer(SAMPLE_APP_CalValidationFunc, CFE_Status_t);
+
+    UT_GenStub_AddParam(SAMPLE_APP_CalValidationFunc, void *, TblData);
+
+    UT_GenStub_Execute(SAMPLE_APP_CalValidationFunc, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(SAMPLE_APP_CalValidationFunc, CFE_Status_t);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for SAMPLE_APP_UpdateCalibration()
+ * ----------------------------------------------------
+ */
+void SAMPLE_APP_UpdateCalibration(void)
+{
+
+    UT_GenStub_Execute(SAMPLE_APP_UpdateCalibration, Basic, NULL);
+}
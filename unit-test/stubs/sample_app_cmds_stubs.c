@@ -41,6 +41,22 @@ CFE_Status_t SAMPLE_APP_DisplayParamCmd(const SAMPLE_APP_DisplayParamCmd_t *Msg)
     return UT_GenStub_GetReturnValue(SAMPLE_APP_DisplayParamCmd, CFE_Status_t);
 }
 
+/*
+ * ----------------------------------------------------
+ * Generated stub function for SAMPLE_APP_LookupRecordCmd()
+ * ----------------------------------------------------
+ */
+CFE_Status_t SAMPLE_APP_LookupRecordCmd(const SAMPLE_APP_LookupRecordCmd_t *Msg)
+{
+    UT_GenStub_SetupReturnBuffer(SAMPLE_APP_LookupRecordCmd, CFE_Status_t);
+
+    UT_GenStub_AddParam(SAMPLE_APP_LookupRecordCmd, const SAMPLE_APP_LookupRecordCmd_t *, Msg);
+
+    UT_GenStub_Execute(SAMPLE_APP_LookupRecordCmd, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(SAMPLE_APP_LookupRecordCmd, CFE_Status_t);
+}
+
 /*
  * ----------------------------------------------------
  * Generated stub function for SAMPLE_APP_NoopCmd()
@@ -57,6 +73,17 @@ CFE_Status_t SAMPLE_APP_NoopCmd(const SAMPLE_APP_NoopCmd_t *Msg)
     return UT_GenStub_GetReturnValue(SAMPLE_APP_NoopCmd, CFE_Status_t);
 }
 
+/*
+ * ----------------------------------------------------
+ * Generated stub function for SAMPLE_APP_PerformHousekeeping()
+ * ----------------------------------------------------
+ */
+void SAMPLE_APP_PerformHousekeeping(void)
+{
+
+    UT_GenStub_Execute(SAMPLE_APP_PerformHousekeeping, Basic, NULL);
+}
+
 /*
  * ----------------------------------------------------
  * Generated stub function for SAMPLE_APP_ProcessCmd()
@@ -89,6 +116,38 @@ CFE_Status_t SAMPLE_APP_ResetCountersCmd(const SAMPLE_APP_ResetCountersCmd_t *Ms
     return UT_GenStub_GetReturnValue(SAMPLE_APP_ResetCountersCmd, CFE_Status_t);
 }
 
+/*
+ * ----------------------------------------------------
+ * Generated stub function for SAMPLE_APP_ResetStatsCmd()
+ * ----------------------------------------------------
+ */
+CFE_Status_t SAMPLE_APP_ResetStatsCmd(const SAMPLE_APP_ResetStatsCmd_t *Msg)
+{
+    UT_GenStub_SetupReturnBuffer(SAMPLE_APP_ResetStatsCmd, CFE_Status_t);
+
+    UT_GenStub_AddParam(SAMPLE_APP_ResetStatsCmd, const SAMPLE_APP_ResetStatsCmd_t *, Msg);
+
+    UT_GenStub_Execute(SAMPLE_APP_ResetStatsCmd, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(SAMPLE_APP_ResetStatsCmd, CFE_Status_t);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for SAMPLE_APP_SendAdmitTlm()
+ * ----------------------------------------------------
+ */
+CFE_Status_t SAMPLE_APP_SendAdmitTlm(const SAMPLE_APP_SendHkCmd_t *Msg)
+{
+    UT_GenStub_SetupReturnBuffer(SAMPLE_APP_SendAdmitTlm, CFE_Status_t);
+
+    UT_GenStub_AddParam(SAMPLE_APP_SendAdmitTlm, const SAMPLE_APP_SendHkCmd_t *, Msg);
+
+    UT_GenStub_Execute(SAMPLE_APP_SendAdmitTlm, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(SAMPLE_APP_SendAdmitTlm, CFE_Status_t);
+}
+
 /*
  * ----------------------------------------------------
  * Generated stub function for SAMPLE_APP_SendHkCmd()
@@ -104,3 +163,19 @@ CFE_Status_t SAMPLE_APP_SendHkCmd(const SAMPLE_APP_SendHkCmd_t *Msg)
 
     return UT_GenStub_GetReturnValue(SAMPLE_APP_SendHkCmd, CFE_Status_t);
 }
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for SAMPLE_APP_SendStatsTlm()
+ * ----------------------------------------------------
+ */
+CFE_Status_t SAMPLE_APP_SendStatsTlm(const SAMPLE_APP_SendHkCmd_t *Msg)
+{
+    UT_GenStub_SetupReturnBuffer(SAMPLE_APP_SendStatsTlm, CFE_Status_t);
+
+    UT_GenStub_AddParam(SAMPLE_APP_SendStatsTlm, const SAMPLE_APP_SendHkCmd_t *, Msg);
+
+    UT_GenStub_Execute(SAMPLE_APP_SendStatsTlm, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(SAMPLE_APP_SendStatsTlm, CFE_Status_t);
+}
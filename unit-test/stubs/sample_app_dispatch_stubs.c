@@ -30,9 +30,10 @@
  * Generated stub function for SAMPLE_APP_ProcessGroundCommand()
  * ----------------------------------------------------
  */
-void SAMPLE_APP_ProcessGroundCommand(const CFE_SB_Buffer_t *SBBufPtr)
+void SAMPLE_APP_ProcessGroundCommand(const CFE_SB_Buffer_t *SBBufPtr, const SAMPLE_APP_MsgContext_t *MsgCtx)
 {
     UT_GenStub_AddParam(SAMPLE_APP_ProcessGroundCommand, const CFE_SB_Buffer_t *, SBBufPtr);
+    UT_GenStub_AddParam(SAMPLE_APP_ProcessGroundCommand, const SAMPLE_APP_MsgContext_t *, MsgCtx);
 
     UT_GenStub_Execute(SAMPLE_APP_ProcessGroundCommand, Basic, NULL);
 }
@@ -42,9 +43,10 @@ void SAMPLE_APP_ProcessGroundCommand(const CFE_SB_Buffer_t *SBBufPtr)
  * Generated stub function for SAMPLE_APP_TaskPipe()
  * ----------------------------------------------------
  */
-void SAMPLE_APP_TaskPipe(const CFE_SB_Buffer_t *SBBufPtr)
+void SAMPLE_APP_TaskPipe(const CFE_SB_Buffer_t *SBBufPtr, const SAMPLE_APP_MsgContext_t *MsgCtx)
 {
     UT_GenStub_AddParam(SAMPLE_APP_TaskPipe, const CFE_SB_Buffer_t *, SBBufPtr);
+    UT_GenStub_AddParam(SAMPLE_APP_TaskPipe, const SAMPLE_APP_MsgContext_t *, MsgCtx);
 
     UT_GenStub_Execute(SAMPLE_APP_TaskPipe, Basic, NULL);
 }
@@ -54,11 +56,11 @@ void SAMPLE_APP_TaskPipe(const CFE_SB_Buffer_t *SBBufPtr)
  * Generated stub function for SAMPLE_APP_VerifyCmdLength()
  * ----------------------------------------------------
  */
-bool SAMPLE_APP_VerifyCmdLength(const CFE_MSG_Message_t *MsgPtr, size_t ExpectedLength)
+bool SAMPLE_APP_VerifyCmdLength(const SAMPLE_APP_MsgContext_t *MsgCtx, size_t ExpectedLength)
 {
     UT_GenStub_SetupReturnBuffer(SAMPLE_APP_VerifyCmdLength, bool);
 
-    UT_GenStub_AddParam(SAMPLE_APP_VerifyCmdLength, const CFE_MSG_Message_t *, MsgPtr);
+    UT_GenStub_AddParam(SAMPLE_APP_VerifyCmdLength, const SAMPLE_APP_MsgContext_t *, MsgCtx);
     UT_GenStub_AddParam(SAMPLE_APP_VerifyCmdLength, size_t, ExpectedLength);
 
     UT_GenStub_Execute(SAMPLE_APP_VerifyCmdLength, Basic, NULL);
@@ -0,0 +1,75 @@
+/************************************************************************
+ * NASA Docket No. GSC-18,719-1, and identified as “core Flight System: Bootes”
+ *
+ * Copyright (c) 2020 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/**
+ * @file
+ *
+ * Auto-Generated stub implementations for functions defined in sample_app_fir header
+ */
+
+#include "sample_app_fir.h"
+#include "utgenstub.h"
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for SAMPLE_APP_FirFilterS16()
+ * ----------------------------------------------------
+ */
+void SAMPLE_APP_FirFilterS16(const int16 *In, int16 *Out, uint32 Count, const int16 *Taps, uint32 NumTaps)
+{
+    UT_GenStub_AddParam(SAMPLE_APP_FirFilterS16, const int16 *, In);
+    UT_GenStub_AddParam(SAMPLE_APP_FirFilterS16, int16 *, Out);
+    UT_GenStub_AddParam(SAMPLE_APP_FirFilterS16, uint32, Count);
+    UT_GenStub_AddParam(SAMPLE_APP_FirFilterS16, const int16 *, Taps);
+    UT_GenStub_AddParam(SAMPLE_APP_FirFilterS16, uint32, NumTaps);
+
+    UT_GenStub_Execute(SAMPLE_APP_FirFilterS16, Basic, NULL);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for SAMPLE_APP_FirFilterS16Scalar()
+ * ----------------------------------------------------
+ */
+void SAMPLE_APP_FirFilterS16Scalar(const int16 *In, int16 *Out, uint32 Count, const int16 *Taps, uint32 NumTaps)
+{
+    UT_GenStub_AddParam(SAMPLE_APP_FirFilterS16Scalar, const int16 *, In);
+    UT_GenStub_AddParam(SAMPLE_APP_FirFilterS16Scalar, int16 *, Out);
+    UT_GenStub_AddParam(SAMPLE_APP_FirFilterS16Scalar, uint32, Count);
+    UT_GenStub_AddParam(SAMPLE_APP_FirFilterS16Scalar, const int16 *, Taps);
+    UT_GenStub_AddParam(SAMPLE_APP_FirFilterS16Scalar, uint32, NumTaps);
+
+    UT_GenStub_Execute(SAMPLE_APP_FirFilterS16Scalar, Basic, NULL);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for SAMPLE_APP_FirGain()
+ * ----------------------------------------------------
+ */
+uint32 SAMPLE_APP_FirGain(const int16 *Taps, uint32 NumTaps)
+{
+    UT_GenStub_SetupReturnBuffer(SAMPLE_APP_FirGain, uint32);
+
+    UT_GenStub_AddParam(SAMPLE_APP_FirGain, const int16 *, Taps);
+    UT_GenStub_AddParam(SAMPLE_APP_FirGain, uint32, NumTaps);
+
+    UT_GenStub_Execute(SAMPLE_APP_FirGain, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(SAMPLE_APP_FirGain, uint32);
+}
@@ -0,0 +1,115 @@
+/************************************************************************
+ * NASA Docket No. GSC-18,719-1, and identified as “core Flight System: Bootes”
+ *
+ * Copyright (c) 2020 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/**
+ * @file
+ *
+ * Auto-Generated stub implementations for functions defined in sample_app_limit header
+ */
+
+#include "sample_app_limit.h"
+#include "utgenstub.h"
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for SAMPLE_APP_LimitCheckPacket()
+ * ----------------------------------------------------
+ */
+bool SAMPLE_APP_LimitCheckPacket(const CFE_SB_Buffer_t *SBBufPtr, const SAMPLE_APP_MsgContext_t *MsgCtx)
+{
+    UT_GenStub_SetupReturnBuffer(SAMPLE_APP_LimitCheckPacket, bool);
+
+    UT_GenStub_AddParam(SAMPLE_APP_LimitCheckPacket, const CFE_SB_Buffer_t *, SBBufPtr);
+    UT_GenStub_AddParam(SAMPLE_APP_LimitCheckPacket, const SAMPLE_APP_MsgContext_t *, MsgCtx);
+
+    UT_GenStub_Execute(SAMPLE_APP_LimitCheckPacket, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(SAMPLE_APP_LimitCheckPacket, bool);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for SAMPLE_APP_LimitEval()
+ * ----------------------------------------------------
+ */
+void SAMPLE_APP_LimitEval(const SAMPLE_APP_LimitSet_t *Set, uint32 First, uint32 Count, const int32 *Value,
+                          uint8 *State)
+{
+    UT_GenStub_AddParam(SAMPLE_APP_LimitEval, const SAMPLE_APP_LimitSet_t *, Set);
+    UT_GenStub_AddParam(SAMPLE_APP_LimitEval, uint32, First);
+    UT_GenStub_AddParam(SAMPLE_APP_LimitEval, uint32, Count);
+    UT_GenStub_AddParam(SAMPLE_APP_LimitEval, const int32 *, Value);
+    UT_GenStub_AddParam(SAMPLE_APP_LimitEval, uint8 *, State);
+
+    UT_GenStub_Execute(SAMPLE_APP_LimitEval, Basic, NULL);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for SAMPLE_APP_LimitEvalScalar()
+ * ----------------------------------------------------
+ */
+void SAMPLE_APP_LimitEvalScalar(const SAMPLE_APP_LimitSet_t *Set, uint32 First, uint32 Count, const int32 *Value,
+                                uint8 *State)
+{
+    UT_GenStub_AddParam(SAMPLE_APP_LimitEvalScalar, const SAMPLE_APP_LimitSet_t *, Set);
+    UT_GenStub_AddParam(SAMPLE_APP_LimitEvalScalar, uint32, First);
+    UT_GenStub_AddParam(SAMPLE_APP_LimitEvalScalar, uint32, Count);
+    UT_GenStub_AddParam(SAMPLE_APP_LimitEvalScalar, const int32 *, Value);
+    UT_GenStub_AddParam(SAMPLE_APP_LimitEvalScalar, uint8 *, State);
+
+    UT_GenStub_Execute(SAMPLE_APP_LimitEvalScalar, Basic, NULL);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for SAMPLE_APP_LimitFlush()
+ * ----------------------------------------------------
+ */
+void SAMPLE_APP_LimitFlush(void)
+{
+
+    UT_GenStub_Execute(SAMPLE_APP_LimitFlush, Basic, NULL);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for SAMPLE_APP_LimitValidationFunc()
+ * ----------------------------------------------------
+ */
+CFE_Status_t SAMPLE_APP_LimitValidationFunc(void *TblData)
+{
+    UT_GenStub_SetupReturnBuffer(SAMPLE_APP_LimitValidationFunc, CFE_Status_t);
+
+    UT_GenStub_AddParam(SAMPLE_APP_LimitValidationFunc, void *, TblData);
+
+    UT_GenStub_Execute(SAMPLE_APP_LimitValidationFunc, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(SAMPLE_APP_LimitValidationFunc, CFE_Status_t);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for SAMPLE_APP_UpdateLimits()
+ * ----------------------------------------------------
+ */
+void SAMPLE_APP_UpdateLimits(void)
+{
+
+    UT_GenStub_Execute(SAMPLE_APP_UpdateLimits, Basic, NULL);
+}
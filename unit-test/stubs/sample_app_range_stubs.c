@@ -0,0 +1,64 @@
+/************************************************************************
+ * NASA Docket No. GSC-18,719-1, and identified as “core Flight System: Bootes”
+ *
+ * Copyright (c) 2020 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/**
+ * @file
+ *
+ * Auto-Generated stub implementations for functions defined in sample_app_range header
+ */
+
+#include "sample_app_range.h"
+#include "utgenstub.h"
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for SAMPLE_APP_RangeCheckS16()
+ * ----------------------------------------------------
+ */
+uint32 SAMPLE_APP_RangeCheckS16(const int16 *Values, uint32 Count, int16 Min, int16 Max)
+{
+    UT_GenStub_SetupReturnBuffer(SAMPLE_APP_RangeCheckS16, uint32);
+
+    UT_GenStub_AddParam(SAMPLE_APP_RangeCheckS16, const int16 *, Values);
+    UT_GenStub_AddParam(SAMPLE_APP_RangeCheckS16, uint32, Count);
+    UT_GenStub_AddParam(SAMPLE_APP_RangeCheckS16, int16, Min);
+    UT_GenStub_AddParam(SAMPLE_APP_RangeCheckS16, int16, Max);
+
+    UT_GenStub_Execute(SAMPLE_APP_RangeCheckS16, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(SAMPLE_APP_RangeCheckS16, uint32);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for SAMPLE_APP_RangeCheckS16Scalar()
+ * ----------------------------------------------------
+ */
+uint32 SAMPLE_APP_RangeCheckS16Scalar(const int16 *Values, uint32 Count, int16 Min, int16 Max)
+{
+    UT_GenStub_SetupReturnBuffer(SAMPLE_APP_RangeCheckS16Scalar, uint32);
+
+    UT_GenStub_AddParam(SAMPLE_APP_RangeCheckS16Scalar, const int16 *, Values);
+    UT_GenStub_AddParam(SAMPLE_APP_RangeCheckS16Scalar, uint32, Count);
+    UT_GenStub_AddParam(SAMPLE_APP_RangeCheckS16Scalar, int16, Min);
+    UT_GenStub_AddParam(SAMPLE_APP_RangeCheckS16Scalar, int16, Max);
+
+    UT_GenStub_Execute(SAMPLE_APP_RangeCheckS16Scalar, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(SAMPLE_APP_RangeCheckS16Scalar, uint32);
+}
@@ -0,0 +1,87 @@
+/************************************************************************
+ * NASA Docket No. GSC-18,719-1, and identified as “core Flight System: Bootes”
+ *
+ * Copyright (c) 2020 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/**
+ * @file
+ *
+ * Auto-Generated stub implementations for functions defined in sample_app_tblcopy header
+ */
+
+#include "sample_app_tblcopy.h"
+#include "utgenstub.h"
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for SAMPLE_APP_PublishTableCopy()
+ * ----------------------------------------------------
+ */
+void SAMPLE_APP_PublishTableCopy(const SAMPLE_APP_ExampleTable_t *TblPtr)
+{
+    UT_GenStub_AddParam(SAMPLE_APP_PublishTableCopy, const SAMPLE_APP_ExampleTable_t *, TblPtr);
+
+    UT_GenStub_Execute(SAMPLE_APP_PublishTableCopy, Basic, NULL);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for SAMPLE_APP_TableCopyBegin()
+ * ----------------------------------------------------
+ */
+const SAMPLE_APP_TableCopy_t *SAMPLE_APP_TableCopyBegin(uint32 *Token)
+{
+    UT_GenStub_SetupReturnBuffer(SAMPLE_APP_TableCopyBegin, const SAMPLE_APP_TableCopy_t *);
+
+    UT_GenStub_AddParam(SAMPLE_APP_TableCopyBegin, uint32 *, Token);
+
+    UT_GenStub_Execute(SAMPLE_APP_TableCopyBegin, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(SAMPLE_APP_TableCopyBegin, const SAMPLE_APP_TableCopy_t *);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for SAMPLE_APP_TableCopyValid()
+ * ----------------------------------------------------
+ */
+bool SAMPLE_APP_TableCopyValid(uint32 Token)
+{
+    UT_GenStub_SetupReturnBuffer(SAMPLE_APP_TableCopyValid, bool);
+
+    UT_GenStub_AddParam(SAMPLE_APP_TableCopyValid, uint32, Token);
+
+    UT_GenStub_Execute(SAMPLE_APP_TableCopyValid, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(SAMPLE_APP_TableCopyValid, bool);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for SAMPLE_APP_FindRecord()
+ * ----------------------------------------------------
+ */
+const SAMPLE_APP_ExampleRecord_t *SAMPLE_APP_FindRecord(const SAMPLE_APP_TableCopy_t *Copy, uint16 Key)
+{
+    UT_GenStub_SetupReturnBuffer(SAMPLE_APP_FindRecord, const SAMPLE_APP_ExampleRecord_t *);
+
+    UT_GenStub_AddParam(SAMPLE_APP_FindRecord, const SAMPLE_APP_TableCopy_t *, Copy);
+    UT_GenStub_AddParam(SAMPLE_APP_FindRecord, uint16, Key);
+
+    UT_GenStub_Execute(SAMPLE_APP_FindRecord, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(SAMPLE_APP_FindRecord, const SAMPLE_APP_ExampleRecord_t *);
+}
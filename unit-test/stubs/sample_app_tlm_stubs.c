@@ -0,0 +1,67 @@
+/************************************************************************
+ * NASA Docket No. GSC-18,719-1, and identified as “core Flight System: Bootes”
+ *
+ * Copyright (c) 2020 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+/**
+ * @file
+ *
+ * Auto-Generated stub implementations for functions defined in sample_app_tlm header
+ */
+
+#include "sample_app_tlm.h"
+#include "utgenstub.h"
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for SAMPLE_APP_TlmBegin()
+ * ----------------------------------------------------
+ */
+void *SAMPLE_APP_TlmBegin(SAMPLE_APP_TlmPacket_t *Pkt, CFE_MSG_TelemetryHeader_t *Fallback, size_t Size)
+{
+    UT_GenStub_SetupReturnBuffer(SAMPLE_APP_TlmBegin, void *);
+
+    UT_GenStub_AddParam(SAMPLE_APP_TlmBegin, SAMPLE_APP_TlmPacket_t *, Pkt);
+    UT_GenStub_AddParam(SAMPLE_APP_TlmBegin, CFE_MSG_TelemetryHeader_t *, Fallback);
+    UT_GenStub_AddParam(SAMPLE_APP_TlmBegin, size_t, Size);
+
+    UT_GenStub_Execute(SAMPLE_APP_TlmBegin, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(SAMPLE_APP_TlmBegin, void *);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for SAMPLE_APP_TlmDiscard()
+ * ----------------------------------------------------
+ */
+void SAMPLE_APP_TlmDiscard(SAMPLE_APP_TlmPacket_t *Pkt)
+{
+    UT_GenStub_AddParam(SAMPLE_APP_TlmDiscard, SAMPLE_APP_TlmPacket_t *, Pkt);
+
+    UT_GenStub_Execute(SAMPLE_APP_TlmDiscard, Basic, NULL);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for SAMPLE_APP_TlmSend()
+ * ----------------------------------------------------
+ */
+void SAMPLE_APP_TlmSend(SAMPLE_APP_TlmPacket_t *Pkt)
+{
+    UT_GenStub_AddParam(SAMPLE_APP_TlmSend, SAMPLE_APP_TlmPacket_t *, Pkt);
+
+    UT_GenStub_Execute(SAMPLE_APP_TlmSend, Basic, NULL);
+}
@@ -25,18 +25,75 @@
 #include "sample_app_utils.h"
 #include "utgenstub.h"
 
+/*
+ * ----------------------------------------------------
+ * Generated stub function for SAMPLE_APP_AcquireExampleTable()
+ * ----------------------------------------------------
+ */
+CFE_Status_t SAMPLE_APP_AcquireExampleTable(void)
+{
+    UT_GenStub_SetupReturnBuffer(SAMPLE_APP_AcquireExampleTable, CFE_Status_t);
+
+    UT_GenStub_Execute(SAMPLE_APP_AcquireExampleTable, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(SAMPLE_APP_AcquireExampleTable, CFE_Status_t);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for SAMPLE_APP_DecodeMsgHeader()
+ * ----------------------------------------------------
+ */
+void SAMPLE_APP_DecodeMsgHeader(const CFE_SB_Buffer_t *SBBufPtr, SAMPLE_APP_MsgContext_t *MsgCtx)
+{
+    UT_GenStub_AddParam(SAMPLE_APP_DecodeMsgHeader, const CFE_SB_Buffer_t *, SBBufPtr);
+    UT_GenStub_AddParam(SAMPLE_APP_DecodeMsgHeader, SAMPLE_APP_MsgContext_t *, MsgCtx);
+
+    UT_GenStub_Execute(SAMPLE_APP_DecodeMsgHeader, Basic, NULL);
+}
+
 /*
  * ----------------------------------------------------
  * Generated stub function for SAMPLE_APP_GetCrc()
  * ----------------------------------------------------
  */
-void SAMPLE_APP_GetCrc(const char *TableName)
+void SAMPLE_APP_GetCrc(void)
 {
-    UT_GenStub_AddParam(SAMPLE_APP_GetCrc, const char *, TableName);
 
     UT_GenStub_Execute(SAMPLE_APP_GetCrc, Basic, NULL);
 }
 
+/*
+ * ----------------------------------------------------
+ * Generated stub function for SAMPLE_APP_ScrubExampleTable()
+ * ----------------------------------------------------
+ */
+bool SAMPLE_APP_ScrubExampleTable(void)
+{
+    UT_GenStub_SetupReturnBuffer(SAMPLE_APP_ScrubExampleTable, bool);
+
+    UT_GenStub_Execute(SAMPLE_APP_ScrubExampleTable, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(SAMPLE_APP_ScrubExampleTable, bool);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for SAMPLE_APP_TblCheckRecords()
+ * ----------------------------------------------------
+ */
+CFE_Status_t SAMPLE_APP_TblCheckRecords(const SAMPLE_APP_ExampleTable_t *TblPtr, uint16 *Cursor)
+{
+    UT_GenStub_SetupReturnBuffer(SAMPLE_APP_TblCheckRecords, CFE_Status_t);
+
+    UT_GenStub_AddParam(SAMPLE_APP_TblCheckRecords, const SAMPLE_APP_ExampleTable_t *, TblPtr);
+    UT_GenStub_AddParam(SAMPLE_APP_TblCheckRecords, uint16 *, Cursor);
+
+    UT_GenStub_Execute(SAMPLE_APP_TblCheckRecords, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(SAMPLE_APP_TblCheckRecords, CFE_Status_t);
+}
+
 /*
  * ----------------------------------------------------
  * Generated stub function for SAMPLE_APP_TblValidationFunc()
@@ -52,3 +109,14 @@ CFE_Status_t SAMPLE_APP_TblValidationFunc(void *TblData)
 
     return UT_GenStub_GetReturnValue(SAMPLE_APP_TblValidationFunc, CFE_Status_t);
 }
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for SAMPLE_APP_ReleaseExampleTable()
+ * ----------------------------------------------------
+ */
+void SAMPLE_APP_ReleaseExampleTable(void)
+{
+
+    UT_GenStub_Execute(SAMPLE_APP_ReleaseExampleTable, Basic, NULL);
+}